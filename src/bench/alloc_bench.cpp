@@ -0,0 +1,273 @@
+// alloc_bench.cpp
+// Cuenta las llamadas al heap que hace el servidor para decodificar un request
+// y armar sus respuestas, con mensajes en el stack (como antes) y con un arena
+// de protobuf que se reinicia entre requests (como ahora). Reemplaza el
+// operator new global para contar cada asignacion.
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "protocol/chat.pb.h"
+#include "protocol/message.h"
+#include "protocol/message_arena.h"
+
+using Clock = std::chrono::steady_clock;
+
+static std::atomic<uint64_t> allocations{0};
+
+void* operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+// Opciones del benchmark, se llenan desde la linea de comandos
+struct AllocConfig {
+    size_t iterations = 100000;
+    size_t users = 100;       // Usuarios en la respuesta de GET_USERS
+    size_t messageSize = 64;  // Bytes de contenido de cada mensaje
+};
+
+// Resultado de un escenario con una forma de crear los mensajes
+struct AllocResult {
+    double allocationsPerRequest = 0;
+    double nanosecondsPerRequest = 0;
+};
+
+/**
+ * Convierte el valor de una opcion a size_t
+ */
+static bool parseSize(const std::string& value, size_t& out) {
+    try {
+        size_t used = 0;
+        out = std::stoull(value, &used);
+        return used == value.size();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * Lee las opciones del benchmark
+ *
+ * @return false si alguna opcion no es valida
+ */
+static bool parseAllocConfig(int argc, char* argv[], AllocConfig& config) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        size_t equals = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || equals == std::string::npos) {
+            std::cerr << "Invalid option: " << arg << "\n";
+            return false;
+        }
+        std::string name = arg.substr(2, equals - 2);
+        std::string value = arg.substr(equals + 1);
+        bool ok = true;
+        if (name == "iterations") {
+            ok = parseSize(value, config.iterations) && config.iterations > 0;
+        } else if (name == "users") {
+            ok = parseSize(value, config.users);
+        } else if (name == "message-size") {
+            ok = parseSize(value, config.messageSize);
+        } else {
+            std::cerr << "Unknown option: --" << name << "\n";
+            return false;
+        }
+        if (!ok) {
+            std::cerr << "Invalid value for --" << name << ": " << value << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+static void printAllocUsage() {
+    std::cerr << "Usage: alloc_bench [options]\n"
+              << "  --iterations=<count>   Requests decoded per scenario (default 100000)\n"
+              << "  --users=<count>        Users in each GET_USERS response (default 100)\n"
+              << "  --message-size=<bytes> Content size of each message (default 64)\n";
+}
+
+// Datos de los usuarios que se usan para llenar GET_USERS
+struct Directory {
+    std::vector<std::string> names;
+};
+
+/**
+ * SEND_MESSAGE en broadcast con mensajes en el stack: el request, el
+ * INCOMING_MESSAGE para los destinatarios y la confirmacion de estado
+ */
+static void broadcastOnStack(const std::string& payload) {
+    chat::Request request;
+    request.ParseFromArray(payload.data(), static_cast<int>(payload.size()));
+    std::string message = request.send_message().content();
+
+    chat::Response status;
+    status.set_operation(chat::Operation::UPDATE_STATUS);
+    status.set_status_code(chat::StatusCode::OK);
+    status.set_message("Status actualizado automáticamente por el server");
+    SharedFrame statusFrame = encodeFrame(status);
+
+    chat::Response response;
+    response.set_operation(chat::Operation::INCOMING_MESSAGE);
+    response.set_status_code(chat::StatusCode::OK);
+    auto* incoming = response.mutable_incoming_message();
+    incoming->set_content(message);
+    incoming->set_type(chat::MessageType::BROADCAST);
+    incoming->set_sender("bench0");
+    SharedFrame frame = encodeFrame(response);
+}
+
+/**
+ * El mismo SEND_MESSAGE con todos los mensajes en el arena
+ */
+static void broadcastOnArena(MessageArena& arena, const std::string& payload) {
+    chat::Request& request = *arena.create<chat::Request>();
+    request.ParseFromArray(payload.data(), static_cast<int>(payload.size()));
+    const std::string& message = request.send_message().content();
+
+    chat::Response& status = *arena.create<chat::Response>();
+    status.set_operation(chat::Operation::UPDATE_STATUS);
+    status.set_status_code(chat::StatusCode::OK);
+    status.set_message("Status actualizado automáticamente por el server");
+    SharedFrame statusFrame = encodeFrame(status);
+
+    chat::Response& response = *arena.create<chat::Response>();
+    response.set_operation(chat::Operation::INCOMING_MESSAGE);
+    response.set_status_code(chat::StatusCode::OK);
+    auto* incoming = response.mutable_incoming_message();
+    incoming->set_content(message);
+    incoming->set_type(chat::MessageType::BROADCAST);
+    incoming->set_sender("bench0");
+    SharedFrame frame = encodeFrame(response);
+    arena.reset();
+}
+
+/**
+ * GET_USERS con mensajes en el stack, la lista se arma aparte y se copia
+ */
+static void usersOnStack(const std::string& payload, const Directory& directory) {
+    chat::Request request;
+    request.ParseFromArray(payload.data(), static_cast<int>(payload.size()));
+
+    chat::Response response;
+    response.set_operation(chat::Operation::GET_USERS);
+    response.set_status_code(chat::StatusCode::OK);
+    chat::UserListResponse userList;
+    userList.set_type(chat::UserListType::ALL);
+    for (const std::string& name : directory.names) {
+        chat::User* user = userList.add_users();
+        user->set_username(name);
+        user->set_status(chat::UserStatus::ONLINE);
+    }
+    response.mutable_user_list()->CopyFrom(userList);
+    SharedFrame frame = encodeFrame(response);
+}
+
+/**
+ * El mismo GET_USERS en el arena, la lista se llena dentro de la respuesta
+ */
+static void usersOnArena(MessageArena& arena, const std::string& payload, const Directory& directory) {
+    chat::Request& request = *arena.create<chat::Request>();
+    request.ParseFromArray(payload.data(), static_cast<int>(payload.size()));
+
+    chat::Response& response = *arena.create<chat::Response>();
+    response.set_operation(chat::Operation::GET_USERS);
+    response.set_status_code(chat::StatusCode::OK);
+    chat::UserListResponse& userList = *response.mutable_user_list();
+    userList.set_type(chat::UserListType::ALL);
+    for (const std::string& name : directory.names) {
+        chat::User* user = userList.add_users();
+        user->set_username(name);
+        user->set_status(chat::UserStatus::ONLINE);
+    }
+    SharedFrame frame = encodeFrame(response);
+    arena.reset();
+}
+
+/**
+ * Ejecuta un escenario y mide las asignaciones y el tiempo por request
+ */
+template<typename Function>
+static AllocResult measure(size_t iterations, Function&& function) {
+    // Una vuelta previa para que las estructuras internas de protobuf ya existan
+    function();
+    uint64_t before = allocations.load();
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        function();
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    AllocResult result;
+    result.allocationsPerRequest = static_cast<double>(allocations.load() - before) / static_cast<double>(iterations);
+    result.nanosecondsPerRequest = elapsed / static_cast<double>(iterations);
+    return result;
+}
+
+static void writeResult(std::ostream& out, const AllocResult& result) {
+    out << "{\"allocations_per_request\": " << result.allocationsPerRequest
+        << ", \"ns_per_request\": " << result.nanosecondsPerRequest << "}";
+}
+
+/**
+ * Funcion principal del benchmark
+ *
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos
+ */
+int main(int argc, char* argv[]) {
+    AllocConfig config;
+    if (!parseAllocConfig(argc, argv, config)) {
+        printAllocUsage();
+        return 1;
+    }
+
+    // Los requests se serializan una vez, como llegarian por el socket
+    chat::Request send;
+    send.set_operation(chat::Operation::SEND_MESSAGE);
+    send.mutable_send_message()->set_content(std::string(config.messageSize, 'x'));
+    std::string sendPayload = send.SerializeAsString();
+    chat::Request users;
+    users.set_operation(chat::Operation::GET_USERS);
+    users.mutable_get_users();
+    std::string usersPayload = users.SerializeAsString();
+
+    Directory directory;
+    for (size_t i = 0; i < config.users; i++) {
+        directory.names.push_back("bench" + std::to_string(i));
+    }
+
+    // El arena es grande como para que GET_USERS no pida bloques extra
+    MessageArena arena(64 * 1024);
+    AllocResult broadcastStack = measure(config.iterations, [&] { broadcastOnStack(sendPayload); });
+    AllocResult broadcastArena = measure(config.iterations, [&] { broadcastOnArena(arena, sendPayload); });
+    AllocResult usersStack = measure(config.iterations, [&] { usersOnStack(usersPayload, directory); });
+    AllocResult usersArena = measure(config.iterations, [&] { usersOnArena(arena, usersPayload, directory); });
+
+    std::cout << "{\n"
+              << "  \"config\": {\"iterations\": " << config.iterations << ", \"users\": " << config.users
+              << ", \"message_size\": " << config.messageSize << "},\n"
+              << "  \"send_message\": {\"stack\": ";
+    writeResult(std::cout, broadcastStack);
+    std::cout << ", \"arena\": ";
+    writeResult(std::cout, broadcastArena);
+    std::cout << "},\n  \"get_users\": {\"stack\": ";
+    writeResult(std::cout, usersStack);
+    std::cout << ", \"arena\": ";
+    writeResult(std::cout, usersArena);
+    std::cout << "}\n}\n";
+    return 0;
+}
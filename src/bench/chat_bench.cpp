@@ -0,0 +1,774 @@
+// chat_bench.cpp
+// Generador de carga para el servidor: simula muchos usuarios que se
+// registran y envian broadcasts, mensajes directos y GET_USERS a una tasa
+// fija, y mide la latencia de entrega de punta a punta.
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <deque>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "bench/latency_histogram.h"
+#include "protocol/chat.pb.h"
+#include "protocol/message.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Opciones del benchmark, se llenan desde la linea de comandos
+struct BenchConfig {
+    std::string host = "127.0.0.1";
+    uint16_t port = 8080;
+    size_t users = 1000;
+    size_t threads = 4;
+    double rate = 1000;            // Operaciones por segundo entre todos los usuarios
+    double duration = 10;          // Segundos de medicion
+    double drain = 2;              // Segundos de espera al final para las entregas pendientes
+    double broadcastWeight = 0.2;  // Proporciones de cada operacion
+    double directWeight = 0.7;
+    double getUsersWeight = 0.1;
+    double channelWeight = 0;
+    double statusWeight = 0;
+    size_t channels = 0;           // Canales entre los que se reparten los usuarios, 0 para no usar canales
+    size_t messageSize = 64;       // Bytes de contenido de cada mensaje
+    size_t batch = 1;              // Operaciones que un usuario envia juntas en un RequestBatch
+    bool bindSources = true;       // Cada usuario se conecta desde su propia IP 127.x.y.z
+    bool compression = false;      // Los usuarios negocian compresion zlib al registrarse
+    bool presence = false;         // Los usuarios se suscriben a los cambios de presencia
+    std::string output;            // Archivo donde escribir el JSON, vacio para stdout
+};
+
+// Estado de un usuario simulado
+struct BenchUser {
+    int fd = -1;
+    std::string name;
+    FrameBuffer inBuffer;
+    std::string outBuffer;      // Frames que el socket aun no acepto
+    size_t outOffset = 0;
+    bool registered = false;
+    size_t channel = 0;         // Canal al que se suscribe, si hay canales
+    size_t compressAbove = 0;   // Tamaño desde el que se comprimen sus requests, 0 sin compresion
+    bool busy = false;          // Ultimo estado que pidio, los UPDATE_STATUS alternan entre ONLINE y BUSY
+    uint64_t presenceVersion = 0; // Version de presencia que ya recibio
+    std::deque<int64_t> pendingGetUsers; // Momento de envio de cada GET_USERS sin respuesta
+};
+
+// Resultados de un hilo, se combinan al final
+struct BenchStats {
+    LatencyHistogram broadcastLatency;
+    LatencyHistogram directLatency;
+    LatencyHistogram getUsersLatency;
+    LatencyHistogram channelLatency;
+    uint64_t broadcastsSent = 0;
+    uint64_t directsSent = 0;
+    uint64_t getUsersSent = 0;
+    uint64_t channelsSent = 0;
+    uint64_t channelsExpected = 0; // Suma de los suscriptores de los canales de cada mensaje enviado
+    uint64_t broadcastsDelivered = 0;
+    uint64_t directsDelivered = 0;
+    uint64_t channelsDelivered = 0;
+    uint64_t statusSent = 0;
+    uint64_t presenceUpdates = 0;  // PRESENCE_UPDATE recibidos
+    uint64_t presenceEvents = 0;   // Cambios de presencia dentro de esos updates
+    uint64_t presenceResyncs = 0;  // Veces que un usuario perdio cambios y se volvio a suscribir
+    uint64_t acks = 0;
+    uint64_t errors = 0;
+    uint64_t disconnects = 0;
+    uint64_t bytesReceived = 0; // Bytes leidos de los sockets durante la medicion
+};
+
+static std::atomic<size_t> registeredUsers{0};
+static std::atomic<bool> sendingLoad{false}; // Los hilos generan carga
+static std::atomic<bool> measuring{false};   // Las entregas se cuentan en los resultados
+static std::atomic<bool> stopping{false};
+
+static int64_t nowNanoseconds() {
+    return Clock::now().time_since_epoch().count();
+}
+
+/**
+ * Convierte el valor de una opcion a numero
+ */
+static bool parseNumber(const std::string& value, double& out) {
+    try {
+        size_t used = 0;
+        out = std::stod(value, &used);
+        return used == value.size() && out >= 0;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * Lee las opciones del benchmark
+ *
+ * @return false si alguna opcion no es valida
+ */
+static bool parseBenchConfig(int argc, char* argv[], BenchConfig& config) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--no-bind") {
+            config.bindSources = false;
+            continue;
+        }
+        if (arg == "--compression") {
+            config.compression = true;
+            continue;
+        }
+        if (arg == "--presence") {
+            config.presence = true;
+            continue;
+        }
+        size_t equals = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || equals == std::string::npos) {
+            std::cerr << "Invalid option: " << arg << "\n";
+            return false;
+        }
+        std::string name = arg.substr(2, equals - 2);
+        std::string value = arg.substr(equals + 1);
+        double number = 0;
+        bool numeric = parseNumber(value, number);
+        bool ok = true;
+        if (name == "host") {
+            config.host = value;
+        } else if (name == "output") {
+            config.output = value;
+        } else if (name == "port") {
+            ok = numeric && number >= 1 && number <= 65535;
+            config.port = static_cast<uint16_t>(number);
+        } else if (name == "users") {
+            ok = numeric && number >= 2;
+            config.users = static_cast<size_t>(number);
+        } else if (name == "threads") {
+            ok = numeric && number >= 1;
+            config.threads = static_cast<size_t>(number);
+        } else if (name == "rate") {
+            ok = numeric && number > 0;
+            config.rate = number;
+        } else if (name == "duration") {
+            ok = numeric && number > 0;
+            config.duration = number;
+        } else if (name == "drain") {
+            ok = numeric;
+            config.drain = number;
+        } else if (name == "broadcast") {
+            ok = numeric;
+            config.broadcastWeight = number;
+        } else if (name == "dm") {
+            ok = numeric;
+            config.directWeight = number;
+        } else if (name == "get-users") {
+            ok = numeric;
+            config.getUsersWeight = number;
+        } else if (name == "channel") {
+            ok = numeric;
+            config.channelWeight = number;
+        } else if (name == "status") {
+            ok = numeric;
+            config.statusWeight = number;
+        } else if (name == "channels") {
+            ok = numeric;
+            config.channels = static_cast<size_t>(number);
+        } else if (name == "message-size") {
+            ok = numeric && number >= 24;
+            config.messageSize = static_cast<size_t>(number);
+        } else if (name == "batch") {
+            ok = numeric && number >= 1;
+            config.batch = static_cast<size_t>(number);
+        } else {
+            std::cerr << "Unknown option: --" << name << "\n";
+            return false;
+        }
+        if (!ok) {
+            std::cerr << "Invalid value for --" << name << ": " << value << "\n";
+            return false;
+        }
+    }
+    if (config.broadcastWeight + config.directWeight + config.getUsersWeight + config.channelWeight +
+            config.statusWeight <= 0) {
+        std::cerr << "At least one of --broadcast, --dm, --get-users, --channel or --status must be positive\n";
+        return false;
+    }
+    if (config.channelWeight > 0 && config.channels == 0) {
+        std::cerr << "--channel needs --channels to be positive\n";
+        return false;
+    }
+    config.threads = std::min(config.threads, config.users);
+    return true;
+}
+
+static void printBenchUsage() {
+    std::cerr << "Usage: chat_bench [options]\n"
+              << "  --host=<ip>            Server address (default 127.0.0.1)\n"
+              << "  --port=<port>          Server port (default 8080)\n"
+              << "  --users=<count>        Simulated users, one connection each (default 1000)\n"
+              << "  --threads=<count>      Client threads (default 4)\n"
+              << "  --rate=<ops/s>         Operations per second across all users (default 1000)\n"
+              << "  --duration=<seconds>   Measurement time (default 10)\n"
+              << "  --drain=<seconds>      Time to wait for in-flight deliveries at the end (default 2)\n"
+              << "  --broadcast=<weight>   Share of broadcasts in the mix (default 0.2)\n"
+              << "  --dm=<weight>          Share of direct messages in the mix (default 0.7)\n"
+              << "  --get-users=<weight>   Share of GET_USERS requests in the mix (default 0.1)\n"
+              << "  --channel=<weight>     Share of channel messages in the mix (default 0)\n"
+              << "  --status=<weight>      Share of UPDATE_STATUS requests toggling ONLINE/BUSY in the mix (default 0)\n"
+              << "  --channels=<count>     Channels the users are spread over, each user joins one (default 0)\n"
+              << "  --message-size=<bytes> Content size of each message, at least 24 (default 64)\n"
+              << "  --batch=<count>        Operations each user sends together in one RequestBatch frame (default 1)\n"
+              << "  --no-bind              Do not bind each user to its own 127.x.y.z source address\n"
+              << "  --compression          Negotiate zlib compression when registering\n"
+              << "  --presence             Subscribe every user to the presence feed after registering\n"
+              << "  --output=<file>        Write the JSON results to a file instead of stdout\n";
+}
+
+/**
+ * Direccion de origen de un usuario: el servidor solo acepta un usuario por
+ * IP, asi que cada usuario usa una direccion distinta de 127.0.0.0/8
+ */
+static in_addr sourceAddress(size_t index) {
+    uint32_t host = (127u << 24) + 2 + static_cast<uint32_t>(index);
+    in_addr address{};
+    address.s_addr = htonl(host);
+    return address;
+}
+
+/**
+ * Conecta un usuario al servidor, el socket queda no bloqueante
+ */
+static int connectUser(const BenchConfig& config, size_t index) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (config.bindSources) {
+        sockaddr_in source{};
+        source.sin_family = AF_INET;
+        source.sin_addr = sourceAddress(index);
+        if (bind(fd, (struct sockaddr*)&source, sizeof(source)) < 0) {
+            close(fd);
+            return -1;
+        }
+    }
+    sockaddr_in server{};
+    server.sin_family = AF_INET;
+    server.sin_port = htons(config.port);
+    inet_pton(AF_INET, config.host.c_str(), &server.sin_addr);
+    if (connect(fd, (struct sockaddr*)&server, sizeof(server)) < 0) {
+        close(fd);
+        return -1;
+    }
+    int noDelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    if (fcntl(fd, F_SETFL, O_NONBLOCK) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * Envia lo pendiente de un usuario sin bloquear
+ *
+ * @return false si el socket fallo
+ */
+static bool flushUser(BenchUser& user) {
+    while (user.outOffset < user.outBuffer.size()) {
+        ssize_t sent = send(user.fd, user.outBuffer.data() + user.outOffset, user.outBuffer.size() - user.outOffset, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        user.outOffset += sent;
+    }
+    user.outBuffer.clear();
+    user.outOffset = 0;
+    return true;
+}
+
+/**
+ * Hilo del benchmark: atiende a un grupo de usuarios con su propio epoll
+ */
+class BenchWorker {
+public:
+    BenchWorker(const BenchConfig& config, size_t index, size_t firstUser, size_t userCount)
+        : config(config), firstUser(firstUser), random(static_cast<uint32_t>(index * 7919 + 1)) {
+        users.resize(userCount);
+    }
+
+    void run() {
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+        for (size_t i = 0; i < users.size(); i++) {
+            BenchUser& user = users[i];
+            user.name = "bench" + std::to_string(firstUser + i);
+            user.fd = connectUser(config, firstUser + i);
+            if (user.fd < 0) {
+                std::cerr << "Could not connect user " << user.name << ": " << strerror(errno) << "\n";
+                stats.disconnects++;
+                continue;
+            }
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u64 = i;
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, user.fd, &event);
+
+            chat::Request request;
+            request.set_operation(chat::Operation::REGISTER_USER);
+            request.mutable_register_user()->set_username(user.name);
+            if (config.compression) {
+                request.mutable_register_user()->set_compression(chat::Compression::ZLIB);
+            }
+            queueRequest(user, request);
+            // El servidor atiende los requests en orden, el JOIN llega ya registrado
+            if (config.channels > 0) {
+                user.channel = (firstUser + i) % config.channels;
+                chat::Request join;
+                join.set_operation(chat::Operation::JOIN_CHANNEL);
+                join.mutable_join_channel()->set_channel(channelName(user.channel));
+                queueRequest(user, join);
+            }
+            if (config.presence) {
+                subscribePresence(user, false);
+            }
+        }
+
+        // Las operaciones se programan a intervalos fijos (carga abierta), sin
+        // esperar respuestas, para que un servidor lento no baje la carga
+        double share = config.rate / static_cast<double>(config.threads * config.batch);
+        auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / share));
+        Clock::time_point nextOperation = Clock::time_point::max();
+        std::vector<epoll_event> events(256);
+        while (!stopping) {
+            if (sendingLoad && nextOperation == Clock::time_point::max()) {
+                nextOperation = Clock::now();
+            }
+            if (!sendingLoad && nextOperation != Clock::time_point::max()) {
+                nextOperation = Clock::time_point::max();
+            }
+            while (nextOperation <= Clock::now()) {
+                sendOperation();
+                nextOperation += interval;
+            }
+
+            int timeout = 5;
+            if (nextOperation != Clock::time_point::max()) {
+                auto wait = std::chrono::ceil<std::chrono::milliseconds>(nextOperation - Clock::now()).count();
+                timeout = static_cast<int>(std::clamp<int64_t>(wait, 0, 5));
+            }
+            int ready = epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), timeout);
+            for (int i = 0; i < ready; i++) {
+                handleEvents(users[events[i].data.u64], events[i].events);
+            }
+        }
+
+        for (BenchUser& user : users) {
+            if (user.fd >= 0) {
+                close(user.fd);
+            }
+        }
+        close(epollFd);
+    }
+
+    BenchStats stats;
+
+private:
+    // Encola un frame y lo intenta enviar, si no cabe se espera al EPOLLOUT
+    void queueRequest(BenchUser& user, const google::protobuf::Message& request, uint8_t flags = 0) {
+        if (user.fd < 0) {
+            return;
+        }
+        bool wasEmpty = user.outBuffer.empty();
+        appendFrame(user.outBuffer, request, flags, user.compressAbove);
+        if (!flushUser(user)) {
+            disconnect(user);
+            return;
+        }
+        if (wasEmpty != user.outBuffer.empty()) {
+            updateEvents(user);
+        }
+    }
+
+    void updateEvents(BenchUser& user) {
+        epoll_event event{};
+        event.events = static_cast<uint32_t>(EPOLLIN) | (user.outBuffer.empty() ? 0u : static_cast<uint32_t>(EPOLLOUT));
+        event.data.u64 = &user - users.data();
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, user.fd, &event);
+    }
+
+    void disconnect(BenchUser& user) {
+        if (user.fd < 0) {
+            return;
+        }
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, user.fd, nullptr);
+        close(user.fd);
+        user.fd = -1;
+        stats.disconnects++;
+    }
+
+    // Contenido de un mensaje: el momento de envio seguido de relleno hasta el tamaño pedido
+    std::string messageContent() {
+        std::string content = std::to_string(nowNanoseconds());
+        content.push_back(' ');
+        content.resize(std::max(content.size(), config.messageSize), 'x');
+        return content;
+    }
+
+    // Envia operaciones de un usuario al azar segun las proporciones configuradas,
+    // con --batch mayor a 1 van todas juntas en un solo RequestBatch
+    void sendOperation() {
+        std::uniform_int_distribution<size_t> pickUser(0, users.size() - 1);
+        BenchUser& user = users[pickUser(random)];
+        if (user.fd < 0 || !user.registered) {
+            return;
+        }
+        if (config.batch == 1) {
+            chat::Request request;
+            fillOperation(user, request);
+            queueRequest(user, request);
+            return;
+        }
+        chat::RequestBatch batch;
+        for (size_t i = 0; i < config.batch; i++) {
+            fillOperation(user, *batch.add_requests());
+        }
+        queueRequest(user, batch, FrameFlagBatch);
+    }
+
+    // Suscribe al usuario a la presencia, al resincronizar pide solo lo que le falta
+    void subscribePresence(BenchUser& user, bool resync) {
+        chat::Request request;
+        request.set_operation(chat::Operation::SUBSCRIBE_PRESENCE);
+        request.mutable_presence()->set_subscribe(true);
+        if (resync) {
+            request.mutable_presence()->set_known_version(user.presenceVersion);
+        }
+        queueRequest(user, request);
+    }
+
+    static std::string channelName(size_t channel) {
+        return "room" + std::to_string(channel);
+    }
+
+    // Usuarios suscritos a un canal, los usuarios se reparten en orden entre los canales
+    size_t channelSubscribers(size_t channel) const {
+        return config.users / config.channels + (channel < config.users % config.channels ? 1 : 0);
+    }
+
+    // Llena un request con una operacion al azar
+    void fillOperation(BenchUser& user, chat::Request& request) {
+        double total = config.broadcastWeight + config.directWeight + config.getUsersWeight + config.channelWeight +
+                       config.statusWeight;
+        double choice = std::uniform_real_distribution<double>(0, total)(random);
+        if (choice >= total - config.channelWeight) {
+            // Solo le llega a los suscriptores del canal del usuario
+            request.set_operation(chat::Operation::SEND_MESSAGE);
+            request.mutable_send_message()->set_channel(channelName(user.channel));
+            request.mutable_send_message()->set_content(messageContent());
+            stats.channelsSent++;
+            stats.channelsExpected += channelSubscribers(user.channel);
+            return;
+        }
+        if (choice < config.broadcastWeight) {
+            request.set_operation(chat::Operation::SEND_MESSAGE);
+            request.mutable_send_message()->set_content(messageContent());
+            stats.broadcastsSent++;
+        } else if (choice < config.broadcastWeight + config.directWeight) {
+            // El destinatario puede ser cualquier usuario del benchmark, de cualquier hilo
+            std::uniform_int_distribution<size_t> pickRecipient(0, config.users - 1);
+            request.set_operation(chat::Operation::SEND_MESSAGE);
+            request.mutable_send_message()->set_recipient("bench" + std::to_string(pickRecipient(random)));
+            request.mutable_send_message()->set_content(messageContent());
+            stats.directsSent++;
+        } else if (choice < config.broadcastWeight + config.directWeight + config.getUsersWeight) {
+            request.set_operation(chat::Operation::GET_USERS);
+            request.mutable_get_users();
+            user.pendingGetUsers.push_back(nowNanoseconds());
+            stats.getUsersSent++;
+        } else {
+            // Cada cambio de estado es un cambio de presencia para los suscriptores
+            user.busy = !user.busy;
+            request.set_operation(chat::Operation::UPDATE_STATUS);
+            request.mutable_update_status()->set_new_status(user.busy ? chat::UserStatus::BUSY : chat::UserStatus::ONLINE);
+            stats.statusSent++;
+        }
+    }
+
+    void handleEvents(BenchUser& user, uint32_t events) {
+        if (user.fd < 0) {
+            return;
+        }
+        if (events & EPOLLOUT) {
+            if (!flushUser(user)) {
+                disconnect(user);
+                return;
+            }
+            if (user.outBuffer.empty()) {
+                updateEvents(user);
+            }
+        }
+        if (!(events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+            return;
+        }
+        ssize_t bytes = user.inBuffer.readFrom(user.fd);
+        if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        }
+        if (bytes <= 0) {
+            disconnect(user);
+            return;
+        }
+        if (measuring) {
+            stats.bytesReceived += bytes;
+        }
+        std::string_view payload;
+        uint8_t flags;
+        FrameBuffer::Status status;
+        chat::Response response;
+        chat::ResponseBatch batch;
+        while ((status = user.inBuffer.nextFrame(payload, flags)) == FrameBuffer::Status::Complete) {
+            if (flags & FrameFlagCompressed) {
+                if (!decompressPayload(payload, expanded, MaxMessageSize)) {
+                    stats.errors++;
+                    continue;
+                }
+                payload = expanded;
+            }
+            if (flags & FrameFlagBatch) {
+                if (!batch.ParseFromArray(payload.data(), static_cast<int>(payload.size()))) {
+                    stats.errors++;
+                    continue;
+                }
+                for (const chat::Response& item : batch.responses()) {
+                    handleResponse(user, item);
+                }
+                continue;
+            }
+            if (!response.ParseFromArray(payload.data(), static_cast<int>(payload.size()))) {
+                stats.errors++;
+                continue;
+            }
+            handleResponse(user, response);
+        }
+        if (status == FrameBuffer::Status::Invalid) {
+            disconnect(user);
+        }
+    }
+
+    void handleResponse(BenchUser& user, const chat::Response& response) {
+        int64_t now = nowNanoseconds();
+        if (!user.registered) {
+            // La primera respuesta de cada usuario es la de su registro
+            if (response.status_code() == chat::StatusCode::OK) {
+                user.registered = true;
+                if (response.compression() == chat::Compression::ZLIB) {
+                    user.compressAbove = DefaultCompressionThreshold;
+                }
+                registeredUsers++;
+            } else {
+                std::cerr << "Could not register " << user.name << ": " << response.message() << "\n";
+                stats.errors++;
+                disconnect(user);
+            }
+            return;
+        }
+        if (response.operation() == chat::Operation::INCOMING_MESSAGE && response.has_incoming_message()) {
+            const auto& message = response.incoming_message();
+            int64_t sentAt = std::strtoll(message.content().c_str(), nullptr, 10);
+            if (!measuring || sentAt <= 0) {
+                return;
+            }
+            if (message.type() == chat::MessageType::BROADCAST) {
+                stats.broadcastLatency.record(now - sentAt);
+                stats.broadcastsDelivered++;
+            } else if (message.type() == chat::MessageType::CHANNEL) {
+                stats.channelLatency.record(now - sentAt);
+                stats.channelsDelivered++;
+            } else {
+                stats.directLatency.record(now - sentAt);
+                stats.directsDelivered++;
+            }
+            return;
+        }
+        if (response.operation() == chat::Operation::PRESENCE_UPDATE) {
+            const chat::PresenceUpdate& update = response.presence();
+            if (update.snapshot()) {
+                user.presenceVersion = 0;
+            }
+            if (update.from_version() > user.presenceVersion) {
+                // Se descartaron cambios por ir atrasado, se piden los que faltan
+                stats.presenceResyncs++;
+                subscribePresence(user, true);
+                return;
+            }
+            user.presenceVersion = std::max(user.presenceVersion, update.version());
+            if (measuring) {
+                stats.presenceUpdates++;
+                stats.presenceEvents += update.events_size();
+            }
+            return;
+        }
+        if (response.operation() == chat::Operation::GET_USERS && !user.pendingGetUsers.empty()) {
+            // Las respuestas de un mismo socket llegan en el orden de los requests
+            if (measuring) {
+                stats.getUsersLatency.record(now - user.pendingGetUsers.front());
+            }
+            user.pendingGetUsers.pop_front();
+            return;
+        }
+        if (response.status_code() != chat::StatusCode::OK) {
+            stats.errors++;
+        } else {
+            stats.acks++;
+        }
+    }
+
+    const BenchConfig& config;
+    size_t firstUser;
+    std::mt19937 random;
+    std::vector<BenchUser> users;
+    std::string expanded; // Payload de un frame comprimido ya descomprimido
+    int epollFd = -1;
+};
+
+/**
+ * Funcion principal del benchmark
+ *
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos
+ */
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+    if (!parseBenchConfig(argc, argv, config)) {
+        printBenchUsage();
+        return 1;
+    }
+
+    // Se reparten los usuarios entre los hilos
+    std::vector<std::unique_ptr<BenchWorker>> workers;
+    size_t perThread = config.users / config.threads;
+    size_t extra = config.users % config.threads;
+    size_t first = 0;
+    for (size_t i = 0; i < config.threads; i++) {
+        size_t count = perThread + (i < extra ? 1 : 0);
+        workers.push_back(std::make_unique<BenchWorker>(config, i, first, count));
+        first += count;
+    }
+    std::vector<std::thread> threads;
+    for (auto& worker : workers) {
+        threads.emplace_back([&worker] { worker->run(); });
+    }
+
+    // Se espera a que todos los usuarios se registren (o a que se acabe el tiempo)
+    auto registerDeadline = Clock::now() + std::chrono::seconds(30);
+    while (registeredUsers < config.users && Clock::now() < registerDeadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::cerr << registeredUsers << "/" << config.users << " users registered, measuring for " << config.duration << "s\n";
+
+    auto start = Clock::now();
+    measuring = true;
+    sendingLoad = true;
+    std::this_thread::sleep_for(std::chrono::duration<double>(config.duration));
+    // Se deja de enviar pero se siguen contando las entregas que iban en camino
+    sendingLoad = false;
+    auto sendEnd = Clock::now();
+    std::this_thread::sleep_for(std::chrono::duration<double>(config.drain));
+    measuring = false;
+    stopping = true;
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    BenchStats total;
+    for (auto& worker : workers) {
+        const BenchStats& stats = worker->stats;
+        total.broadcastLatency.merge(stats.broadcastLatency);
+        total.directLatency.merge(stats.directLatency);
+        total.getUsersLatency.merge(stats.getUsersLatency);
+        total.channelLatency.merge(stats.channelLatency);
+        total.broadcastsSent += stats.broadcastsSent;
+        total.directsSent += stats.directsSent;
+        total.getUsersSent += stats.getUsersSent;
+        total.channelsSent += stats.channelsSent;
+        total.channelsExpected += stats.channelsExpected;
+        total.channelsDelivered += stats.channelsDelivered;
+        total.statusSent += stats.statusSent;
+        total.presenceUpdates += stats.presenceUpdates;
+        total.presenceEvents += stats.presenceEvents;
+        total.presenceResyncs += stats.presenceResyncs;
+        total.broadcastsDelivered += stats.broadcastsDelivered;
+        total.directsDelivered += stats.directsDelivered;
+        total.acks += stats.acks;
+        total.errors += stats.errors;
+        total.disconnects += stats.disconnects;
+        total.bytesReceived += stats.bytesReceived;
+    }
+
+    double seconds = std::chrono::duration<double>(sendEnd - start).count();
+    uint64_t sent = total.broadcastsSent + total.directsSent + total.getUsersSent + total.channelsSent + total.statusSent;
+    uint64_t delivered = total.broadcastsDelivered + total.directsDelivered + total.channelsDelivered;
+    // Cada broadcast se le debe entregar a todos los usuarios registrados, y cada
+    // mensaje de canal a los suscriptores de su canal
+    uint64_t expected = total.broadcastsSent * registeredUsers + total.directsSent + total.channelsExpected;
+
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"config\": {\"users\": " << config.users << ", \"threads\": " << config.threads
+         << ", \"rate\": " << config.rate << ", \"duration_s\": " << config.duration
+         << ", \"message_size\": " << config.messageSize << ", \"batch\": " << config.batch
+         << ", \"compression\": " << (config.compression ? "true" : "false") << ", \"channels\": " << config.channels
+         << ", \"presence\": " << (config.presence ? "true" : "false")
+         << ", \"mix\": {\"broadcast\": " << config.broadcastWeight << ", \"dm\": " << config.directWeight
+         << ", \"get_users\": " << config.getUsersWeight << ", \"channel\": " << config.channelWeight
+         << ", \"status\": " << config.statusWeight << "}},\n"
+         << "  \"registered\": " << registeredUsers << ",\n"
+         << "  \"sent\": {\"broadcast\": " << total.broadcastsSent << ", \"dm\": " << total.directsSent
+         << ", \"get_users\": " << total.getUsersSent << ", \"channel\": " << total.channelsSent
+         << ", \"status\": " << total.statusSent << ", \"total\": " << sent << "},\n"
+         << "  \"delivered\": {\"broadcast\": " << total.broadcastsDelivered << ", \"dm\": " << total.directsDelivered
+         << ", \"channel\": " << total.channelsDelivered << ", \"expected\": " << expected << "},\n"
+         << "  \"presence\": {\"updates\": " << total.presenceUpdates << ", \"events\": " << total.presenceEvents
+         << ", \"resyncs\": " << total.presenceResyncs << "},\n"
+         << "  \"throughput\": {\"requests_per_s\": " << (seconds > 0 ? sent / seconds : 0)
+         << ", \"deliveries_per_s\": " << (seconds > 0 ? delivered / seconds : 0)
+         << ", \"received_bytes_per_s\": " << (seconds > 0 ? total.bytesReceived / seconds : 0) << "},\n"
+         << "  \"latency\": {\n    \"broadcast\": ";
+    writeLatency(json, total.broadcastLatency);
+    json << ",\n    \"dm\": ";
+    writeLatency(json, total.directLatency);
+    json << ",\n    \"get_users\": ";
+    writeLatency(json, total.getUsersLatency);
+    json << ",\n    \"channel\": ";
+    writeLatency(json, total.channelLatency);
+    json << "\n  },\n"
+         << "  \"acks\": " << total.acks << ",\n"
+         << "  \"errors\": " << total.errors << ",\n"
+         << "  \"disconnects\": " << total.disconnects << "\n"
+         << "}\n";
+
+    if (config.output.empty()) {
+        std::cout << json.str();
+    } else {
+        std::ofstream file(config.output);
+        file << json.str();
+        if (!file) {
+            std::cerr << "Could not write " << config.output << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
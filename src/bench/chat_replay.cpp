@@ -0,0 +1,1350 @@
+// chat_replay.cpp
+// Graba el trafico real de los clientes y lo reproduce contra un servidor.
+// "record" es un proxy TCP: los clientes se conectan a el, todo se reenvia al
+// servidor y cada frame que envia un cliente se guarda con su momento en un
+// archivo de captura. "replay" abre una conexion por sesion grabada y envia
+// sus frames en el mismo orden, a la velocidad original, N veces mas rapido o
+// sin esperas, y mide la latencia de respuestas y entregas y el CPU del
+// servidor para comparar builds con la misma forma de trafico.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "bench/latency_histogram.h"
+#include "protocol/chat.pb.h"
+#include "protocol/message.h"
+
+using Clock = std::chrono::steady_clock;
+
+// El archivo de captura empieza con este magic y sigue con registros:
+//   varint microsegundos desde el registro anterior, varint sesion, byte tipo
+// y los de tipo Frame agregan byte flags, varint tamaño y el payload tal como
+// lo envio el cliente (comprimido si lo estaba)
+constexpr char CaptureMagic[8] = {'C', 'H', 'A', 'T', 'C', 'A', 'P', '1'};
+
+enum class RecordKind : uint8_t {
+    Open = 0,  // Un cliente se conecto
+    Frame = 1, // Un frame completo del cliente al servidor
+    Close = 2  // El cliente dejo de enviar
+};
+
+// Bytes que se leen de un socket por llamada
+constexpr size_t ReadChunk = 64 * 1024;
+
+static volatile std::sig_atomic_t interrupted = 0;
+
+static void onSignal(int) {
+    interrupted = 1;
+}
+
+static int64_t nowNanoseconds() {
+    return Clock::now().time_since_epoch().count();
+}
+
+static void appendVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+static bool readVarint(std::string_view data, size_t& position, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && position < data.size(); shift += 7) {
+        uint8_t byte = static_cast<uint8_t>(data[position++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Convierte el valor de una opcion a numero
+ */
+static bool parseNumber(const std::string& value, double& out) {
+    try {
+        size_t used = 0;
+        out = std::stod(value, &used);
+        return used == value.size() && out >= 0;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * Escribe los registros de una captura. Cada registro se agrega a un buffer
+ * que se escribe al archivo por bloques.
+ */
+class CaptureWriter {
+public:
+    bool open(const std::string& path) {
+        file.open(path, std::ios::binary | std::ios::trunc);
+        file.write(CaptureMagic, sizeof(CaptureMagic));
+        start = Clock::now();
+        return static_cast<bool>(file);
+    }
+
+    void write(RecordKind kind, uint64_t session, uint8_t flags = 0, std::string_view payload = {}) {
+        uint64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+        appendVarint(buffer, micros - lastMicros);
+        lastMicros = micros;
+        appendVarint(buffer, session);
+        buffer.push_back(static_cast<char>(kind));
+        if (kind == RecordKind::Frame) {
+            buffer.push_back(static_cast<char>(flags));
+            appendVarint(buffer, payload.size());
+            buffer.append(payload);
+            frames++;
+            bytes += payload.size();
+        }
+        if (buffer.size() >= ReadChunk) {
+            flush();
+        }
+    }
+
+    bool flush() {
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+        file.flush();
+        return static_cast<bool>(file);
+    }
+
+    uint64_t frames = 0;
+    uint64_t bytes = 0;
+
+private:
+    std::ofstream file;
+    std::string buffer;
+    Clock::time_point start;
+    uint64_t lastMicros = 0;
+};
+
+// Opciones de record, se llenan desde la linea de comandos
+struct RecordConfig {
+    uint16_t listenPort = 9090;
+    std::string host = "127.0.0.1"; // Servidor al que se reenvia
+    uint16_t port = 8080;
+    std::string output;
+    double duration = 0;            // Segundos de grabacion, 0 hasta recibir SIGINT o SIGTERM
+};
+
+// Un cliente conectado al proxy y su conexion al servidor
+struct ProxySession {
+    uint64_t id = 0;
+    int clientFd = -1;
+    int serverFd = -1;
+    std::string toServer;       // Bytes del cliente que el servidor aun no acepto
+    std::string toClient;       // Bytes del servidor que el cliente aun no acepto
+    FrameBuffer frames;         // Copia de lo que envia el cliente, para separar sus frames
+    bool framing = true;        // false si el cliente envio un frame invalido, ya no se graba
+    bool clientEof = false;
+    bool serverEof = false;
+    bool serverShut = false;    // Ya se le paso el EOF del cliente al servidor
+    bool clientShut = false;
+    bool closeRecorded = false;
+};
+
+/**
+ * Proxy que graba lo que envian los clientes. Un solo hilo atiende a todas
+ * las sesiones con epoll.
+ */
+class CaptureProxy {
+public:
+    CaptureProxy(const RecordConfig& config, CaptureWriter& capture) : config(config), capture(capture) {}
+
+    bool run() {
+        listenFd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+        int reuse = 1;
+        setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(config.listenPort);
+        if (bind(listenFd, (struct sockaddr*)&address, sizeof(address)) < 0 || listen(listenFd, SOMAXCONN) < 0) {
+            std::cerr << "Could not listen on port " << config.listenPort << ": " << strerror(errno) << "\n";
+            return false;
+        }
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = ListenTag;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+
+        auto deadline = config.duration > 0
+            ? Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(config.duration))
+            : Clock::time_point::max();
+        std::vector<epoll_event> events(256);
+        while (!interrupted && Clock::now() < deadline) {
+            int ready = epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), 100);
+            for (int i = 0; i < ready; i++) {
+                uint64_t tag = events[i].data.u64;
+                if (tag == ListenTag) {
+                    acceptClients();
+                    continue;
+                }
+                auto it = sessions.find(tag >> 1);
+                if (it != sessions.end()) {
+                    handleEvents(*it->second, (tag & 1) != 0, events[i].events);
+                }
+            }
+        }
+
+        // Las sesiones que siguen abiertas terminan con la grabacion
+        while (!sessions.empty()) {
+            closeSession(*sessions.begin()->second);
+        }
+        close(listenFd);
+        close(epollFd);
+        return true;
+    }
+
+    uint64_t sessionCount() const { return nextSession; }
+
+private:
+    static constexpr uint64_t ListenTag = UINT64_MAX;
+
+    // El tag de epoll lleva la sesion y el lado: 1 para el servidor, 0 para el cliente
+    static uint64_t tagFor(const ProxySession& session, bool serverSide) {
+        return (session.id << 1) | (serverSide ? 1 : 0);
+    }
+
+    void acceptClients() {
+        while (true) {
+            sockaddr_in peer{};
+            socklen_t length = sizeof(peer);
+            int clientFd = accept4(listenFd, (struct sockaddr*)&peer, &length, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (clientFd < 0) {
+                return;
+            }
+            int serverFd = connectUpstream(peer.sin_addr);
+            if (serverFd < 0) {
+                std::cerr << "Could not connect to " << config.host << ":" << config.port << ": " << strerror(errno) << "\n";
+                close(clientFd);
+                continue;
+            }
+            auto session = std::make_unique<ProxySession>();
+            session->id = nextSession++;
+            session->clientFd = clientFd;
+            session->serverFd = serverFd;
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u64 = tagFor(*session, false);
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, clientFd, &event);
+            event.data.u64 = tagFor(*session, true);
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, serverFd, &event);
+            capture.write(RecordKind::Open, session->id);
+            sessions.emplace(session->id, std::move(session));
+        }
+    }
+
+    /**
+     * Conecta al servidor desde la misma IP que el cliente, asi el servidor
+     * (que acepta un usuario por IP) ve a cada cliente por separado. Si esa IP
+     * no es de esta maquina se conecta sin elegir la de origen.
+     */
+    int connectUpstream(in_addr clientAddress) {
+        sockaddr_in server{};
+        server.sin_family = AF_INET;
+        server.sin_port = htons(config.port);
+        inet_pton(AF_INET, config.host.c_str(), &server.sin_addr);
+        for (int attempt = 0; attempt < 2; attempt++) {
+            int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (fd < 0) {
+                return -1;
+            }
+            if (attempt == 0) {
+                sockaddr_in source{};
+                source.sin_family = AF_INET;
+                source.sin_addr = clientAddress;
+                if (bind(fd, (struct sockaddr*)&source, sizeof(source)) < 0) {
+                    close(fd);
+                    continue;
+                }
+            }
+            if (connect(fd, (struct sockaddr*)&server, sizeof(server)) < 0) {
+                close(fd);
+                continue;
+            }
+            int noDelay = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+            fcntl(fd, F_SETFL, O_NONBLOCK);
+            return fd;
+        }
+        return -1;
+    }
+
+    void handleEvents(ProxySession& session, bool serverSide, uint32_t events) {
+        int fd = serverSide ? session.serverFd : session.clientFd;
+        bool& eof = serverSide ? session.serverEof : session.clientEof;
+        std::string& forward = serverSide ? session.toClient : session.toServer;
+        if (events & EPOLLERR) {
+            closeSession(session);
+            return;
+        }
+        if ((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && !eof) {
+            char chunk[ReadChunk];
+            while (true) {
+                ssize_t bytes = recv(fd, chunk, sizeof(chunk), 0);
+                if (bytes < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                    break;
+                }
+                if (bytes < 0) {
+                    closeSession(session);
+                    return;
+                }
+                if (bytes == 0) {
+                    eof = true;
+                    if (!serverSide) {
+                        recordClose(session);
+                    }
+                    break;
+                }
+                forward.append(chunk, static_cast<size_t>(bytes));
+                if (!serverSide) {
+                    recordFrames(session, chunk, static_cast<size_t>(bytes));
+                }
+            }
+        }
+        if (!flush(session.serverFd, session.toServer) || !flush(session.clientFd, session.toClient)) {
+            closeSession(session);
+            return;
+        }
+        // El EOF de un lado se le pasa al otro cuando ya recibio todo lo pendiente
+        if (session.clientEof && session.toServer.empty() && !session.serverShut) {
+            shutdown(session.serverFd, SHUT_WR);
+            session.serverShut = true;
+        }
+        if (session.serverEof && session.toClient.empty() && !session.clientShut) {
+            shutdown(session.clientFd, SHUT_WR);
+            session.clientShut = true;
+        }
+        if (session.serverShut && session.clientShut) {
+            closeSession(session);
+            return;
+        }
+        updateEvents(session);
+    }
+
+    // Separa los frames de lo que envio el cliente y los graba
+    void recordFrames(ProxySession& session, const char* data, size_t size) {
+        if (!session.framing) {
+            return;
+        }
+        session.frames.append(data, size);
+        std::string_view payload;
+        uint8_t flags = 0;
+        FrameBuffer::Status status;
+        while ((status = session.frames.nextFrame(payload, flags)) == FrameBuffer::Status::Complete) {
+            capture.write(RecordKind::Frame, session.id, flags, payload);
+        }
+        if (status == FrameBuffer::Status::Invalid) {
+            session.framing = false;
+        }
+    }
+
+    void recordClose(ProxySession& session) {
+        if (!session.closeRecorded) {
+            capture.write(RecordKind::Close, session.id);
+            session.closeRecorded = true;
+        }
+    }
+
+    static bool flush(int fd, std::string& pending) {
+        size_t offset = 0;
+        while (offset < pending.size()) {
+            ssize_t sent = send(fd, pending.data() + offset, pending.size() - offset, MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    break;
+                }
+                return false;
+            }
+            offset += static_cast<size_t>(sent);
+        }
+        pending.erase(0, offset);
+        return true;
+    }
+
+    void updateEvents(ProxySession& session) {
+        epoll_event event{};
+        event.events = (session.clientEof ? 0u : static_cast<uint32_t>(EPOLLIN)) | (session.toClient.empty() ? 0u : static_cast<uint32_t>(EPOLLOUT));
+        event.data.u64 = tagFor(session, false);
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, session.clientFd, &event);
+        event.events = (session.serverEof ? 0u : static_cast<uint32_t>(EPOLLIN)) | (session.toServer.empty() ? 0u : static_cast<uint32_t>(EPOLLOUT));
+        event.data.u64 = tagFor(session, true);
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, session.serverFd, &event);
+    }
+
+    void closeSession(ProxySession& session) {
+        recordClose(session);
+        close(session.clientFd);
+        close(session.serverFd);
+        sessions.erase(session.id);
+    }
+
+    const RecordConfig& config;
+    CaptureWriter& capture;
+    int listenFd = -1;
+    int epollFd = -1;
+    uint64_t nextSession = 0;
+    std::unordered_map<uint64_t, std::unique_ptr<ProxySession>> sessions;
+};
+
+static void printUsage() {
+    std::cerr << "Usage: chat_replay record [options]\n"
+              << "  --output=<file>        Capture file to write (required)\n"
+              << "  --listen=<port>        Port the clients connect to (default 9090)\n"
+              << "  --host=<ip>            Server the traffic is forwarded to (default 127.0.0.1)\n"
+              << "  --port=<port>          Server port (default 8080)\n"
+              << "  --duration=<seconds>   Stop recording after this time, 0 to stop on SIGINT/SIGTERM (default 0)\n"
+              << "\n"
+              << "Usage: chat_replay replay [options]\n"
+              << "  --input=<file>         Capture file to replay (required)\n"
+              << "  --host=<ip>            Server address (default 127.0.0.1)\n"
+              << "  --port=<port>          Server port (default 8080)\n"
+              << "  --speed=<factor|max>   Time scale, 2 replays twice as fast, max sends without waiting (default 1)\n"
+              << "  --threads=<count>      Client threads, sessions are spread over them (default 4)\n"
+              << "  --drain=<seconds>      Time to wait for in-flight deliveries at the end (default 2)\n"
+              << "  --server-pid=<pid>     Report the CPU time the server process used during the replay\n"
+              << "  --baseline=<file>      JSON results of an earlier replay to compare against\n"
+              << "  --no-bind              Do not bind each session to its own 127.x.y.z source address\n"
+              << "  --output=<file>        Write the JSON results to a file instead of stdout\n";
+}
+
+/**
+ * Separa las opciones --nombre=valor. Las opciones sin valor quedan con valor vacio.
+ */
+static bool parseOptions(int argc, char* argv[], std::vector<std::pair<std::string, std::string>>& options) {
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.rfind("--", 0) != 0) {
+            std::cerr << "Invalid option: " << arg << "\n";
+            return false;
+        }
+        size_t equals = arg.find('=');
+        if (equals == std::string::npos) {
+            options.emplace_back(arg.substr(2), "");
+        } else {
+            options.emplace_back(arg.substr(2, equals - 2), arg.substr(equals + 1));
+        }
+    }
+    return true;
+}
+
+static int runRecord(int argc, char* argv[]) {
+    RecordConfig config;
+    std::vector<std::pair<std::string, std::string>> options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+    for (const auto& [name, value] : options) {
+        double number = 0;
+        bool numeric = parseNumber(value, number);
+        bool ok = true;
+        if (name == "output") {
+            config.output = value;
+        } else if (name == "host") {
+            config.host = value;
+        } else if (name == "port" || name == "listen") {
+            ok = numeric && number >= 1 && number <= 65535;
+            (name == "port" ? config.port : config.listenPort) = static_cast<uint16_t>(number);
+        } else if (name == "duration") {
+            ok = numeric;
+            config.duration = number;
+        } else {
+            std::cerr << "Unknown option: --" << name << "\n";
+            printUsage();
+            return 1;
+        }
+        if (!ok) {
+            std::cerr << "Invalid value for --" << name << ": " << value << "\n";
+            return 1;
+        }
+    }
+    if (config.output.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    CaptureWriter capture;
+    if (!capture.open(config.output)) {
+        std::cerr << "Could not write " << config.output << "\n";
+        return 1;
+    }
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    std::cerr << "Recording clients on port " << config.listenPort << " for " << config.host << ":" << config.port << "\n";
+    auto start = Clock::now();
+    CaptureProxy proxy(config, capture);
+    if (!proxy.run()) {
+        return 1;
+    }
+    if (!capture.flush()) {
+        std::cerr << "Could not write " << config.output << "\n";
+        return 1;
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cerr << "Captured " << capture.frames << " frames (" << capture.bytes << " bytes) from "
+              << proxy.sessionCount() << " sessions in " << seconds << "s\n";
+    return 0;
+}
+
+// Opciones de replay, se llenan desde la linea de comandos
+struct ReplayConfig {
+    std::string input;
+    std::string host = "127.0.0.1";
+    uint16_t port = 8080;
+    double speed = 1;          // Escala de tiempo, 0 para enviar sin esperar
+    size_t threads = 4;
+    double drain = 2;
+    int serverPid = 0;         // Proceso del servidor para medir su CPU, 0 para no medir
+    std::string baseline;
+    bool bindSources = true;   // Cada sesion se conecta desde su propia IP 127.x.y.z
+    std::string output;
+};
+
+// Un frame grabado, listo para enviarse
+struct ReplayFrame {
+    int64_t time = 0;                  // Nanosegundos desde el inicio de la captura
+    std::string bytes;                 // Frame completo con header
+    std::vector<uint64_t> requestIds;  // request_id de cada request del frame
+    std::vector<std::string> messages; // Clave de entrega de cada SEND_MESSAGE del frame
+};
+
+// Una sesion grabada y su estado durante el replay
+struct ReplaySession {
+    size_t index = 0;              // Posicion en la captura, para su IP de origen
+    uint64_t slot = 0;             // Posicion en su hilo, es el dato de su evento de epoll
+    std::string name;              // Usuario del REGISTER_USER grabado
+    int64_t openTime = 0;
+    int64_t closeTime = -1;        // -1 si la captura termino con la sesion abierta
+    std::vector<ReplayFrame> frames;
+    uint64_t nextRequestId = 1;
+
+    int fd = -1;
+    FrameBuffer inBuffer;
+    std::string outBuffer;
+    size_t outOffset = 0;
+    bool closing = false;          // Ya se enviaron todos sus frames, se cierra al vaciar outBuffer
+    std::unordered_map<uint64_t, int64_t> pending; // Momento de envio por request_id sin respuesta
+};
+
+/**
+ * Clave de entrega de un mensaje: remitente y contenido. Si un usuario repite
+ * el mismo contenido cuenta el envio mas reciente.
+ */
+static std::string deliveryKey(const std::string& sender, const std::string& content) {
+    std::string key = sender;
+    key.push_back('\0');
+    key += content;
+    return key;
+}
+
+/**
+ * Momento de envio de cada mensaje, para medir cuanto tarda en llegar a sus
+ * destinatarios. Lo comparten todos los hilos, repartido en shards para que
+ * no compitan por un solo lock.
+ */
+class DeliveryTable {
+public:
+    void record(const std::string& key, int64_t time) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.sent[key] = time;
+    }
+
+    bool find(const std::string& key, int64_t& time) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.sent.find(key);
+        if (it == shard.sent.end()) {
+            return false;
+        }
+        time = it->second;
+        return true;
+    }
+
+private:
+    static constexpr size_t Shards = 64;
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string, int64_t> sent;
+    };
+
+    Shard& shardFor(const std::string& key) {
+        return shards[std::hash<std::string>{}(key) % Shards];
+    }
+
+    std::array<Shard, Shards> shards;
+};
+
+/**
+ * Prepara un frame grabado: a cada request se le pone un request_id propio
+ * para asociar su respuesta (reemplaza el que hubiera puesto el cliente) y se
+ * anotan los mensajes enviados. Un frame que no se puede decodificar se
+ * reenvia tal cual.
+ */
+static ReplayFrame prepareFrame(ReplaySession& session, int64_t time, uint8_t flags, std::string_view payload) {
+    ReplayFrame frame;
+    frame.time = time;
+    std::string expanded;
+    std::string_view plain = payload;
+    bool decoded = true;
+    if (flags & FrameFlagCompressed) {
+        decoded = decompressPayload(payload, expanded, MaxMessageSize);
+        plain = expanded;
+    }
+
+    chat::RequestBatch batch;
+    if (decoded && (flags & FrameFlagBatch)) {
+        decoded = batch.ParseFromArray(plain.data(), static_cast<int>(plain.size()));
+    } else if (decoded) {
+        decoded = batch.add_requests()->ParseFromArray(plain.data(), static_cast<int>(plain.size()));
+    }
+    if (decoded) {
+        for (chat::Request& request : *batch.mutable_requests()) {
+            request.set_request_id(session.nextRequestId++);
+            frame.requestIds.push_back(request.request_id());
+            if (request.operation() == chat::Operation::REGISTER_USER && session.name.empty()) {
+                session.name = request.register_user().username();
+            } else if (request.operation() == chat::Operation::SEND_MESSAGE && !session.name.empty()) {
+                frame.messages.push_back(deliveryKey(session.name, request.send_message().content()));
+            }
+        }
+        // Se vuelve a comprimir solo si el cliente lo habia comprimido
+        size_t compressAbove = (flags & FrameFlagCompressed) ? 1 : 0;
+        const google::protobuf::Message& message = (flags & FrameFlagBatch)
+            ? static_cast<const google::protobuf::Message&>(batch)
+            : static_cast<const google::protobuf::Message&>(batch.requests(0));
+        if (appendFrame(frame.bytes, message, flags & FrameFlagBatch, compressAbove)) {
+            return frame;
+        }
+        frame.bytes.clear();
+        frame.requestIds.clear();
+        frame.messages.clear();
+    }
+    char header[FrameHeaderSize];
+    writeFrameHeader(header, static_cast<uint32_t>(payload.size()), flags);
+    frame.bytes.assign(header, sizeof(header));
+    frame.bytes.append(payload);
+    return frame;
+}
+
+/**
+ * Lee una captura completa. Si el archivo termina a la mitad de un registro
+ * (la grabacion se corto) se usa lo que se alcanzo a leer.
+ */
+static bool loadCapture(const std::string& path, std::vector<std::unique_ptr<ReplaySession>>& sessions,
+                        int64_t& duration, uint64_t& frameCount) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Could not read " << path << "\n";
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(CaptureMagic) || data.compare(0, sizeof(CaptureMagic), CaptureMagic, sizeof(CaptureMagic)) != 0) {
+        std::cerr << path << " is not a chat_replay capture\n";
+        return false;
+    }
+
+    std::unordered_map<uint64_t, ReplaySession*> byId;
+    std::string_view view(data);
+    size_t position = sizeof(CaptureMagic);
+    int64_t micros = 0;
+    frameCount = 0;
+    while (position < view.size()) {
+        uint64_t delta = 0;
+        uint64_t id = 0;
+        if (!readVarint(view, position, delta) || !readVarint(view, position, id) || position >= view.size()) {
+            std::cerr << "Capture truncated, replaying the complete records\n";
+            break;
+        }
+        micros += static_cast<int64_t>(delta);
+        int64_t time = micros * 1000;
+        RecordKind kind = static_cast<RecordKind>(view[position++]);
+        if (kind == RecordKind::Open) {
+            auto session = std::make_unique<ReplaySession>();
+            session->index = sessions.size();
+            session->openTime = time;
+            byId[id] = session.get();
+            sessions.push_back(std::move(session));
+            continue;
+        }
+        auto it = byId.find(id);
+        if (kind == RecordKind::Close) {
+            if (it != byId.end()) {
+                it->second->closeTime = time;
+            }
+            continue;
+        }
+        uint64_t size = 0;
+        if (kind != RecordKind::Frame || position >= view.size()) {
+            std::cerr << "Capture truncated, replaying the complete records\n";
+            break;
+        }
+        uint8_t flags = static_cast<uint8_t>(view[position++]);
+        if (!readVarint(view, position, size) || size > view.size() - position) {
+            std::cerr << "Capture truncated, replaying the complete records\n";
+            break;
+        }
+        if (it != byId.end()) {
+            it->second->frames.push_back(prepareFrame(*it->second, time, flags, view.substr(position, size)));
+            frameCount++;
+        }
+        position += size;
+    }
+    duration = micros * 1000;
+    return true;
+}
+
+// Resultados de un hilo, se combinan al final
+struct ReplayStats {
+    LatencyHistogram responseLatency;  // Del envio de un request a su respuesta
+    LatencyHistogram broadcastLatency; // Del envio de un mensaje a cada entrega
+    LatencyHistogram directLatency;
+    LatencyHistogram channelLatency;
+    uint64_t framesSent = 0;
+    uint64_t requestsSent = 0;
+    uint64_t responses = 0;    // Respuestas con request_id de este replay
+    uint64_t deliveries = 0;   // INCOMING_MESSAGE recibidos
+    uint64_t errors = 0;       // Respuestas con status distinto de OK
+    uint64_t skipped = 0;      // Frames de sesiones que no se pudieron conectar o ya se cerraron
+    uint64_t connectFailures = 0;
+    uint64_t disconnects = 0;  // Conexiones que el servidor cerro antes de que terminara la sesion
+};
+
+static std::atomic<bool> measuring{false};   // Las respuestas se cuentan en los resultados
+static std::atomic<bool> stopping{false};
+static std::atomic<size_t> finishedThreads{0};
+
+/**
+ * Direccion de origen de una sesion: el servidor solo acepta un usuario por
+ * IP, asi que cada sesion usa una direccion distinta de 127.0.0.0/8
+ */
+static in_addr sourceAddress(size_t index) {
+    uint32_t host = (127u << 24) + 2 + static_cast<uint32_t>(index);
+    in_addr address{};
+    address.s_addr = htonl(host);
+    return address;
+}
+
+/**
+ * Hilo del replay: reproduce un grupo de sesiones con su propio epoll
+ */
+class ReplayWorker {
+public:
+    ReplayWorker(const ReplayConfig& config, DeliveryTable& deliveries) : config(config), deliveries(deliveries) {}
+
+    void add(ReplaySession* session) {
+        session->slot = sessions.size();
+        sessions.push_back(session);
+    }
+
+    void run(Clock::time_point start) {
+        epollFd = epoll_create1(EPOLL_CLOEXEC);
+        buildTimeline();
+        std::vector<epoll_event> events(256);
+        size_t next = 0;
+        bool finished = false;
+        while (!stopping) {
+            // Se aplican en orden los eventos cuyo momento escalado ya paso
+            int64_t elapsed = (Clock::now() - start).count();
+            while (next < timeline.size() && scaled(timeline[next].time) <= elapsed) {
+                apply(timeline[next]);
+                next++;
+            }
+            if (next == timeline.size() && !finished) {
+                finished = true;
+                finishedThreads++;
+            }
+
+            int timeout = 5;
+            if (next < timeline.size()) {
+                int64_t wait = (scaled(timeline[next].time) - elapsed + 999999) / 1000000;
+                timeout = static_cast<int>(std::clamp<int64_t>(wait, 0, 5));
+            }
+            int ready = epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), timeout);
+            for (int i = 0; i < ready; i++) {
+                handleEvents(*sessions[events[i].data.u64], events[i].events);
+            }
+        }
+        for (ReplaySession* session : sessions) {
+            if (session->fd >= 0) {
+                close(session->fd);
+            }
+        }
+        close(epollFd);
+    }
+
+    ReplayStats stats;
+
+private:
+    struct TimelineEvent {
+        int64_t time;
+        uint32_t session;
+        uint32_t frame;   // Frame de la sesion, o OpenEvent / CloseEvent
+    };
+    static constexpr uint32_t OpenEvent = UINT32_MAX;
+    static constexpr uint32_t CloseEvent = UINT32_MAX - 1;
+
+    // Los eventos de cada sesion ya estan en orden, el sort estable los mantiene asi
+    void buildTimeline() {
+        for (uint32_t i = 0; i < sessions.size(); i++) {
+            const ReplaySession& session = *sessions[i];
+            timeline.push_back({session.openTime, i, OpenEvent});
+            for (uint32_t frame = 0; frame < session.frames.size(); frame++) {
+                timeline.push_back({session.frames[frame].time, i, frame});
+            }
+            if (session.closeTime >= 0) {
+                timeline.push_back({session.closeTime, i, CloseEvent});
+            }
+        }
+        std::stable_sort(timeline.begin(), timeline.end(),
+                         [](const TimelineEvent& a, const TimelineEvent& b) { return a.time < b.time; });
+    }
+
+    int64_t scaled(int64_t time) const {
+        return config.speed > 0 ? static_cast<int64_t>(static_cast<double>(time) / config.speed) : 0;
+    }
+
+    void apply(const TimelineEvent& event) {
+        ReplaySession& session = *sessions[event.session];
+        if (event.frame == OpenEvent) {
+            open(session, event.session);
+        } else if (event.frame == CloseEvent) {
+            session.closing = true;
+            finishClose(session);
+        } else {
+            send(session, session.frames[event.frame]);
+        }
+    }
+
+    void open(ReplaySession& session, uint32_t index) {
+        int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && config.bindSources) {
+            sockaddr_in source{};
+            source.sin_family = AF_INET;
+            source.sin_addr = sourceAddress(session.index);
+            if (bind(fd, (struct sockaddr*)&source, sizeof(source)) < 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+        sockaddr_in server{};
+        server.sin_family = AF_INET;
+        server.sin_port = htons(config.port);
+        inet_pton(AF_INET, config.host.c_str(), &server.sin_addr);
+        if (fd >= 0 && connect(fd, (struct sockaddr*)&server, sizeof(server)) < 0) {
+            close(fd);
+            fd = -1;
+        }
+        if (fd < 0) {
+            std::cerr << "Could not connect session " << session.index << ": " << strerror(errno) << "\n";
+            stats.connectFailures++;
+            return;
+        }
+        int noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        fcntl(fd, F_SETFL, O_NONBLOCK);
+        session.fd = fd;
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = index;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+
+    void send(ReplaySession& session, const ReplayFrame& frame) {
+        if (session.fd < 0) {
+            stats.skipped++;
+            return;
+        }
+        int64_t now = nowNanoseconds();
+        for (uint64_t id : frame.requestIds) {
+            session.pending[id] = now;
+        }
+        for (const std::string& key : frame.messages) {
+            deliveries.record(key, now);
+        }
+        stats.framesSent++;
+        stats.requestsSent += frame.requestIds.size();
+        bool wasEmpty = session.outBuffer.empty();
+        session.outBuffer += frame.bytes;
+        if (!flush(session)) {
+            disconnect(session);
+            return;
+        }
+        if (wasEmpty != session.outBuffer.empty()) {
+            updateEvents(session);
+        }
+    }
+
+    // Envia lo pendiente sin bloquear, false si el socket fallo
+    bool flush(ReplaySession& session) {
+        while (session.outOffset < session.outBuffer.size()) {
+            ssize_t sent = ::send(session.fd, session.outBuffer.data() + session.outOffset,
+                                  session.outBuffer.size() - session.outOffset, MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+            session.outOffset += static_cast<size_t>(sent);
+        }
+        session.outBuffer.clear();
+        session.outOffset = 0;
+        return true;
+    }
+
+    // Como el cliente grabado, deja de enviar pero sigue leyendo hasta que el servidor cierre
+    void finishClose(ReplaySession& session) {
+        if (session.fd >= 0 && session.closing && session.outBuffer.empty()) {
+            shutdown(session.fd, SHUT_WR);
+        }
+    }
+
+    void updateEvents(ReplaySession& session) {
+        epoll_event event{};
+        event.events = static_cast<uint32_t>(EPOLLIN) | (session.outBuffer.empty() ? 0u : static_cast<uint32_t>(EPOLLOUT));
+        event.data.u64 = session.slot;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, session.fd, &event);
+    }
+
+    void disconnect(ReplaySession& session) {
+        if (session.fd < 0) {
+            return;
+        }
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, session.fd, nullptr);
+        close(session.fd);
+        session.fd = -1;
+        if (!session.closing) {
+            stats.disconnects++;
+        }
+    }
+
+    void handleEvents(ReplaySession& session, uint32_t events) {
+        if (session.fd < 0) {
+            return;
+        }
+        if (events & EPOLLOUT) {
+            if (!flush(session)) {
+                disconnect(session);
+                return;
+            }
+            if (session.outBuffer.empty()) {
+                updateEvents(session);
+                finishClose(session);
+            }
+        }
+        if (!(events & (EPOLLIN | EPOLLHUP | EPOLLERR))) {
+            return;
+        }
+        ssize_t bytes = session.inBuffer.readFrom(session.fd);
+        if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+            return;
+        }
+        if (bytes <= 0) {
+            disconnect(session);
+            return;
+        }
+        std::string_view payload;
+        uint8_t flags;
+        FrameBuffer::Status status;
+        while ((status = session.inBuffer.nextFrame(payload, flags)) == FrameBuffer::Status::Complete) {
+            if (flags & FrameFlagCompressed) {
+                if (!decompressPayload(payload, expanded, MaxMessageSize)) {
+                    stats.errors++;
+                    continue;
+                }
+                payload = expanded;
+            }
+            if (flags & FrameFlagBatch) {
+                if (!batch.ParseFromArray(payload.data(), static_cast<int>(payload.size()))) {
+                    stats.errors++;
+                    continue;
+                }
+                for (const chat::Response& item : batch.responses()) {
+                    handleResponse(session, item);
+                }
+                continue;
+            }
+            if (!response.ParseFromArray(payload.data(), static_cast<int>(payload.size()))) {
+                stats.errors++;
+                continue;
+            }
+            handleResponse(session, response);
+        }
+        if (status == FrameBuffer::Status::Invalid) {
+            disconnect(session);
+        }
+    }
+
+    void handleResponse(ReplaySession& session, const chat::Response& response) {
+        int64_t now = nowNanoseconds();
+        if (response.has_request_id()) {
+            auto it = session.pending.find(response.request_id());
+            if (it != session.pending.end()) {
+                if (measuring) {
+                    stats.responseLatency.record(now - it->second);
+                    stats.responses++;
+                }
+                session.pending.erase(it);
+            }
+        }
+        if (response.status_code() != chat::StatusCode::OK && measuring) {
+            stats.errors++;
+        }
+        if (response.operation() != chat::Operation::INCOMING_MESSAGE || !response.has_incoming_message() || !measuring) {
+            return;
+        }
+        const auto& message = response.incoming_message();
+        stats.deliveries++;
+        int64_t sentAt = 0;
+        if (!deliveries.find(deliveryKey(message.sender(), message.content()), sentAt)) {
+            return;
+        }
+        if (message.type() == chat::MessageType::BROADCAST) {
+            stats.broadcastLatency.record(now - sentAt);
+        } else if (message.type() == chat::MessageType::CHANNEL) {
+            stats.channelLatency.record(now - sentAt);
+        } else {
+            stats.directLatency.record(now - sentAt);
+        }
+    }
+
+    const ReplayConfig& config;
+    DeliveryTable& deliveries;
+    std::vector<ReplaySession*> sessions;
+    std::vector<TimelineEvent> timeline;
+    std::string expanded;      // Payload de un frame comprimido ya descomprimido
+    chat::Response response;   // Se reutilizan entre frames
+    chat::ResponseBatch batch;
+    int epollFd = -1;
+};
+
+/**
+ * Lee el tiempo de CPU que lleva usado un proceso
+ *
+ * @param pid Proceso a medir
+ * @param user Segundos de CPU en modo usuario
+ * @param system Segundos de CPU en modo sistema
+ * @return false si el proceso no existe
+ */
+static bool readCpuSeconds(int pid, double& user, double& system) {
+    std::ifstream file("/proc/" + std::to_string(pid) + "/stat");
+    std::string stat;
+    std::getline(file, stat);
+    // El nombre del proceso va entre parentesis y puede tener espacios
+    size_t end = stat.rfind(')');
+    if (end == std::string::npos) {
+        return false;
+    }
+    std::istringstream fields(stat.substr(end + 1));
+    std::string skip;
+    for (int i = 0; i < 11; i++) {
+        fields >> skip;
+    }
+    unsigned long long userTicks = 0;
+    unsigned long long systemTicks = 0;
+    if (!(fields >> userTicks >> systemTicks)) {
+        return false;
+    }
+    double ticks = static_cast<double>(sysconf(_SC_CLK_TCK));
+    user = static_cast<double>(userTicks) / ticks;
+    system = static_cast<double>(systemTicks) / ticks;
+    return true;
+}
+
+/**
+ * Busca un numero en el JSON de un replay anterior siguiendo sus claves en
+ * orden, por ejemplo {"latency", "dm", "p99_us"}. Solo sirve para el formato
+ * que escribe esta herramienta, donde cada clave aparece despues de su padre.
+ */
+static bool findNumber(const std::string& json, const std::vector<std::string>& path, double& out) {
+    size_t position = 0;
+    for (const std::string& key : path) {
+        position = json.find("\"" + key + "\":", position);
+        if (position == std::string::npos) {
+            return false;
+        }
+        position += key.size() + 3;
+    }
+    try {
+        out = std::stod(json.substr(position, 32));
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+static bool parseReplayConfig(int argc, char* argv[], ReplayConfig& config) {
+    std::vector<std::pair<std::string, std::string>> options;
+    if (!parseOptions(argc, argv, options)) {
+        return false;
+    }
+    for (const auto& [name, value] : options) {
+        if (name == "no-bind") {
+            config.bindSources = false;
+            continue;
+        }
+        double number = 0;
+        bool numeric = parseNumber(value, number);
+        bool ok = true;
+        if (name == "input") {
+            config.input = value;
+        } else if (name == "host") {
+            config.host = value;
+        } else if (name == "output") {
+            config.output = value;
+        } else if (name == "baseline") {
+            config.baseline = value;
+        } else if (name == "port") {
+            ok = numeric && number >= 1 && number <= 65535;
+            config.port = static_cast<uint16_t>(number);
+        } else if (name == "speed") {
+            ok = value == "max" || (numeric && number > 0);
+            config.speed = value == "max" ? 0 : number;
+        } else if (name == "threads") {
+            ok = numeric && number >= 1;
+            config.threads = static_cast<size_t>(number);
+        } else if (name == "drain") {
+            ok = numeric;
+            config.drain = number;
+        } else if (name == "server-pid") {
+            ok = numeric && number >= 1;
+            config.serverPid = static_cast<int>(number);
+        } else {
+            std::cerr << "Unknown option: --" << name << "\n";
+            return false;
+        }
+        if (!ok) {
+            std::cerr << "Invalid value for --" << name << ": " << value << "\n";
+            return false;
+        }
+    }
+    return !config.input.empty();
+}
+
+static int runReplay(int argc, char* argv[]) {
+    ReplayConfig config;
+    if (!parseReplayConfig(argc, argv, config)) {
+        printUsage();
+        return 1;
+    }
+    std::string baseline;
+    if (!config.baseline.empty()) {
+        std::ifstream file(config.baseline);
+        baseline.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        if (baseline.empty()) {
+            std::cerr << "Could not read " << config.baseline << "\n";
+            return 1;
+        }
+    }
+
+    std::vector<std::unique_ptr<ReplaySession>> sessions;
+    int64_t captureDuration = 0;
+    uint64_t frameCount = 0;
+    if (!loadCapture(config.input, sessions, captureDuration, frameCount)) {
+        return 1;
+    }
+    if (sessions.empty()) {
+        std::cerr << "The capture has no sessions\n";
+        return 1;
+    }
+
+    // Las sesiones se reparten entre los hilos, cada una queda completa en uno
+    DeliveryTable deliveries;
+    config.threads = std::min(config.threads, sessions.size());
+    std::vector<std::unique_ptr<ReplayWorker>> workers;
+    for (size_t i = 0; i < config.threads; i++) {
+        workers.push_back(std::make_unique<ReplayWorker>(config, deliveries));
+    }
+    for (size_t i = 0; i < sessions.size(); i++) {
+        workers[i % config.threads]->add(sessions[i].get());
+    }
+    std::cerr << "Replaying " << sessions.size() << " sessions, " << frameCount << " frames, "
+              << static_cast<double>(captureDuration) / 1e9 << "s of traffic at ";
+    if (config.speed > 0) {
+        std::cerr << config.speed << "x\n";
+    } else {
+        std::cerr << "max speed\n";
+    }
+
+    double cpuUserStart = 0;
+    double cpuSystemStart = 0;
+    if (config.serverPid > 0 && !readCpuSeconds(config.serverPid, cpuUserStart, cpuSystemStart)) {
+        std::cerr << "Could not read the CPU time of process " << config.serverPid << "\n";
+        return 1;
+    }
+    auto start = Clock::now();
+    measuring = true;
+    std::vector<std::thread> threads;
+    for (auto& worker : workers) {
+        threads.emplace_back([&worker, start] { worker->run(start); });
+    }
+    while (finishedThreads < workers.size()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    auto sendEnd = Clock::now();
+    // Se siguen contando las respuestas y entregas que iban en camino
+    std::this_thread::sleep_for(std::chrono::duration<double>(config.drain));
+    measuring = false;
+    stopping = true;
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double cpuUserEnd = 0;
+    double cpuSystemEnd = 0;
+    bool cpuMeasured = config.serverPid > 0 && readCpuSeconds(config.serverPid, cpuUserEnd, cpuSystemEnd);
+
+    ReplayStats total;
+    for (auto& worker : workers) {
+        const ReplayStats& stats = worker->stats;
+        total.responseLatency.merge(stats.responseLatency);
+        total.broadcastLatency.merge(stats.broadcastLatency);
+        total.directLatency.merge(stats.directLatency);
+        total.channelLatency.merge(stats.channelLatency);
+        total.framesSent += stats.framesSent;
+        total.requestsSent += stats.requestsSent;
+        total.responses += stats.responses;
+        total.deliveries += stats.deliveries;
+        total.errors += stats.errors;
+        total.skipped += stats.skipped;
+        total.connectFailures += stats.connectFailures;
+        total.disconnects += stats.disconnects;
+    }
+
+    double elapsed = std::chrono::duration<double>(sendEnd - start).count();
+    double cpuUser = cpuUserEnd - cpuUserStart;
+    double cpuSystem = cpuSystemEnd - cpuSystemStart;
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"capture\": {\"sessions\": " << sessions.size() << ", \"frames\": " << frameCount
+         << ", \"duration_s\": " << static_cast<double>(captureDuration) / 1e9 << "},\n"
+         << "  \"config\": {\"speed\": ";
+    if (config.speed > 0) {
+        json << config.speed;
+    } else {
+        json << "\"max\"";
+    }
+    json << ", \"threads\": " << config.threads << ", \"drain_s\": " << config.drain << "},\n"
+         << "  \"replay\": {\"elapsed_s\": " << elapsed << ", \"frames_sent\": " << total.framesSent
+         << ", \"requests_sent\": " << total.requestsSent << ", \"responses\": " << total.responses
+         << ", \"deliveries\": " << total.deliveries << ", \"skipped_frames\": " << total.skipped
+         << ", \"connect_failures\": " << total.connectFailures << "},\n"
+         << "  \"latency\": {\n    \"response\": ";
+    writeLatency(json, total.responseLatency);
+    json << ",\n    \"broadcast\": ";
+    writeLatency(json, total.broadcastLatency);
+    json << ",\n    \"dm\": ";
+    writeLatency(json, total.directLatency);
+    json << ",\n    \"channel\": ";
+    writeLatency(json, total.channelLatency);
+    json << "\n  },\n";
+    if (cpuMeasured) {
+        double cpuTotal = cpuUser + cpuSystem;
+        json << "  \"server_cpu\": {\"user_s\": " << cpuUser << ", \"system_s\": " << cpuSystem
+             << ", \"total_s\": " << cpuTotal << ", \"us_per_request\": "
+             << (total.requestsSent > 0 ? cpuTotal * 1e6 / static_cast<double>(total.requestsSent) : 0) << "},\n";
+    }
+    json << "  \"errors\": " << total.errors << ",\n"
+         << "  \"disconnects\": " << total.disconnects;
+
+    // Cambio de cada metrica respecto al replay anterior, negativo es mejor
+    if (!baseline.empty()) {
+        std::string current = json.str() + "\n}";
+        std::vector<std::vector<std::string>> compared;
+        for (const char* kind : {"response", "broadcast", "dm", "channel"}) {
+            for (const char* field : {"mean_us", "p50_us", "p99_us", "p999_us"}) {
+                compared.push_back({"latency", kind, field});
+            }
+        }
+        compared.push_back({"server_cpu", "total_s"});
+        compared.push_back({"server_cpu", "us_per_request"});
+        compared.push_back({"errors"});
+        compared.push_back({"disconnects"});
+        json << ",\n  \"comparison\": {";
+        const char* separator = "\n";
+        for (const auto& path : compared) {
+            double before = 0;
+            double after = 0;
+            if (!findNumber(baseline, path, before) || !findNumber(current, path, after)) {
+                continue;
+            }
+            std::string name;
+            for (const std::string& key : path) {
+                name += (name.empty() ? "" : ".") + key;
+            }
+            double change = before != 0 ? (after - before) / before * 100 : 0;
+            json << separator << "    \"" << name << "\": {\"baseline\": " << before << ", \"current\": " << after
+                 << ", \"change_pct\": " << change << "}";
+            separator = ",\n";
+            std::cerr << name << ": " << before << " -> " << after << " (" << (change > 0 ? "+" : "") << change << "%)\n";
+        }
+        json << "\n  }";
+    }
+    json << "\n}\n";
+
+    if (config.output.empty()) {
+        std::cout << json.str();
+    } else {
+        std::ofstream file(config.output);
+        file << json.str();
+        if (!file) {
+            std::cerr << "Could not write " << config.output << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Funcion principal de la herramienta
+ *
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos
+ */
+int main(int argc, char* argv[]) {
+    std::string mode = argc >= 2 ? argv[1] : "";
+    if (mode == "record") {
+        return runRecord(argc, argv);
+    }
+    if (mode == "replay") {
+        return runReplay(argc, argv);
+    }
+    printUsage();
+    return 1;
+}
@@ -0,0 +1,438 @@
+// codec_bench.cpp
+// Microbenchmarks del codec de frames (src/protocol/message.cpp): serializar y
+// leer frames en memoria, con y sin compresion, y sendMessage/receiveMessage y
+// el camino de FrameBuffer sobre un socketpair. Cubre varios tamaños de
+// contenido, largos de lista de usuarios y tamaños de batch, y reporta ns,
+// bytes y asignaciones por operacion. Reemplaza el operator new global para
+// contar cada asignacion, como alloc_bench.
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "protocol/chat.pb.h"
+#include "protocol/message.h"
+
+using Clock = std::chrono::steady_clock;
+
+static std::atomic<uint64_t> allocations{0};
+
+void* operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+// Opciones del benchmark, se llenan desde la linea de comandos
+struct CodecConfig {
+    size_t iterations = 10000;
+    std::vector<size_t> sizes = {16, 256, 4096, 32768}; // Bytes de contenido de cada SEND_MESSAGE
+    std::vector<size_t> users = {1, 100, 1000};         // Usuarios en cada respuesta de GET_USERS
+    std::vector<size_t> batches = {1, 16, 128};         // Requests de 64 bytes en cada RequestBatch
+    std::string filter;                                 // Solo los casos cuyo nombre contiene este texto
+    bool json = false;
+    std::string output;                                 // Archivo donde escribir los resultados, vacio para stdout
+};
+
+// Un caso del benchmark: una operacion sobre un mensaje de una forma dada
+struct CodecCase {
+    std::string name;                 // Operacion, por ejemplo socket_send_receive
+    std::string message;              // send_message, get_users o batch
+    size_t param = 0;                 // Tamaño de contenido, usuarios o requests del batch
+    std::function<size_t()> run;      // Hace una operacion y devuelve los bytes del frame
+};
+
+// Resultado de un caso
+struct CodecResult {
+    double nanosecondsPerOp = 0;
+    double bytesPerOp = 0;
+    double allocationsPerOp = 0;
+};
+
+/**
+ * Convierte el valor de una opcion a size_t
+ */
+static bool parseSize(const std::string& value, size_t& out) {
+    try {
+        size_t used = 0;
+        out = std::stoull(value, &used);
+        return used == value.size();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * Convierte una lista separada por comas, todos los valores deben ser positivos
+ */
+static bool parseSizeList(const std::string& value, std::vector<size_t>& out) {
+    out.clear();
+    std::stringstream items(value);
+    std::string item;
+    while (std::getline(items, item, ',')) {
+        size_t number = 0;
+        if (!parseSize(item, number) || number == 0) {
+            return false;
+        }
+        out.push_back(number);
+    }
+    return !out.empty();
+}
+
+/**
+ * Lee las opciones del benchmark
+ *
+ * @return false si alguna opcion no es valida
+ */
+static bool parseCodecConfig(int argc, char* argv[], CodecConfig& config) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--json") {
+            config.json = true;
+            continue;
+        }
+        size_t equals = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || equals == std::string::npos) {
+            std::cerr << "Invalid option: " << arg << "\n";
+            return false;
+        }
+        std::string name = arg.substr(2, equals - 2);
+        std::string value = arg.substr(equals + 1);
+        bool ok = true;
+        if (name == "iterations") {
+            ok = parseSize(value, config.iterations) && config.iterations > 0;
+        } else if (name == "sizes") {
+            ok = parseSizeList(value, config.sizes);
+        } else if (name == "users") {
+            ok = parseSizeList(value, config.users);
+        } else if (name == "batches") {
+            ok = parseSizeList(value, config.batches);
+        } else if (name == "filter") {
+            config.filter = value;
+        } else if (name == "output") {
+            config.output = value;
+        } else {
+            std::cerr << "Unknown option: --" << name << "\n";
+            return false;
+        }
+        if (!ok) {
+            std::cerr << "Invalid value for --" << name << ": " << value << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+static void printCodecUsage() {
+    std::cerr << "Usage: codec_bench [options]\n"
+              << "  --iterations=<count>   Operations measured per case (default 10000)\n"
+              << "  --sizes=<list>         SEND_MESSAGE content sizes in bytes (default 16,256,4096,32768)\n"
+              << "  --users=<list>         Users in each GET_USERS response (default 1,100,1000)\n"
+              << "  --batches=<list>       Requests in each RequestBatch (default 1,16,128)\n"
+              << "  --filter=<text>        Only run the cases whose name contains this text\n"
+              << "  --json                 Write the results as JSON, to keep a baseline and diff it\n"
+              << "  --output=<file>        Write the results to a file instead of stdout\n";
+}
+
+/**
+ * Texto de chat de un tamaño dado: palabras al azar de un vocabulario chico,
+ * asi se comprime como un mensaje real y no como un solo caracter repetido
+ */
+static std::string chatText(size_t size, std::mt19937& random) {
+    static const char* const Words[] = {"hola", "que", "tal", "el", "servidor", "mensaje", "canal", "usuario",
+                                        "bien", "gracias", "nos", "vemos", "luego", "proyecto", "chat", "listo"};
+    std::uniform_int_distribution<size_t> pick(0, std::size(Words) - 1);
+    std::string text;
+    while (text.size() < size) {
+        text += Words[pick(random)];
+        text.push_back(' ');
+    }
+    text.resize(size);
+    return text;
+}
+
+/**
+ * Agrega los casos de un mensaje: serializar y leer en memoria (sin y con
+ * compresion) y enviarlo y recibirlo por un socketpair con sendMessage y
+ * receiveMessage o con appendFrame y FrameBuffer como el servidor.
+ *
+ * @param message Mensaje de ejemplo, se copia
+ * @param flags Flags del frame, FrameFlagBatch para los batches
+ */
+template<typename T>
+static void addCases(std::vector<CodecCase>& cases, const std::string& kind, size_t param, const T& message,
+                     uint8_t flags, const int sockets[2]) {
+    auto shared = std::make_shared<T>(message);
+    auto out = std::make_shared<std::string>();
+    auto buffer = std::make_shared<FrameBuffer>();
+    auto expanded = std::make_shared<std::string>();
+    int writer = sockets[0];
+    int reader = sockets[1];
+
+    // El frame ya serializado, para los casos que solo leen
+    auto plainFrame = std::make_shared<std::string>();
+    appendFrame(*plainFrame, message, flags);
+    auto zlibFrame = std::make_shared<std::string>();
+    appendFrame(*zlibFrame, message, flags, DefaultCompressionThreshold);
+    bool compresses = zlibFrame->size() < plainFrame->size();
+
+    // Lee el siguiente frame del buffer y lo parsea en un mensaje nuevo, como el servidor
+    auto decodeNext = [buffer, expanded]() {
+        std::string_view payload;
+        uint8_t frameFlags = 0;
+        if (buffer->nextFrame(payload, frameFlags) != FrameBuffer::Status::Complete) {
+            std::cerr << "Incomplete frame\n";
+            std::exit(1);
+        }
+        if (frameFlags & FrameFlagCompressed) {
+            decompressPayload(payload, *expanded, MaxMessageSize);
+            payload = *expanded;
+        }
+        T decoded;
+        decoded.ParseFromArray(payload.data(), static_cast<int>(payload.size()));
+    };
+
+    cases.push_back({"append_frame", kind, param, [shared, out, flags]() {
+        out->clear();
+        appendFrame(*out, *shared, flags);
+        return out->size();
+    }});
+    cases.push_back({"encode_frame", kind, param, [shared, flags]() {
+        SharedFrame frame = encodeFrame(*shared, flags);
+        return frame->size();
+    }});
+    cases.push_back({"decode_frame", kind, param, [buffer, plainFrame, decodeNext]() {
+        buffer->append(plainFrame->data(), plainFrame->size());
+        decodeNext();
+        return plainFrame->size();
+    }});
+    // Solo los mensajes que el codec comprimiria con el umbral de siempre
+    if (compresses) {
+        cases.push_back({"append_frame_zlib", kind, param, [shared, out, flags]() {
+            out->clear();
+            appendFrame(*out, *shared, flags, DefaultCompressionThreshold);
+            return out->size();
+        }});
+        cases.push_back({"decode_frame_zlib", kind, param, [buffer, zlibFrame, decodeNext]() {
+            buffer->append(zlibFrame->data(), zlibFrame->size());
+            decodeNext();
+            return zlibFrame->size();
+        }});
+    }
+
+    // sendMessage y receiveMessage no manejan el flag de batch, esos casos solo van con un mensaje
+    if (flags == 0) {
+        cases.push_back({"socket_send_receive", kind, param, [shared, writer, reader, plainFrame]() {
+            T received;
+            if (!sendMessage(writer, *shared) || !receiveMessage(reader, received)) {
+                std::exit(1);
+            }
+            return plainFrame->size();
+        }});
+        if (compresses) {
+            cases.push_back({"socket_send_receive_zlib", kind, param, [shared, writer, reader, zlibFrame]() {
+                T received;
+                if (!sendMessage(writer, *shared, DefaultCompressionThreshold) || !receiveMessage(reader, received)) {
+                    std::exit(1);
+                }
+                return zlibFrame->size();
+            }});
+        }
+    }
+    cases.push_back({"socket_frame_buffer", kind, param, [shared, out, buffer, decodeNext, flags, writer, reader]() {
+        out->clear();
+        appendFrame(*out, *shared, flags);
+        size_t sent = 0;
+        while (sent < out->size()) {
+            ssize_t bytes = send(writer, out->data() + sent, out->size() - sent, MSG_NOSIGNAL);
+            if (bytes <= 0) {
+                std::exit(1);
+            }
+            sent += static_cast<size_t>(bytes);
+        }
+        // El frame ya esta completo en el socket, se lee hasta tenerlo en el buffer
+        size_t received = 0;
+        while (received < out->size()) {
+            ssize_t bytes = buffer->readFrom(reader);
+            if (bytes <= 0) {
+                std::exit(1);
+            }
+            received += static_cast<size_t>(bytes);
+        }
+        decodeNext();
+        return out->size();
+    }});
+}
+
+/**
+ * Ejecuta un caso y mide el tiempo, los bytes y las asignaciones por operacion
+ */
+static CodecResult measure(size_t iterations, const CodecCase& codecCase) {
+    // Una vuelta previa para que los buffers reutilizables ya tengan su tamaño
+    codecCase.run();
+    uint64_t bytes = 0;
+    uint64_t before = allocations.load();
+    auto start = Clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        bytes += codecCase.run();
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    CodecResult result;
+    result.nanosecondsPerOp = elapsed / static_cast<double>(iterations);
+    result.bytesPerOp = static_cast<double>(bytes) / static_cast<double>(iterations);
+    result.allocationsPerOp = static_cast<double>(allocations.load() - before) / static_cast<double>(iterations);
+    return result;
+}
+
+static void writeSizeList(std::ostream& out, const std::vector<size_t>& values) {
+    out << "[";
+    for (size_t i = 0; i < values.size(); i++) {
+        out << (i > 0 ? ", " : "") << values[i];
+    }
+    out << "]";
+}
+
+/**
+ * Funcion principal del benchmark
+ *
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos
+ */
+int main(int argc, char* argv[]) {
+    CodecConfig config;
+    if (!parseCodecConfig(argc, argv, config)) {
+        printCodecUsage();
+        return 1;
+    }
+
+    // El frame mas grande debe caber en el buffer del socketpair para enviarlo y leerlo en un solo hilo
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) < 0) {
+        perror("socketpair");
+        return 1;
+    }
+    int bufferSize = 4 * static_cast<int>(MaxFrameSize);
+    setsockopt(sockets[0], SOL_SOCKET, SO_SNDBUF, &bufferSize, sizeof(bufferSize));
+    setsockopt(sockets[1], SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+
+    std::mt19937 random(42);
+    std::vector<CodecCase> cases;
+    for (size_t size : config.sizes) {
+        chat::Request request;
+        request.set_operation(chat::Operation::SEND_MESSAGE);
+        request.mutable_send_message()->set_recipient("bench1");
+        request.mutable_send_message()->set_content(chatText(size, random));
+        if (request.ByteSizeLong() > MaxFrameSize) {
+            std::cerr << "Skipping content size " << size << ", it does not fit in a frame\n";
+            continue;
+        }
+        addCases(cases, "send_message", size, request, 0, sockets);
+    }
+    for (size_t users : config.users) {
+        chat::Response response;
+        response.set_operation(chat::Operation::GET_USERS);
+        response.set_status_code(chat::StatusCode::OK);
+        chat::UserListResponse& list = *response.mutable_user_list();
+        list.set_type(chat::UserListType::ALL);
+        for (size_t i = 0; i < users; i++) {
+            chat::User* user = list.add_users();
+            user->set_username("user" + std::to_string(i));
+            user->set_status(i % 3 == 0 ? chat::UserStatus::BUSY : chat::UserStatus::ONLINE);
+        }
+        if (response.ByteSizeLong() > MaxFrameSize) {
+            std::cerr << "Skipping " << users << " users, the list does not fit in a frame\n";
+            continue;
+        }
+        addCases(cases, "get_users", users, response, 0, sockets);
+    }
+    for (size_t count : config.batches) {
+        chat::RequestBatch batch;
+        for (size_t i = 0; i < count; i++) {
+            chat::Request& request = *batch.add_requests();
+            request.set_operation(chat::Operation::SEND_MESSAGE);
+            request.mutable_send_message()->set_content(chatText(64, random));
+        }
+        if (batch.ByteSizeLong() > MaxFrameSize) {
+            std::cerr << "Skipping batches of " << count << ", they do not fit in a frame\n";
+            continue;
+        }
+        addCases(cases, "batch", count, batch, FrameFlagBatch, sockets);
+    }
+
+    std::ostringstream report;
+    if (config.json) {
+        report << "{\n"
+               << "  \"config\": {\"iterations\": " << config.iterations << ", \"sizes\": ";
+        writeSizeList(report, config.sizes);
+        report << ", \"users\": ";
+        writeSizeList(report, config.users);
+        report << ", \"batches\": ";
+        writeSizeList(report, config.batches);
+        report << "},\n  \"results\": [";
+    } else {
+        char line[128];
+        snprintf(line, sizeof(line), "%-26s %-13s %7s %12s %12s %10s\n", "case", "message", "param", "ns/op", "bytes/op",
+                 "allocs/op");
+        report << line;
+    }
+    const char* separator = "\n";
+    for (const CodecCase& codecCase : cases) {
+        if (!config.filter.empty() && codecCase.name.find(config.filter) == std::string::npos) {
+            continue;
+        }
+        CodecResult result = measure(config.iterations, codecCase);
+        if (config.json) {
+            // Un resultado por linea, con una clave estable para comparar contra un baseline
+            report << separator << "    {\"key\": \"" << codecCase.name << "/" << codecCase.message << "/" << codecCase.param
+                   << "\", \"case\": \"" << codecCase.name << "\", \"message\": \"" << codecCase.message
+                   << "\", \"param\": " << codecCase.param << ", \"ns_per_op\": " << result.nanosecondsPerOp
+                   << ", \"bytes_per_op\": " << result.bytesPerOp
+                   << ", \"allocations_per_op\": " << result.allocationsPerOp << "}";
+            separator = ",\n";
+        } else {
+            char line[160];
+            snprintf(line, sizeof(line), "%-26s %-13s %7zu %12.1f %12.1f %10.2f\n", codecCase.name.c_str(),
+                     codecCase.message.c_str(), codecCase.param, result.nanosecondsPerOp, result.bytesPerOp,
+                     result.allocationsPerOp);
+            report << line;
+        }
+    }
+    if (config.json) {
+        report << "\n  ]\n}\n";
+    }
+    close(sockets[0]);
+    close(sockets[1]);
+
+    if (config.output.empty()) {
+        std::cout << report.str();
+    } else {
+        std::ofstream file(config.output);
+        file << report.str();
+        if (!file) {
+            std::cerr << "Could not write " << config.output << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
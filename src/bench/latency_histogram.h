@@ -0,0 +1,121 @@
+// latency_histogram.h
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Histograma de latencias con buckets logaritmicos: cada potencia de 2 se
+ * divide en 16 sub-buckets, asi el error relativo de un percentil es menor
+ * al 6.25% sin importar si la latencia es de microsegundos o de segundos.
+ * Registrar un valor es O(1) y el histograma ocupa memoria fija, por lo que
+ * cada hilo puede tener el suyo y al final se combinan.
+ */
+class LatencyHistogram {
+public:
+    /**
+     * Registra una latencia
+     *
+     * @param nanoseconds Latencia en nanosegundos
+     */
+    void record(int64_t nanoseconds) {
+        uint64_t value = nanoseconds > 0 ? static_cast<uint64_t>(nanoseconds) : 0;
+        buckets[bucketFor(value)]++;
+        total++;
+        sum += value;
+        if (value > maximum) {
+            maximum = value;
+        }
+    }
+
+    /**
+     * Suma los valores de otro histograma a este
+     */
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < Buckets; i++) {
+            buckets[i] += other.buckets[i];
+        }
+        total += other.total;
+        sum += other.sum;
+        if (other.maximum > maximum) {
+            maximum = other.maximum;
+        }
+    }
+
+    /**
+     * Calcula un percentil
+     *
+     * @param percentile Percentil entre 0 y 100
+     * @return Limite superior del bucket del percentil, en nanosegundos
+     */
+    uint64_t percentile(double percentile) const {
+        if (total == 0) {
+            return 0;
+        }
+        uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(total));
+        if (rank >= total) {
+            rank = total - 1;
+        }
+        uint64_t seen = 0;
+        for (size_t i = 0; i < Buckets; i++) {
+            seen += buckets[i];
+            if (seen > rank) {
+                uint64_t upper = upperBound(i);
+                return upper < maximum ? upper : maximum;
+            }
+        }
+        return maximum;
+    }
+
+    uint64_t count() const { return total; }
+    uint64_t max() const { return maximum; }
+    double mean() const { return total == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(total); }
+
+private:
+    static constexpr int SubBits = 4;
+    static constexpr size_t SubBuckets = size_t(1) << SubBits;
+    static constexpr size_t Buckets = 64 * SubBuckets;
+
+    // Los valores menores a 16 tienen un bucket cada uno, los demas se agrupan por potencia de 2
+    static size_t bucketFor(uint64_t value) {
+        if (value < SubBuckets) {
+            return static_cast<size_t>(value);
+        }
+        int exponent = std::bit_width(value) - 1;
+        uint64_t sub = (value >> (exponent - SubBits)) & (SubBuckets - 1);
+        return static_cast<size_t>(exponent - SubBits + 1) * SubBuckets + static_cast<size_t>(sub);
+    }
+
+    static uint64_t upperBound(size_t bucket) {
+        if (bucket < SubBuckets) {
+            return bucket;
+        }
+        int exponent = static_cast<int>(bucket / SubBuckets) + SubBits - 1;
+        uint64_t sub = bucket % SubBuckets;
+        uint64_t base = (uint64_t(1) << exponent) | (sub << (exponent - SubBits));
+        return base + (uint64_t(1) << (exponent - SubBits)) - 1;
+    }
+
+    std::array<uint64_t, Buckets> buckets{};
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    uint64_t maximum = 0;
+};
+
+/**
+ * Escribe un histograma como objeto JSON con sus percentiles en microsegundos
+ */
+inline void writeLatency(std::ostream& out, const LatencyHistogram& histogram) {
+    auto micros = [](uint64_t nanoseconds) { return static_cast<double>(nanoseconds) / 1000.0; };
+    out << "{\"count\": " << histogram.count()
+        << ", \"mean_us\": " << micros(static_cast<uint64_t>(histogram.mean()))
+        << ", \"p50_us\": " << micros(histogram.percentile(50))
+        << ", \"p99_us\": " << micros(histogram.percentile(99))
+        << ", \"p999_us\": " << micros(histogram.percentile(99.9))
+        << ", \"max_us\": " << micros(histogram.max()) << "}";
+}
+
+#endif
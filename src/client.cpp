@@ -1,23 +1,93 @@
 #include <iostream>
 #include <string>
-#include <deque>
+#include <map>
+#include <ctime>
+#include <cstdint>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include "protocol/message.h"  
 #include "protocol/chat.pb.h"    
+#include "client/conversation_store.h"
+#include "client/headless.h"
+#include "client/in_flight.h"
 
-std::deque<std::string> messages; // Cola para ir guardando los mensajes broadcast
+// Mensajes que se muestran por pagina al ver una conversacion
+constexpr size_t PageSize = 20;
+// Ultimos mensajes que se muestran de cada conversacion directa o canal en el resumen
+constexpr size_t PreviewSize = 5;
+
+ConversationStore conversations; // Mensajes broadcast, directos y de canales, acotados por conversacion
 std::atomic<bool> receivingResponse{true}; // Variable que detemina si se sigue recibiendo responses del servidor
-std::unordered_map<std::string, std::deque<std::string>> privateMessages; // Mapa para guardar los mensajes privados
-std::mutex messagesMutex; // Mutex para evitar problemas de concurrencia en la cola de mensajes
+std::mutex messagesMutex; // Mutex para evitar problemas de concurrencia en el estado compartido con el hilo receptor
 std::string currentStatus = "ONLINE"; // Variable para guardar el status actual del usuario
-std::string tempUserStatus = "";
-std::string tempMessage;
-std::string tempRecipient;
+std::string userName; // Nombre con el que se registro el cliente
+InFlightTable inFlight; // Requests enviados que esperan respuesta, por request_id
+std::chrono::seconds responseTimeout{10}; // Cuanto se espera una respuesta antes de avisar que no llego
+std::condition_variable unregisterDone; // Avisa al hilo principal que el hilo receptor ya no va a leer del socket
+bool unregistered = false; // Llego la respuesta de UNREGISTER_USER o se cerro la conexion, protegido por messagesMutex
+size_t compressAbove = 0; // Tamaño desde el que se comprimen los requests, 0 si el servidor no acepto compresion
+std::map<std::string, chat::UserStatus> presenceUsers; // Usuarios conectados segun los cambios de presencia del servidor
+uint64_t presenceVersion = 0; // Version de presencia que ya se aplico
+bool presenceStale = false; // Se perdieron cambios de presencia, hay que volver a suscribirse
+
+/**
+ * Aplica los cambios de presencia que empuja el servidor a la lista local de usuarios
+ *
+ * @param update Cambios recibidos
+ */
+void applyPresence(const chat::PresenceUpdate& update) {
+  std::lock_guard<std::mutex> lock(messagesMutex);
+  // Un snapshot reemplaza todo lo que se conocia
+  if (update.snapshot()) {
+    presenceUsers.clear();
+    presenceVersion = 0;
+  }
+  // Si faltan cambios anteriores la lista ya no es confiable hasta volver a suscribirse
+  if (update.from_version() > presenceVersion) {
+    presenceStale = true;
+    return;
+  }
+  for (const auto &event : update.events()) {
+    if (event.version() <= presenceVersion) {
+      continue;
+    }
+    if (event.change() == chat::PresenceChange::USER_LEFT) {
+      presenceUsers.erase(event.username());
+    } else {
+      presenceUsers[event.username()] = event.status();
+    }
+  }
+  presenceVersion = std::max(presenceVersion, update.version());
+  presenceStale = false;
+}
+
+/**
+ * Envia un request con el siguiente request_id y lo deja pendiente hasta su respuesta
+ *
+ * @param clientSocket Interger que posee el socket utilizado por nuestro cliente.
+ * @param request Request a enviar, se le asigna el request_id
+ * @param pending Datos que se necesitan al recibir la respuesta
+ */
+void sendTracked(int clientSocket, chat::Request& request, InFlightRequest pending = {}) {
+  pending.operation = request.operation();
+  request.set_request_id(inFlight.add(std::move(pending)));
+  sendMessage(clientSocket, request, compressAbove);
+}
+
+/**
+ * Avisa de los requests que pasaron su timeout sin respuesta
+ */
+void reportExpired() {
+  for (const auto& expired : inFlight.expire(InFlightTable::Clock::now())) {
+    std::cerr << "Request " << expired.id << " (" << chat::Operation_Name(expired.operation) << ") timed out\n";
+  }
+}
 
 /**
  * Escucha los responses del servidor
@@ -31,6 +101,17 @@ void messageReceiver(int clientSocket) {
     chat::Response response;
     // Si se recibe un mensaje del servidor
     if (receiveMessage(clientSocket, response)) {
+      reportExpired();
+      // Las respuestas a un request traen su id, los mensajes entrantes y avisos no
+      std::optional<InFlightRequest> answered;
+      if (response.has_request_id()) {
+        answered = inFlight.take(response.request_id());
+      }
+      // La respuesta al unregister es lo ultimo que se lee, el hilo principal la esta esperando
+      if (response.operation() == chat::Operation::UNREGISTER_USER) {
+        std::cout << "Servidor: " << response.message() << std::endl;
+        break;
+      }
       // Se verifica si el status code de la respuesta es diferente de OK
       if (response.status_code() != chat::StatusCode::OK) {
         // En caso de que no sea OK, se imprime un mensaje de error
@@ -42,28 +123,14 @@ void messageReceiver(int clientSocket) {
         if (response.operation() == chat::Operation::INCOMING_MESSAGE) {
           // Se verifica que si exista un mensaje entrante
           if (response.has_incoming_message()) {
-            // Se crea un string para guardar el mensaje
-            std::string message;
+            // Se guarda el mensaje en su conversacion, el texto se arma solo al mostrarlo
             const auto &mensaje = response.incoming_message();
-            // Se verifica si el mensaje es de tipo broadcast
-            if (mensaje.type() == chat::MessageType::BROADCAST){
-              // Se guarda el mensaje en la variable message, con el tag de broadcast
-              std::string type = "Broadcast";
-              message = "<" + type + ">" + " [" + mensaje.sender() + "]" + ": " + mensaje.content();
-              // Se guarda el mensaje en la cola de mensajes
-              {
-                std::lock_guard<std::mutex> lock(messagesMutex);
-                messages.push_back(message);
-              }
+            if (mensaje.type() == chat::MessageType::CHANNEL){
+              conversations.add(MessageKind::Channel, mensaje.channel(), mensaje.sender(), mensaje.content());
+            } else if (mensaje.type() == chat::MessageType::BROADCAST){
+              conversations.add(MessageKind::Broadcast, "", mensaje.sender(), mensaje.content());
             } else {
-              // Se guarda el mensaje en la variable message, con el tag de direct
-              std::string type = "Direct";
-              message = "<" + type + ">" + " [" + mensaje.sender() + "]" + ": " + mensaje.content();
-              // Se guarda el mensaje en el mapa de mensajes privados, utilizando un mutex lock para evitar problemas de concurrencia
-              {
-                std::lock_guard<std::mutex> lock(messagesMutex);
-                privateMessages[mensaje.sender()].push_back(message);
-              }
+              conversations.add(MessageKind::Direct, mensaje.sender(), mensaje.sender(), mensaje.content());
             }
           }
         } 
@@ -110,55 +177,161 @@ void messageReceiver(int clientSocket) {
           // Se imprime el mensaje del servidor
           {
             std::lock_guard<std::mutex> lock(messagesMutex);
-            if (tempUserStatus == ""){
-              if (currentStatus == "OFFLINE"){
-                currentStatus = "ONLINE";
-              } else {
-                currentStatus = "OFFLINE";
-              }
-            } else {
-              currentStatus = tempUserStatus;
-              tempUserStatus = "";
+            // La respuesta trae el status que quedo, tanto al cambio que pidio el usuario
+            // como a los avisos automaticos del servidor; un servidor viejo solo responde lo pedido
+            std::optional<chat::UserStatus> status;
+            if (response.has_new_status()) {
+              status = response.new_status();
+            } else if (answered) {
+              status = answered->status;
+            }
+            if (status == chat::UserStatus::ONLINE){
+              currentStatus = "ONLINE";
+            } else if (status == chat::UserStatus::BUSY){
+              currentStatus = "BUSY";
+            } else if (status == chat::UserStatus::OFFLINE){
+              currentStatus = "OFFLINE";
             }
           }
           std::cout << response.message() << "\n";
+        } else if (response.operation() == chat::Operation::JOIN_CHANNEL ||
+                   response.operation() == chat::Operation::LEAVE_CHANNEL) {
+          // Se imprime la confirmacion del canal
+          std::cout << response.message() << ": #" << response.channel().channel() << "\n";
+        } else if (response.operation() == chat::Operation::PRESENCE_UPDATE) {
+          // Se actualiza la lista local de usuarios
+          applyPresence(response.presence());
         } else if (response.operation() == chat::Operation::SEND_MESSAGE) {
-          {
-            std::lock_guard<std::mutex> lock(messagesMutex);
-            privateMessages[tempRecipient].push_back(tempMessage);
+          // El servidor acepto el mensaje directo, se guarda en la conversacion con el destinatario
+          if (answered && !answered->target.empty()) {
+            conversations.add(MessageKind::Direct, answered->target, userName, answered->content);
           }
         }
       }
+    } else {
+      // El servidor cerro la conexion, ya no hay nada que recibir
+      break;
+    }
+  }
+  receivingResponse = false;
+  {
+    std::lock_guard<std::mutex> lock(messagesMutex);
+    unregistered = true;
+  }
+  unregisterDone.notify_one();
+}
+
+/**
+ * Imprime un mensaje guardado con su hora, su tipo y su remitente
+ *
+ * @param message Mensaje a imprimir
+ * @param name Usuario o canal de la conversacion
+ */
+void printStoredMessage(const StoredMessage& message, const std::string& name) {
+  time_t seconds = static_cast<time_t>(message.time / 1000);
+  tm local{};
+  localtime_r(&seconds, &local);
+  char time[16];
+  strftime(time, sizeof(time), "%H:%M:%S", &local);
+
+  std::cout << "[" << time << "] ";
+  if (message.kind == MessageKind::Channel) {
+    std::cout << "<#" << name << ">";
+  } else if (message.kind == MessageKind::Broadcast) {
+    std::cout << "<Broadcast>";
+  } else {
+    std::cout << "<Direct>";
+  }
+  std::cout << " [" << message.sender << "]: " << message.content << "\n";
+}
+
+/**
+ * Muestra una conversacion por paginas, de los mensajes mas nuevos a los mas viejos
+ *
+ * @param kind Tipo de conversacion
+ * @param name Usuario o canal de la conversacion, vacio para broadcast
+ */
+void ConversationPager(MessageKind kind, const std::string& name) {
+  uint64_t before = UINT64_MAX;
+  while (true) {
+    // Solo se copia la pagina que se va a mostrar
+    ConversationStore::Page page = conversations.page(kind, name, before, PageSize);
+    for (const auto& message : page.messages) {
+      printStoredMessage(message, name);
+    }
+    if (page.messages.empty() || page.messages.front().sequence <= page.oldest) {
+      if (page.oldest > 0) {
+        std::cout << "(" << page.oldest << " mensajes anteriores ya se descartaron)" << "\n";
+      }
+      return;
+    }
+    before = page.messages.front().sequence;
+    std::cout << "(" << before - page.oldest << " mensajes anteriores) Ingrese m para verlos u otra tecla para volver: ";
+    std::string answer;
+    std::cin >> answer;
+    if (answer != "m") {
+      return;
     }
   }
 }
 
 /**
- * Imprime los mensajes de broadcast
+ * Imprime los ultimos mensajes de cada conversacion de un tipo
+ *
+ * @param kind Directos o canales
+ * @param label Como se presenta cada conversacion
+ */
+void ConversationsPrinter(MessageKind kind, const std::string& label) {
+  for (const auto& summary : conversations.conversations(kind)) {
+    std::cout << label << summary.name << " (" << summary.total << " mensajes): " << "\n";
+    for (const auto& message : conversations.page(kind, summary.name, UINT64_MAX, PreviewSize).messages) {
+      printStoredMessage(message, summary.name);
+    }
+    std::cout << "\n";
+  }
+}
+
+/**
+ * Imprime los mensajes de broadcast, por paginas
  */
 void BroadcastMessagesPrinter(){
   std::cout << "***********************************" << "\n";
   std::cout << "Broadcast Messages: " << "\n";
   std::cout << "***********************************" << "\n";
-  for (const auto& message : messages) {
-    std::cout << message << "\n";
-  }
+  ConversationPager(MessageKind::Broadcast, "");
   std::cout << "***********************************" << "\n\n";
 }
 
 /**
- * Imprime los mensajes directos
+ * Imprime los ultimos mensajes directos de cada conversacion y permite ver una completa
  */
 void DirectMessagesPrinter(){
   std::cout << "***********************************" << "\n";
   std::cout << "Direct Messages: " << "\n";
   std::cout << "***********************************" << "\n";
-  for (const auto& [sender, messages] : privateMessages) {
-    std::cout << "Chat con " << sender << ": " << "\n";
-    for (const auto& message : messages) {
-      std::cout << message << "\n";
-    }
-    std::cout << "\n";
+  ConversationsPrinter(MessageKind::Direct, "Chat con ");
+  std::cout << "Ingrese un usuario para ver su conversacion completa o - para volver: ";
+  std::string name;
+  std::cin >> name;
+  if (name != "-") {
+    ConversationPager(MessageKind::Direct, name);
+  }
+  std::cout << "***********************************" << "\n\n";
+}
+
+/**
+ * Imprime los ultimos mensajes de los canales y permite ver uno completo
+ */
+void ChannelMessagesPrinter(){
+  std::cout << "***********************************" << "\n";
+  std::cout << "Channel Messages: " << "\n";
+  std::cout << "***********************************" << "\n";
+  ConversationsPrinter(MessageKind::Channel, "Canal #");
+  std::cout << "Ingrese un canal para ver todos sus mensajes o - para volver: ";
+  std::string name;
+  std::cin >> name;
+  if (name != "-") {
+    ConversationPager(MessageKind::Channel, name);
   }
   std::cout << "***********************************" << "\n\n";
 }
@@ -170,8 +343,6 @@ void DirectMessagesPrinter(){
  * @param userName variable tipo string que posee el nombre de usuario de nuestro cliente.
  */
 void unregisterUser(int clientSocket, const std::string& userName) {
-  // Se desactiva la variable receivingResponse
-  receivingResponse = false;
   // Se crea un objeto de tipo chat::Request para enviar la solicitud al servidor
   chat::Request request;
   // Se establece la operacion de unregister user
@@ -181,12 +352,14 @@ void unregisterUser(int clientSocket, const std::string& userName) {
   unregisterUser->set_username(userName);
 
   // Se envia el request al servidor
-  sendMessage(clientSocket, request);
-
-  // Se espera el mensaje de respuesta del servidor
-  chat::Response response;
-  if (receiveMessage(clientSocket, response)){
-    std::cout << "Servidor: " << response.message() << std::endl;
+  sendTracked(clientSocket, request);
+
+  // Solo el hilo receptor lee del socket, se espera a que reciba la respuesta y termine
+  std::unique_lock<std::mutex> lock(messagesMutex);
+  if (!unregisterDone.wait_for(lock, responseTimeout, [] { return unregistered; })) {
+    std::cerr << "No response from the server to the unregister request\n";
+    // Se corta la conexion para que el hilo receptor deje de esperar datos
+    shutdown(clientSocket, SHUT_RDWR);
   }
 }
 
@@ -213,7 +386,7 @@ void sendMessageBroadcast(int clientSocket, const std::string& message) {
   newMensaje->set_content(mensaje);
 
   // Se envia el request al servidor
-  sendMessage(clientSocket, request);
+  sendTracked(clientSocket, request);
 }
 
 /**
@@ -244,28 +417,70 @@ void sendMessageDirect(int clientSocket, const std::string& userName) {
   // Se establece el destinatario del mensaje
   newMensaje->set_recipient(recipient);
 
-  // Se envia el request al servidor
-  sendMessage(clientSocket, request);
+  // El mensaje se guarda en la conversacion cuando el servidor lo confirma
+  InFlightRequest pending;
+  pending.target = recipient;
+  pending.content = mensaje;
 
-  // Se guarda el mensaje en el mapa de mensajes privados
-  std::string type = "Direct";
-  tempMessage = "<" + type + ">" + " [" + userName + "]" + ": " + mensaje;
-  tempRecipient = recipient;
+  // Se envia el request al servidor
+  sendTracked(clientSocket, request, std::move(pending));
 }
 
 /**
- * Hace el request al servidor para obtener la lista de usuarios
+ * Suscribe al cliente a los cambios de presencia del servidor
  *
  * @param clientSocket Interger que posee el socket utilizado por nuestro cliente.
+ * @param knownVersion Version que ya se tiene, 0 para recibir un snapshot completo
  */
-void requestUsersList(int clientSocket) {
-  // Se crea un objeto de tipo chat::Request para enviar la solicitud al servidor
+void subscribePresence(int clientSocket, uint64_t knownVersion) {
   chat::Request request;
-  request.set_operation(chat::Operation::GET_USERS);
-  auto *userList = request.mutable_get_users();
-  // No se coloca ningun username, por lo que se obtendran todos los usuarios
+  request.set_operation(chat::Operation::SUBSCRIBE_PRESENCE);
+  auto *presence = request.mutable_presence();
+  presence->set_subscribe(true);
+  // Con la version conocida el servidor solo manda lo que falta
+  if (knownVersion > 0) {
+    presence->set_known_version(knownVersion);
+  }
 
-  sendMessage(clientSocket, request);
+  sendTracked(clientSocket, request);
+}
+
+/**
+ * Imprime los usuarios conectados. La lista se mantiene con los cambios de
+ * presencia que empuja el servidor, no hace falta pedirla.
+ *
+ * @param clientSocket Interger que posee el socket utilizado por nuestro cliente.
+ */
+void UsersPrinter(int clientSocket) {
+  bool resync = false;
+  uint64_t knownVersion = 0;
+  {
+    std::lock_guard<std::mutex> lock(messagesMutex);
+    if (presenceStale) {
+      // Se perdieron cambios, se piden los que faltan y se muestra lo que se tiene
+      std::cout << "Presence list out of date, resyncing..." << "\n";
+      resync = true;
+      knownVersion = presenceVersion;
+    }
+  }
+  // El envio puede bloquear, se hace sin el lock para que el hilo receptor siga vaciando el socket
+  if (resync) {
+    subscribePresence(clientSocket, knownVersion);
+  }
+  std::lock_guard<std::mutex> lock(messagesMutex);
+  std::cout << "Connected users: " << "\n";
+  for (const auto& [username, status] : presenceUsers) {
+    std::string tempStatus;
+    if (status == chat::UserStatus::ONLINE){
+      tempStatus = "ONLINE";
+    } else if (status == chat::UserStatus::BUSY){
+      tempStatus = "BUSY";
+    } else {
+      tempStatus = "OFFLINE";
+    }
+    std::cout << "Username: " << username << "\n" << "Status: " << tempStatus << "\n";
+  }
+  std::cout << "\n";
 }
 
 /**
@@ -286,7 +501,7 @@ void requestUserInfo(int clientSocket) {
   // Se establece el nombre de usuario a buscar
   userInfo->set_username(userRequested);
 
-  sendMessage(clientSocket, request);
+  sendTracked(clientSocket, request);
 }
 
 /**
@@ -301,19 +516,66 @@ void changeStatus(int clientSocket, int status) {
   // Se establece la operacion de update status
   request.set_operation(chat::Operation::UPDATE_STATUS);
   auto *status_request = request.mutable_update_status();
-  // Se traduce la eleccion del usuario con el status del usuario
+  // Se traduce la eleccion del usuario con el status del usuario, el hilo receptor lo aplica al responderse
+  InFlightRequest pending;
   if (status == 0){
-    status_request->set_new_status(chat::UserStatus::ONLINE);
-    tempUserStatus = "ONLINE";
+    pending.status = chat::UserStatus::ONLINE;
   } else if (status == 1){
-    status_request->set_new_status(chat::UserStatus::BUSY);
-    tempUserStatus = "BUSY";
+    pending.status = chat::UserStatus::BUSY;
   } else {
-    status_request->set_new_status(chat::UserStatus::OFFLINE);
-    tempUserStatus = "OFFLINE";
+    pending.status = chat::UserStatus::OFFLINE;
   }
+  status_request->set_new_status(pending.status);
 
-  sendMessage(clientSocket, request);
+  sendTracked(clientSocket, request, std::move(pending));
+}
+
+/**
+ * Permite unirse a un canal, salir de el, enviarle un mensaje o ver sus mensajes
+ *
+ * @param clientSocket Interger que posee el socket utilizado por nuestro cliente.
+ */
+void manageChannels(int clientSocket) {
+  int option;
+  std::cout << "(1) Unirse a un canal" << "\n";
+  std::cout << "(2) Salir de un canal" << "\n";
+  std::cout << "(3) Enviar un mensaje a un canal" << "\n";
+  std::cout << "(4) Mostrar mensajes de los canales" << "\n";
+  std::cin >> option;
+  if (option == 4) {
+    ChannelMessagesPrinter();
+    return;
+  }
+  if (option < 1 || option > 3) {
+    std::cout << "Opción no válida" << "\n";
+    return;
+  }
+
+  // Se solicita el nombre del canal
+  std::string channel;
+  std::cout << "Enter channel name: ";
+  std::cin >> channel;
+
+  // Se crea un objeto de tipo chat::Request para enviar la solicitud al servidor
+  chat::Request request;
+  if (option == 1) {
+    request.set_operation(chat::Operation::JOIN_CHANNEL);
+    request.mutable_join_channel()->set_channel(channel);
+  } else if (option == 2) {
+    request.set_operation(chat::Operation::LEAVE_CHANNEL);
+    request.mutable_leave_channel()->set_channel(channel);
+  } else {
+    // Se solicita el mensaje, solo le llega a los suscriptores del canal
+    std::string mensaje;
+    std::cout << "Enter message: ";
+    std::cin.ignore();
+    std::getline(std::cin, mensaje);
+    request.set_operation(chat::Operation::SEND_MESSAGE);
+    request.mutable_send_message()->set_channel(channel);
+    request.mutable_send_message()->set_content(mensaje);
+  }
+
+  sendTracked(clientSocket, request);
 }
 
 /**
@@ -332,6 +594,7 @@ void printHelp(){
   std::cout << "Opción 7: Despliega el nombre, la dirección IP y el estado de un usuario en específico" << "\n";
   std::cout << "Opción 8: Permite desplegar el menu de ayuda que está visualizando actualmente" << "\n";
   std::cout << "Opción 9: Permite salir del servidor" << "\n";
+  std::cout << "Opción 10: Permite unirse o salir de canales, enviarles mensajes y ver sus mensajes" << "\n";
   std::cout << "*****************************************************************************************************************" << "\n";
 }
 
@@ -343,13 +606,43 @@ void printHelp(){
  */
 int main(int argc, char* argv[]) {
   // Verificar que se hayan pasado los argumentos correctos
-  if (argc != 4) {
-    std::cerr << "Usage: client <user_name> <server_ip> <server_port>\n";
+  size_t historyLimit = 500;
+  size_t conversationLimit = 100;
+  bool headless = false;
+  long requestTimeout = 10;
+  bool validOptions = argc >= 4;
+  for (int i = 4; i < argc && validOptions; i++) {
+    std::string arg = argv[i];
+    try {
+      if (arg.rfind("--history=", 0) == 0) {
+        historyLimit = std::stoul(arg.substr(10));
+      } else if (arg.rfind("--conversations=", 0) == 0) {
+        conversationLimit = std::stoul(arg.substr(16));
+      } else if (arg.rfind("--request-timeout=", 0) == 0) {
+        requestTimeout = std::stol(arg.substr(18));
+      } else if (arg == "--headless") {
+        headless = true;
+      } else {
+        validOptions = false;
+      }
+    } catch (const std::exception&) {
+      validOptions = false;
+    }
+  }
+  if (!validOptions || historyLimit == 0 || conversationLimit == 0 || requestTimeout <= 0) {
+    std::cerr << "Usage: client <user_name> <server_ip> <server_port> [options]\n"
+              << "  --history=<count>           Messages kept per conversation (default 500)\n"
+              << "  --conversations=<count>     Direct and channel conversations kept, the least recently active is dropped (default 100)\n"
+              << "  --request-timeout=<seconds> Seconds to wait for a response before reporting the request as timed out (default 10)\n"
+              << "  --headless                  No menus: read one command per line from stdin and write server events as JSON lines\n";
     return 1;
   }
+  conversations.setLimits(historyLimit, conversationLimit);
+  inFlight.setTimeout(std::chrono::seconds(requestTimeout));
+  responseTimeout = std::chrono::seconds(requestTimeout);
 
   // Extraer los argumentos de la linea de comando
-  std::string userName = argv[1];
+  userName = argv[1];
   std::string serverIP = argv[2];
   int serverPort = std::stoi(argv[3]);
 
@@ -374,6 +667,11 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  // Sin menus todo corre en un solo hilo, stdout queda solo para los eventos
+  if (headless) {
+    return runHeadless(clientSocket, userName, inFlight);
+  }
+
   std::cout << "Connected to the server\n";
 
   // Creamos un objeto de tipo chat::Request para enviar la solicitud al servidor
@@ -383,9 +681,11 @@ int main(int argc, char* argv[]) {
   auto *registerUser = request.mutable_register_user();
   // Establecemos el nombre de usuario
   registerUser->set_username(userName);
+  // Ofrecemos recibir los frames grandes comprimidos
+  registerUser->set_compression(chat::Compression::ZLIB);
 
   // Enviamos el request al servidor
-  sendMessage(clientSocket, request);
+  sendMessage(clientSocket, request, compressAbove);
 
   std::cout << "Request sent to the server\n";
 
@@ -413,10 +713,16 @@ int main(int argc, char* argv[]) {
   }
 
   std::cout << "Regreso del servidor: " << response.message() << "\n";
+  // Si el servidor acepto la compresion tambien se comprimen los requests grandes
+  if (response.compression() == chat::Compression::ZLIB) {
+    compressAbove = DefaultCompressionThreshold;
+  }
 
   // Se crea un hilo para recibir los mensajes del servidor
   std::thread receiver(messageReceiver, clientSocket);
-  receiver.detach();
+
+  // La lista de usuarios se recibe una vez y despues solo llegan los cambios
+  subscribePresence(clientSocket, 0);
 
   // Se crea un entero para guardar la eleccion del usuario
   int choice = 0;
@@ -424,7 +730,11 @@ int main(int argc, char* argv[]) {
   while (choice != 9)
   {
     // Se imprime el menu de opciones
-    std::cout << "Username: " << userName << "\nStatus: " << currentStatus << "\n";
+    reportExpired();
+    {
+      std::lock_guard<std::mutex> lock(messagesMutex);
+      std::cout << "Username: " << userName << "\nStatus: " << currentStatus << "\n";
+    }
     std::cout << "Ingrese un número basándose en las opciones siguientes" << "\n";
     std::cout << "(1) Chatear con todos los usuarios" << "\n";
     std::cout << "(2) Mostrar mensajes Broadcast" << "\n";
@@ -435,6 +745,7 @@ int main(int argc, char* argv[]) {
     std::cout << "(7) Desplegar información de un usuario en particular" << "\n";
     std::cout << "(8) Ayuda" << "\n";
     std::cout << "(9) Salir" << "\n";
+    std::cout << "(10) Canales" << "\n";
     std::cout << "Ingrese el número: \n";
     std::cin >> choice;
 
@@ -469,8 +780,8 @@ int main(int argc, char* argv[]) {
         changeStatus(clientSocket, status);
         break;
     case 6:
-        // En caso de que la eleccion sea 6, se solicita la lista de usuarios
-        requestUsersList(clientSocket);
+        // En caso de que la eleccion sea 6, se imprime la lista de usuarios
+        UsersPrinter(clientSocket);
         break;
     case 7:
         // En caso de que la eleccion sea 7, se solicita la informacion de un usuario en particular
@@ -484,6 +795,10 @@ int main(int argc, char* argv[]) {
         // En caso de que la eleccion sea 9, se desregistra al usuario
         unregisterUser(clientSocket, userName);
         break;
+    case 10:
+        // En caso de que la eleccion sea 10, se manejan los canales
+        manageChannels(clientSocket);
+        break;
     default:
         std::cout << "Opción no válida" << "\n";
         break;
@@ -0,0 +1,98 @@
+// conversation_store.cpp
+#include "./conversation_store.h"
+
+#include <algorithm>
+#include <chrono>
+
+void ConversationStore::setLimits(size_t messagesPerConversation, size_t maxConversations) {
+  std::lock_guard<std::mutex> lock(mutex);
+  this->messagesPerConversation = std::max<size_t>(messagesPerConversation, 1);
+  this->maxConversations = std::max<size_t>(maxConversations, 1);
+}
+
+std::string ConversationStore::key(MessageKind kind, const std::string& name) {
+  std::string result(1, static_cast<char>('0' + static_cast<int>(kind)));
+  result += name;
+  return result;
+}
+
+void ConversationStore::add(MessageKind kind, const std::string& name, const std::string& sender, const std::string& content) {
+  int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+  std::lock_guard<std::mutex> lock(mutex);
+  auto [it, inserted] = byKey.try_emplace(key(kind, name));
+  Conversation& conversation = it->second;
+  if (inserted) {
+    conversation.kind = kind;
+    conversation.name = name;
+    conversation.slots.reserve(std::min<size_t>(messagesPerConversation, 64));
+    // La conversacion de broadcast es una sola y nunca se descarta
+    if (kind != MessageKind::Broadcast) {
+      recentlyActive.push_front(&conversation);
+      conversation.recent = recentlyActive.begin();
+      // Con el maximo de conversaciones se descarta la que lleva mas tiempo sin mensajes
+      if (recentlyActive.size() > maxConversations) {
+        Conversation* oldest = recentlyActive.back();
+        recentlyActive.pop_back();
+        byKey.erase(key(oldest->kind, oldest->name));
+      }
+    }
+  } else if (kind != MessageKind::Broadcast) {
+    recentlyActive.splice(recentlyActive.begin(), recentlyActive, conversation.recent);
+  }
+
+  // El ring crece hasta su maximo y despues reutiliza el lugar del mensaje mas viejo
+  StoredMessage* slot;
+  if (conversation.slots.size() < messagesPerConversation) {
+    slot = &conversation.slots.emplace_back();
+    conversation.count++;
+  } else {
+    slot = &conversation.slots[conversation.head];
+    conversation.head = (conversation.head + 1) % conversation.slots.size();
+  }
+  slot->sequence = conversation.total++;
+  slot->time = now;
+  slot->sender.assign(sender);
+  slot->kind = kind;
+  slot->content.assign(content);
+}
+
+ConversationStore::Page ConversationStore::page(MessageKind kind, const std::string& name, uint64_t before, size_t limit) const {
+  Page result;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = byKey.find(key(kind, name));
+  if (it == byKey.end()) {
+    return result;
+  }
+  const Conversation& conversation = it->second;
+  result.total = conversation.total;
+  result.oldest = conversation.total - conversation.count;
+
+  // Solo se copian los mensajes de la pagina
+  uint64_t end = std::min(before, conversation.total);
+  if (end <= result.oldest) {
+    return result;
+  }
+  uint64_t begin = end - std::min<uint64_t>(limit, end - result.oldest);
+  result.messages.reserve(static_cast<size_t>(end - begin));
+  for (uint64_t sequence = begin; sequence < end; sequence++) {
+    size_t position = (conversation.head + static_cast<size_t>(sequence - result.oldest)) % conversation.slots.size();
+    result.messages.push_back(conversation.slots[position]);
+  }
+  return result;
+}
+
+std::vector<ConversationStore::Summary> ConversationStore::conversations(MessageKind kind) const {
+  std::vector<Summary> result;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& [key, conversation] : byKey) {
+      if (conversation.kind == kind) {
+        result.push_back({kind, conversation.name, conversation.total, conversation.count});
+      }
+    }
+  }
+  std::sort(result.begin(), result.end(), [](const Summary& a, const Summary& b) { return a.name < b.name; });
+  return result;
+}
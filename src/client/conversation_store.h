@@ -0,0 +1,111 @@
+// conversation_store.h
+#ifndef CONVERSATION_STORE_H
+#define CONVERSATION_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Tipo de conversacion a la que pertenece un mensaje
+enum class MessageKind : uint8_t {
+  Broadcast,
+  Direct,
+  Channel
+};
+
+// Un mensaje guardado. El remitente va en el mismo lugar del ring, al reutilizarlo se
+// sobreescribe y al descartar la conversacion se libera con ella
+struct StoredMessage {
+  uint64_t sequence = 0; // Posicion del mensaje dentro de su conversacion, empieza en 0
+  int64_t time = 0;      // Milisegundos desde epoch en que llego
+  std::string sender;
+  MessageKind kind = MessageKind::Broadcast;
+  std::string content;
+};
+
+/**
+ * Mensajes que recibio el cliente, separados por conversacion (broadcast, cada
+ * usuario con el que hay mensajes directos y cada canal). Cada conversacion es
+ * un ring con un maximo de mensajes y tambien hay un maximo de conversaciones
+ * directas y de canales: al pasarlo se descarta la que lleva mas tiempo sin
+ * mensajes. Asi un cliente que corre por mucho tiempo usa memoria acotada.
+ *
+ * El hilo que recibe agrega mensajes y el que imprime lee paginas; el lock solo
+ * se toma para agregar un mensaje o copiar una pagina.
+ */
+class ConversationStore {
+public:
+  // Mensajes de una pagina, del mas viejo al mas nuevo
+  struct Page {
+    std::vector<StoredMessage> messages;
+    uint64_t total = 0;    // Mensajes que llegaron a la conversacion, incluso los descartados
+    uint64_t oldest = 0;   // Secuencia del mensaje mas viejo que sigue guardado
+  };
+
+  // Resumen de una conversacion
+  struct Summary {
+    MessageKind kind;
+    std::string name;
+    uint64_t total;
+    size_t stored;
+  };
+
+  /**
+   * Define los maximos, se debe llamar antes de agregar mensajes
+   *
+   * @param messagesPerConversation Mensajes que se guardan de cada conversacion
+   * @param maxConversations Conversaciones directas y de canales que se guardan a la vez
+   */
+  void setLimits(size_t messagesPerConversation, size_t maxConversations);
+
+  /**
+   * Agrega un mensaje a su conversacion
+   *
+   * @param kind Tipo de conversacion
+   * @param name Usuario de la conversacion directa o nombre del canal, vacio para broadcast
+   * @param sender Usuario que envio el mensaje
+   * @param content Contenido del mensaje
+   */
+  void add(MessageKind kind, const std::string& name, const std::string& sender, const std::string& content);
+
+  /**
+   * Copia una pagina de una conversacion
+   *
+   * @param kind Tipo de conversacion
+   * @param name Nombre de la conversacion
+   * @param before Solo mensajes con secuencia menor a esta, UINT64_MAX para los ultimos
+   * @param limit Cantidad maxima de mensajes
+   */
+  Page page(MessageKind kind, const std::string& name, uint64_t before, size_t limit) const;
+
+  /**
+   * Conversaciones guardadas de un tipo, ordenadas por nombre
+   */
+  std::vector<Summary> conversations(MessageKind kind) const;
+
+private:
+  // Ring de mensajes de una conversacion
+  struct Conversation {
+    MessageKind kind;
+    std::string name;
+    std::vector<StoredMessage> slots;
+    size_t head = 0;     // Posicion del mensaje mas viejo
+    size_t count = 0;
+    uint64_t total = 0;
+    std::list<Conversation*>::iterator recent; // Posicion en la lista de actividad
+  };
+
+  static std::string key(MessageKind kind, const std::string& name);
+
+  size_t messagesPerConversation = 500;
+  size_t maxConversations = 100;
+  mutable std::mutex mutex;
+  std::unordered_map<std::string, Conversation> byKey;
+  std::list<Conversation*> recentlyActive; // Conversaciones de la mas reciente a la menos reciente
+};
+
+#endif
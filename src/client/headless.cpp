@@ -0,0 +1,447 @@
+// headless.cpp
+#include "./headless.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sstream>
+#include <unistd.h>
+#include <google/protobuf/util/json_util.h>
+#include "protocol/message.h"
+#include "protocol/chat.pb.h"
+
+// Si la cola de salida pasa de aqui se deja de leer stdin hasta que el socket la vacie
+constexpr size_t MaxPendingOutput = 1024 * 1024;
+
+/**
+ * Estado del cliente sin menus. Todo lo usa un solo hilo, no hace falta ningun lock.
+ */
+class HeadlessClient {
+public:
+  HeadlessClient(int clientSocket, const std::string& userName, InFlightTable& inFlight)
+    : clientSocket(clientSocket), userName(userName), inFlight(inFlight) {}
+
+  int run();
+
+private:
+  void send(const chat::Request& request);
+  void sendTracked(chat::Request& request, InFlightRequest pending);
+  void expireRequests();
+  int pollTimeout();
+  void handleLine(const std::string& line);
+  void handleFrame(std::string_view payload, uint8_t flags);
+  void handleResponse(const chat::Response& response);
+  void emitEvent(const std::string& event, const std::string& fields);
+  bool readSocket();
+  bool writeSocket();
+  void readInput();
+
+  int clientSocket;
+  std::string userName;
+  InFlightTable& inFlight;        // Requests que esperan respuesta, por request_id
+  size_t compressAbove = 0;       // Tamaño desde el que se comprimen los requests, 0 hasta que el servidor acepte
+  FrameBuffer inBuffer;           // Frames que llegan del servidor
+  std::string outBuffer;          // Requests serializados que faltan enviar
+  std::string inputBuffer;        // Lo leido de stdin que todavia no forma una linea
+  std::string events;             // Lineas JSON que faltan escribir en stdout
+  std::string expanded;           // Payload descomprimido, se reutiliza entre frames
+  bool registered = false;        // El servidor acepto el registro
+  bool inputOpen = true;
+  bool quitting = false;          // Ya se pidio desregistrarse, se sale al recibir la respuesta
+  bool done = false;
+  int exitCode = 0;
+  uint64_t presenceVersion = 0;   // Version de presencia recibida, para pedir solo lo que falte
+  uint64_t presenceResync = 0;    // request_id del resubscribe por cambios perdidos, 0 si no se espera ninguno
+};
+
+/**
+ * Escapa un texto para ponerlo entre comillas en JSON
+ */
+static std::string jsonString(std::string_view text) {
+  std::string out = "\"";
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+      out += escaped;
+    } else {
+      out += c;
+    }
+  }
+  out += '"';
+  return out;
+}
+
+void HeadlessClient::emitEvent(const std::string& event, const std::string& fields) {
+  events += "{\"event\":" + jsonString(event);
+  if (!fields.empty()) {
+    events += "," + fields;
+  }
+  events += "}\n";
+}
+
+void HeadlessClient::send(const chat::Request& request) {
+  if (!appendFrame(outBuffer, request, 0, compressAbove)) {
+    emitEvent("error", "\"message\":" + jsonString("Request too large"));
+  }
+}
+
+void HeadlessClient::sendTracked(chat::Request& request, InFlightRequest pending) {
+  pending.operation = request.operation();
+  uint64_t requested = pending.id;
+  uint64_t id = inFlight.add(std::move(pending));
+  if (id == 0) {
+    emitEvent("error", "\"request_id\":" + std::to_string(requested) + ",\"message\":" + jsonString("Request id already in flight"));
+    return;
+  }
+  request.set_request_id(id);
+  send(request);
+}
+
+void HeadlessClient::expireRequests() {
+  for (const auto& expired : inFlight.expire(InFlightTable::Clock::now())) {
+    emitEvent("timeout", "\"request_id\":" + std::to_string(expired.id) +
+              ",\"operation\":" + jsonString(chat::Operation_Name(expired.operation)));
+    // Sin respuesta al desregistro no queda nada que esperar
+    if (expired.operation == chat::Operation::UNREGISTER_USER) {
+      exitCode = 1;
+      done = true;
+    }
+    // El siguiente hueco en la presencia vuelve a pedir los cambios
+    if (expired.id == presenceResync) {
+      presenceResync = 0;
+    }
+  }
+}
+
+int HeadlessClient::pollTimeout() {
+  std::optional<InFlightTable::Clock::time_point> deadline = inFlight.nextDeadline();
+  if (!deadline) {
+    return -1;
+  }
+  auto wait = std::chrono::ceil<std::chrono::milliseconds>(*deadline - InFlightTable::Clock::now());
+  return static_cast<int>(std::max<int64_t>(wait.count(), 0));
+}
+
+void HeadlessClient::handleLine(const std::string& line) {
+  std::istringstream words(line);
+  std::string command;
+  words >> command;
+  if (command.empty()) {
+    return;
+  }
+  // Un @<id> antes del comando elige el request_id, si no se asigna el siguiente libre
+  InFlightRequest pending;
+  if (command[0] == '@') {
+    char* end = nullptr;
+    pending.id = strtoull(command.c_str() + 1, &end, 10);
+    if (pending.id == 0 || *end != '\0') {
+      emitEvent("error", "\"message\":" + jsonString("Invalid request id: " + command));
+      return;
+    }
+    command.clear();
+    words >> command;
+  }
+  // El resto de la linea despues de un espacio, para los textos de los mensajes
+  auto rest = [&words]() {
+    std::string text;
+    std::getline(words >> std::ws, text);
+    return text;
+  };
+
+  chat::Request request;
+  if (command == "say") {
+    request.set_operation(chat::Operation::SEND_MESSAGE);
+    request.mutable_send_message()->set_content(rest());
+  } else if (command == "dm") {
+    std::string recipient;
+    words >> recipient;
+    request.set_operation(chat::Operation::SEND_MESSAGE);
+    request.mutable_send_message()->set_recipient(recipient);
+    request.mutable_send_message()->set_content(rest());
+    pending.target = recipient;
+  } else if (command == "chan") {
+    std::string channel;
+    words >> channel;
+    request.set_operation(chat::Operation::SEND_MESSAGE);
+    request.mutable_send_message()->set_channel(channel);
+    request.mutable_send_message()->set_content(rest());
+    pending.target = channel;
+  } else if (command == "join" || command == "leave") {
+    std::string channel;
+    words >> channel;
+    pending.target = channel;
+    if (command == "join") {
+      request.set_operation(chat::Operation::JOIN_CHANNEL);
+      request.mutable_join_channel()->set_channel(channel);
+    } else {
+      request.set_operation(chat::Operation::LEAVE_CHANNEL);
+      request.mutable_leave_channel()->set_channel(channel);
+    }
+  } else if (command == "status") {
+    std::string status;
+    words >> status;
+    request.set_operation(chat::Operation::UPDATE_STATUS);
+    if (status == "online") {
+      request.mutable_update_status()->set_new_status(chat::UserStatus::ONLINE);
+    } else if (status == "busy") {
+      request.mutable_update_status()->set_new_status(chat::UserStatus::BUSY);
+    } else if (status == "offline") {
+      request.mutable_update_status()->set_new_status(chat::UserStatus::OFFLINE);
+    } else {
+      emitEvent("error", "\"message\":" + jsonString("Unknown status: " + status));
+      return;
+    }
+  } else if (command == "users") {
+    request.set_operation(chat::Operation::GET_USERS);
+    request.mutable_get_users();
+  } else if (command == "user") {
+    std::string username;
+    words >> username;
+    pending.target = username;
+    request.set_operation(chat::Operation::GET_USERS);
+    request.mutable_get_users()->set_username(username);
+  } else if (command == "presence") {
+    request.set_operation(chat::Operation::SUBSCRIBE_PRESENCE);
+    request.mutable_presence()->set_subscribe(true);
+  } else if (command == "history") {
+    request.set_operation(chat::Operation::GET_HISTORY);
+    uint64_t offset = 0;
+    if (words >> offset) {
+      request.mutable_get_history()->set_after_offset(offset);
+    } else {
+      request.mutable_get_history();
+    }
+  } else if (command == "stats") {
+    request.set_operation(chat::Operation::STATS);
+  } else if (command == "quit") {
+    inputOpen = false;
+    quitting = true;
+    request.set_operation(chat::Operation::UNREGISTER_USER);
+    request.mutable_unregister_user()->set_username(userName);
+  } else {
+    emitEvent("error", "\"message\":" + jsonString("Unknown command: " + command));
+    return;
+  }
+  sendTracked(request, std::move(pending));
+}
+
+void HeadlessClient::handleResponse(const chat::Response& response) {
+  // Una respuesta que llega despues de su timeout se escribe igual, ya no esta en la tabla
+  if (response.has_request_id()) {
+    inFlight.take(response.request_id());
+  }
+  if (response.operation() == chat::Operation::REGISTER_USER && response.status_code() == chat::StatusCode::OK) {
+    registered = true;
+    // Desde aqui tambien se comprimen los requests grandes
+    if (response.compression() == chat::Compression::ZLIB) {
+      compressAbove = DefaultCompressionThreshold;
+    }
+  }
+  // Los cambios que repone el resubscribe llegan justo despues de su respuesta
+  if (response.operation() == chat::Operation::SUBSCRIBE_PRESENCE && response.has_request_id() &&
+      response.request_id() == presenceResync) {
+    presenceResync = 0;
+  }
+  if (response.operation() == chat::Operation::PRESENCE_UPDATE) {
+    const chat::PresenceUpdate& update = response.presence();
+    if (update.snapshot()) {
+      presenceVersion = update.version();
+      presenceResync = 0;
+    } else if (presenceResync != 0) {
+      // Mientras se espera la resincronizacion los cambios sueltos no se aplican, ella los vuelve a traer
+      return;
+    } else if (update.from_version() > presenceVersion) {
+      // Se perdieron cambios, se piden los que faltan a partir de lo que se tiene y este no se entrega
+      chat::Request request;
+      request.set_operation(chat::Operation::SUBSCRIBE_PRESENCE);
+      request.mutable_presence()->set_subscribe(true);
+      request.mutable_presence()->set_known_version(presenceVersion);
+      sendTracked(request, {});
+      presenceResync = request.request_id();
+      return;
+    } else {
+      presenceVersion = std::max(presenceVersion, update.version());
+    }
+  }
+
+  static const google::protobuf::util::JsonPrintOptions options = [] {
+    google::protobuf::util::JsonPrintOptions options;
+    options.preserve_proto_field_names = true;
+    return options;
+  }();
+  std::string json;
+  google::protobuf::util::MessageToJsonString(response, &json, options);
+  emitEvent("response", "\"response\":" + json);
+
+  if (quitting && response.operation() == chat::Operation::UNREGISTER_USER) {
+    done = true;
+  }
+}
+
+void HeadlessClient::handleFrame(std::string_view payload, uint8_t flags) {
+  if (flags & FrameFlagCompressed) {
+    if (!decompressPayload(payload, expanded, MaxMessageSize)) {
+      emitEvent("error", "\"message\":" + jsonString("Invalid compressed frame"));
+      return;
+    }
+    payload = expanded;
+  }
+  if (flags & FrameFlagBatch) {
+    chat::ResponseBatch batch;
+    if (batch.ParseFromArray(payload.data(), payload.size())) {
+      for (const auto& response : batch.responses()) {
+        handleResponse(response);
+      }
+      return;
+    }
+  } else {
+    chat::Response response;
+    if (response.ParseFromArray(payload.data(), payload.size())) {
+      handleResponse(response);
+      return;
+    }
+  }
+  emitEvent("error", "\"message\":" + jsonString("Invalid response"));
+}
+
+bool HeadlessClient::readSocket() {
+  while (true) {
+    ssize_t bytes = inBuffer.readFrom(clientSocket);
+    if (bytes < 0 && errno == EINTR) {
+      continue;
+    }
+    if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return true;
+    }
+    if (bytes <= 0) {
+      return false;
+    }
+    std::string_view payload;
+    uint8_t flags = 0;
+    FrameBuffer::Status status;
+    while ((status = inBuffer.nextFrame(payload, flags)) == FrameBuffer::Status::Complete) {
+      handleFrame(payload, flags);
+    }
+    if (status == FrameBuffer::Status::Invalid) {
+      emitEvent("error", "\"message\":" + jsonString("Frame too large"));
+      return false;
+    }
+  }
+}
+
+bool HeadlessClient::writeSocket() {
+  while (!outBuffer.empty()) {
+    ssize_t bytes = ::send(clientSocket, outBuffer.data(), outBuffer.size(), MSG_NOSIGNAL);
+    if (bytes < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+    outBuffer.erase(0, static_cast<size_t>(bytes));
+  }
+  return true;
+}
+
+void HeadlessClient::readInput() {
+  char chunk[4096];
+  ssize_t bytes = read(STDIN_FILENO, chunk, sizeof(chunk));
+  if (bytes < 0) {
+    if (errno == EINTR || errno == EAGAIN) {
+      return;
+    }
+    bytes = 0;
+  }
+  if (bytes == 0) {
+    // Cerrar stdin es igual que quit, la ultima linea puede venir sin salto
+    if (!inputBuffer.empty()) {
+      handleLine(inputBuffer);
+      inputBuffer.clear();
+    }
+    if (!quitting) {
+      handleLine("quit");
+    }
+    inputOpen = false;
+    return;
+  }
+  inputBuffer.append(chunk, static_cast<size_t>(bytes));
+  size_t start = 0;
+  size_t end;
+  while (inputOpen && (end = inputBuffer.find('\n', start)) != std::string::npos) {
+    handleLine(inputBuffer.substr(start, end - start));
+    start = end + 1;
+  }
+  inputBuffer.erase(0, start);
+}
+
+int HeadlessClient::run() {
+  fcntl(clientSocket, F_SETFL, fcntl(clientSocket, F_GETFL) | O_NONBLOCK);
+
+  // El registro es el primer request, su respuesta llega como el primer evento
+  chat::Request request;
+  request.set_operation(chat::Operation::REGISTER_USER);
+  request.mutable_register_user()->set_username(userName);
+  request.mutable_register_user()->set_compression(chat::Compression::ZLIB);
+  sendTracked(request, {});
+
+  while (!done) {
+    pollfd fds[2] = {};
+    fds[0].fd = clientSocket;
+    fds[0].events = POLLIN | (outBuffer.empty() ? 0 : POLLOUT);
+    // Mientras la cola de salida este llena no se leen mas comandos
+    fds[1].fd = inputOpen && outBuffer.size() < MaxPendingOutput ? STDIN_FILENO : -1;
+    fds[1].events = POLLIN;
+    // Se despierta a tiempo para el request que vence primero
+    if (poll(fds, 2, pollTimeout()) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      perror("poll");
+      return 1;
+    }
+
+    if (fds[1].revents & (POLLIN | POLLHUP | POLLERR)) {
+      readInput();
+    }
+    if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+      if (!readSocket()) {
+        emitEvent("disconnected", "");
+        // Solo es una salida normal si se pidio y el registro habia funcionado
+        exitCode = quitting && registered ? 0 : 1;
+        done = true;
+      }
+    }
+    if (!done) {
+      expireRequests();
+    }
+    if (!done && !writeSocket()) {
+      emitEvent("disconnected", "");
+      exitCode = 1;
+      done = true;
+    }
+
+    // Los eventos de esta vuelta se escriben juntos
+    if (!events.empty()) {
+      fwrite(events.data(), 1, events.size(), stdout);
+      fflush(stdout);
+      events.clear();
+    }
+  }
+  return exitCode;
+}
+
+int runHeadless(int clientSocket, const std::string& userName, InFlightTable& inFlight) {
+  HeadlessClient client(clientSocket, userName, inFlight);
+  int exitCode = client.run();
+  close(clientSocket);
+  return exitCode;
+}
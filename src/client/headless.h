@@ -0,0 +1,37 @@
+// headless.h
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include <string>
+#include "client/in_flight.h"
+
+/**
+ * Corre el cliente sin menus, pensado para bots y scripts. Un solo hilo espera
+ * con poll() al socket y a stdin a la vez: cada linea de stdin es un comando y
+ * cada response del servidor se escribe en stdout como una linea JSON. El
+ * registro tambien se hace aqui, su respuesta es el primer evento.
+ *
+ * Comandos:
+ *   say <texto>                 Mensaje broadcast
+ *   dm <usuario> <texto>        Mensaje directo
+ *   join <canal>, leave <canal> Suscribirse o quitarse de un canal
+ *   chan <canal> <texto>        Mensaje a un canal
+ *   status <online|busy|offline>
+ *   users, user <usuario>       Lista de usuarios o informacion de uno
+ *   presence                    Suscribirse a los cambios de presencia
+ *   history [offset]            Mensajes anteriores, despues del offset si se indica
+ *   stats                       Metricas del servidor
+ *   quit                        Desregistrarse y salir, igual que cerrar stdin
+ *
+ * Cada request lleva un request_id que vuelve en su respuesta, asi se pueden
+ * enviar muchos sin esperar. Con @<id> antes del comando se elige el id; los
+ * que no se responden a tiempo se avisan con un evento timeout.
+ *
+ * @param clientSocket Socket ya conectado al servidor
+ * @param userName Usuario con el que se registra
+ * @param inFlight Tabla de requests pendientes, con el timeout ya configurado
+ * @return Codigo de salida del cliente
+ */
+int runHeadless(int clientSocket, const std::string& userName, InFlightTable& inFlight);
+
+#endif
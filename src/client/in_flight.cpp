@@ -0,0 +1,64 @@
+// in_flight.cpp
+#include "./in_flight.h"
+
+uint64_t InFlightTable::add(InFlightRequest request) {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (request.id == 0) {
+    // Los ids asignados se saltan los que el usuario ya eligio
+    while (pending.count(nextId) > 0) {
+      nextId++;
+    }
+    request.id = nextId++;
+  } else if (pending.count(request.id) > 0) {
+    return 0;
+  }
+  request.deadline = Clock::now() + timeout;
+  uint64_t id = request.id;
+  deadlines.emplace_back(request.deadline, id);
+  pending.emplace(id, std::move(request));
+  return id;
+}
+
+std::optional<InFlightRequest> InFlightTable::take(uint64_t id) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = pending.find(id);
+  if (it == pending.end()) {
+    return std::nullopt;
+  }
+  InFlightRequest request = std::move(it->second);
+  pending.erase(it);
+  return request;
+}
+
+std::vector<InFlightRequest> InFlightTable::expire(Clock::time_point now) {
+  std::vector<InFlightRequest> expired;
+  std::lock_guard<std::mutex> lock(mutex);
+  while (!deadlines.empty() && deadlines.front().first <= now) {
+    auto it = pending.find(deadlines.front().second);
+    // Un id reutilizado despues de responderse tiene un deadline posterior
+    if (it != pending.end() && it->second.deadline == deadlines.front().first) {
+      expired.push_back(std::move(it->second));
+      pending.erase(it);
+    }
+    deadlines.pop_front();
+  }
+  return expired;
+}
+
+std::optional<InFlightTable::Clock::time_point> InFlightTable::nextDeadline() {
+  std::lock_guard<std::mutex> lock(mutex);
+  // Los ids del frente que ya se respondieron no cuentan
+  while (!deadlines.empty()) {
+    auto it = pending.find(deadlines.front().second);
+    if (it != pending.end() && it->second.deadline == deadlines.front().first) {
+      return deadlines.front().first;
+    }
+    deadlines.pop_front();
+  }
+  return std::nullopt;
+}
+
+size_t InFlightTable::size() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return pending.size();
+}
@@ -0,0 +1,74 @@
+// in_flight.h
+#ifndef IN_FLIGHT_H
+#define IN_FLIGHT_H
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "protocol/chat.pb.h"
+
+// Un request enviado que todavia no tiene respuesta
+struct InFlightRequest {
+  uint64_t id = 0;
+  chat::Operation operation = chat::Operation::REGISTER_USER;
+  std::string target;   // Destinatario o canal, si el request tiene
+  std::string content;  // Contenido del mensaje, si el request tiene
+  chat::UserStatus status = chat::UserStatus::ONLINE; // Estado pedido en un UPDATE_STATUS
+  std::chrono::steady_clock::time_point deadline;
+};
+
+/**
+ * Requests enviados que esperan su respuesta, por request_id. Cada respuesta
+ * se asocia con su request por el id que devuelve el servidor, asi se pueden
+ * tener muchos requests pendientes a la vez. Los que pasan su timeout se
+ * sacan de la tabla para avisarle al usuario.
+ */
+class InFlightTable {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  void setTimeout(std::chrono::milliseconds timeout) { this->timeout = timeout; }
+
+  /**
+   * Agrega un request. Si no tiene id se le asigna el siguiente.
+   *
+   * @param request Request enviado, se le completa el id y el deadline
+   * @return Id del request, 0 si el id ya estaba pendiente
+   */
+  uint64_t add(InFlightRequest request);
+
+  /**
+   * Saca el request que responde una respuesta
+   *
+   * @return El request, o nada si ya se habia respondido, vencio o no es de la tabla
+   */
+  std::optional<InFlightRequest> take(uint64_t id);
+
+  /**
+   * Saca los requests que vencieron, en el orden en que se enviaron
+   */
+  std::vector<InFlightRequest> expire(Clock::time_point now);
+
+  /**
+   * Deadline del request pendiente que vence primero
+   */
+  std::optional<Clock::time_point> nextDeadline();
+
+  size_t size() const;
+
+private:
+  std::chrono::milliseconds timeout{10000};
+  uint64_t nextId = 1;
+  mutable std::mutex mutex; // El cliente con menus envia desde un hilo y recibe en otro
+  std::unordered_map<uint64_t, InFlightRequest> pending;
+  // Ids en orden de envio; con un solo timeout sus deadlines quedan ordenados.
+  // Los que ya se respondieron se quitan al llegar al frente.
+  std::deque<std::pair<Clock::time_point, uint64_t>> deadlines;
+};
+
+#endif
@@ -0,0 +1,7713 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: chat.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_chat_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_chat_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_chat_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_chat_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_chat_2eproto;
+namespace chat {
+class ChannelRequest;
+struct ChannelRequestDefaultTypeInternal;
+extern ChannelRequestDefaultTypeInternal _ChannelRequest_default_instance_;
+class ChannelResponse;
+struct ChannelResponseDefaultTypeInternal;
+extern ChannelResponseDefaultTypeInternal _ChannelResponse_default_instance_;
+class HistoryRequest;
+struct HistoryRequestDefaultTypeInternal;
+extern HistoryRequestDefaultTypeInternal _HistoryRequest_default_instance_;
+class HistoryResponse;
+struct HistoryResponseDefaultTypeInternal;
+extern HistoryResponseDefaultTypeInternal _HistoryResponse_default_instance_;
+class IncomingMessageResponse;
+struct IncomingMessageResponseDefaultTypeInternal;
+extern IncomingMessageResponseDefaultTypeInternal _IncomingMessageResponse_default_instance_;
+class NewUserRequest;
+struct NewUserRequestDefaultTypeInternal;
+extern NewUserRequestDefaultTypeInternal _NewUserRequest_default_instance_;
+class PresenceEvent;
+struct PresenceEventDefaultTypeInternal;
+extern PresenceEventDefaultTypeInternal _PresenceEvent_default_instance_;
+class PresenceRequest;
+struct PresenceRequestDefaultTypeInternal;
+extern PresenceRequestDefaultTypeInternal _PresenceRequest_default_instance_;
+class PresenceUpdate;
+struct PresenceUpdateDefaultTypeInternal;
+extern PresenceUpdateDefaultTypeInternal _PresenceUpdate_default_instance_;
+class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+class RequestBatch;
+struct RequestBatchDefaultTypeInternal;
+extern RequestBatchDefaultTypeInternal _RequestBatch_default_instance_;
+class Response;
+struct ResponseDefaultTypeInternal;
+extern ResponseDefaultTypeInternal _Response_default_instance_;
+class ResponseBatch;
+struct ResponseBatchDefaultTypeInternal;
+extern ResponseBatchDefaultTypeInternal _ResponseBatch_default_instance_;
+class SendMessageRequest;
+struct SendMessageRequestDefaultTypeInternal;
+extern SendMessageRequestDefaultTypeInternal _SendMessageRequest_default_instance_;
+class StatsCounter;
+struct StatsCounterDefaultTypeInternal;
+extern StatsCounterDefaultTypeInternal _StatsCounter_default_instance_;
+class StatsHistogram;
+struct StatsHistogramDefaultTypeInternal;
+extern StatsHistogramDefaultTypeInternal _StatsHistogram_default_instance_;
+class StatsResponse;
+struct StatsResponseDefaultTypeInternal;
+extern StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+class UpdateStatusRequest;
+struct UpdateStatusRequestDefaultTypeInternal;
+extern UpdateStatusRequestDefaultTypeInternal _UpdateStatusRequest_default_instance_;
+class User;
+struct UserDefaultTypeInternal;
+extern UserDefaultTypeInternal _User_default_instance_;
+class UserListRequest;
+struct UserListRequestDefaultTypeInternal;
+extern UserListRequestDefaultTypeInternal _UserListRequest_default_instance_;
+class UserListResponse;
+struct UserListResponseDefaultTypeInternal;
+extern UserListResponseDefaultTypeInternal _UserListResponse_default_instance_;
+}  // namespace chat
+PROTOBUF_NAMESPACE_OPEN
+template<> ::chat::ChannelRequest* Arena::CreateMaybeMessage<::chat::ChannelRequest>(Arena*);
+template<> ::chat::ChannelResponse* Arena::CreateMaybeMessage<::chat::ChannelResponse>(Arena*);
+template<> ::chat::HistoryRequest* Arena::CreateMaybeMessage<::chat::HistoryRequest>(Arena*);
+template<> ::chat::HistoryResponse* Arena::CreateMaybeMessage<::chat::HistoryResponse>(Arena*);
+template<> ::chat::IncomingMessageResponse* Arena::CreateMaybeMessage<::chat::IncomingMessageResponse>(Arena*);
+template<> ::chat::NewUserRequest* Arena::CreateMaybeMessage<::chat::NewUserRequest>(Arena*);
+template<> ::chat::PresenceEvent* Arena::CreateMaybeMessage<::chat::PresenceEvent>(Arena*);
+template<> ::chat::PresenceRequest* Arena::CreateMaybeMessage<::chat::PresenceRequest>(Arena*);
+template<> ::chat::PresenceUpdate* Arena::CreateMaybeMessage<::chat::PresenceUpdate>(Arena*);
+template<> ::chat::Request* Arena::CreateMaybeMessage<::chat::Request>(Arena*);
+template<> ::chat::RequestBatch* Arena::CreateMaybeMessage<::chat::RequestBatch>(Arena*);
+template<> ::chat::Response* Arena::CreateMaybeMessage<::chat::Response>(Arena*);
+template<> ::chat::ResponseBatch* Arena::CreateMaybeMessage<::chat::ResponseBatch>(Arena*);
+template<> ::chat::SendMessageRequest* Arena::CreateMaybeMessage<::chat::SendMessageRequest>(Arena*);
+template<> ::chat::StatsCounter* Arena::CreateMaybeMessage<::chat::StatsCounter>(Arena*);
+template<> ::chat::StatsHistogram* Arena::CreateMaybeMessage<::chat::StatsHistogram>(Arena*);
+template<> ::chat::StatsResponse* Arena::CreateMaybeMessage<::chat::StatsResponse>(Arena*);
+template<> ::chat::UpdateStatusRequest* Arena::CreateMaybeMessage<::chat::UpdateStatusRequest>(Arena*);
+template<> ::chat::User* Arena::CreateMaybeMessage<::chat::User>(Arena*);
+template<> ::chat::UserListRequest* Arena::CreateMaybeMessage<::chat::UserListRequest>(Arena*);
+template<> ::chat::UserListResponse* Arena::CreateMaybeMessage<::chat::UserListResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace chat {
+
+enum UserStatus : int {
+  ONLINE = 0,
+  BUSY = 1,
+  OFFLINE = 2,
+  UserStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool UserStatus_IsValid(int value);
+constexpr UserStatus UserStatus_MIN = ONLINE;
+constexpr UserStatus UserStatus_MAX = OFFLINE;
+constexpr int UserStatus_ARRAYSIZE = UserStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserStatus_descriptor();
+template<typename T>
+inline const std::string& UserStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, UserStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function UserStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    UserStatus_descriptor(), enum_t_value);
+}
+inline bool UserStatus_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserStatus>(
+    UserStatus_descriptor(), name, value);
+}
+enum Compression : int {
+  NO_COMPRESSION = 0,
+  ZLIB = 1,
+  Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Compression_IsValid(int value);
+constexpr Compression Compression_MIN = NO_COMPRESSION;
+constexpr Compression Compression_MAX = ZLIB;
+constexpr int Compression_ARRAYSIZE = Compression_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Compression_descriptor();
+template<typename T>
+inline const std::string& Compression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Compression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Compression_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Compression_descriptor(), enum_t_value);
+}
+inline bool Compression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Compression* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Compression>(
+    Compression_descriptor(), name, value);
+}
+enum MessageType : int {
+  BROADCAST = 0,
+  DIRECT = 1,
+  CHANNEL = 2,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MessageType_IsValid(int value);
+constexpr MessageType MessageType_MIN = BROADCAST;
+constexpr MessageType MessageType_MAX = CHANNEL;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
+}
+inline bool MessageType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
+    MessageType_descriptor(), name, value);
+}
+enum UserListType : int {
+  ALL = 0,
+  SINGLE = 1,
+  UserListType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserListType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool UserListType_IsValid(int value);
+constexpr UserListType UserListType_MIN = ALL;
+constexpr UserListType UserListType_MAX = SINGLE;
+constexpr int UserListType_ARRAYSIZE = UserListType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserListType_descriptor();
+template<typename T>
+inline const std::string& UserListType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, UserListType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function UserListType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    UserListType_descriptor(), enum_t_value);
+}
+inline bool UserListType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserListType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserListType>(
+    UserListType_descriptor(), name, value);
+}
+enum Operation : int {
+  REGISTER_USER = 0,
+  SEND_MESSAGE = 1,
+  UPDATE_STATUS = 2,
+  GET_USERS = 3,
+  UNREGISTER_USER = 4,
+  INCOMING_MESSAGE = 5,
+  GET_HISTORY = 6,
+  JOIN_CHANNEL = 7,
+  LEAVE_CHANNEL = 8,
+  SUBSCRIBE_PRESENCE = 9,
+  PRESENCE_UPDATE = 10,
+  STATS = 11,
+  Operation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Operation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Operation_IsValid(int value);
+constexpr Operation Operation_MIN = REGISTER_USER;
+constexpr Operation Operation_MAX = STATS;
+constexpr int Operation_ARRAYSIZE = Operation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_descriptor();
+template<typename T>
+inline const std::string& Operation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Operation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Operation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Operation_descriptor(), enum_t_value);
+}
+inline bool Operation_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Operation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Operation>(
+    Operation_descriptor(), name, value);
+}
+enum PresenceChange : int {
+  USER_JOINED = 0,
+  USER_LEFT = 1,
+  STATUS_CHANGED = 2,
+  PresenceChange_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PresenceChange_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PresenceChange_IsValid(int value);
+constexpr PresenceChange PresenceChange_MIN = USER_JOINED;
+constexpr PresenceChange PresenceChange_MAX = STATUS_CHANGED;
+constexpr int PresenceChange_ARRAYSIZE = PresenceChange_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PresenceChange_descriptor();
+template<typename T>
+inline const std::string& PresenceChange_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PresenceChange>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PresenceChange_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PresenceChange_descriptor(), enum_t_value);
+}
+inline bool PresenceChange_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PresenceChange* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PresenceChange>(
+    PresenceChange_descriptor(), name, value);
+}
+enum StatusCode : int {
+  UNKNOWN_STATUS = 0,
+  OK = 200,
+  BAD_REQUEST = 400,
+  INTERNAL_SERVER_ERROR = 500,
+  StatusCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StatusCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool StatusCode_IsValid(int value);
+constexpr StatusCode StatusCode_MIN = UNKNOWN_STATUS;
+constexpr StatusCode StatusCode_MAX = INTERNAL_SERVER_ERROR;
+constexpr int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor();
+template<typename T>
+inline const std::string& StatusCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StatusCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StatusCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StatusCode_descriptor(), enum_t_value);
+}
+inline bool StatusCode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatusCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatusCode>(
+    StatusCode_descriptor(), name, value);
+}
+// ===================================================================
+
+class User final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.User) */ {
+ public:
+  inline User() : User(nullptr) {}
+  ~User() override;
+  explicit PROTOBUF_CONSTEXPR User(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  User(const User& from);
+  User(User&& from) noexcept
+    : User() {
+    *this = ::std::move(from);
+  }
+
+  inline User& operator=(const User& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline User& operator=(User&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const User& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const User* internal_default_instance() {
+    return reinterpret_cast<const User*>(
+               &_User_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(User& a, User& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(User* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(User* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<User>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const User& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const User& from) {
+    User::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(User* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.User";
+  }
+  protected:
+  explicit User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kStatusFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // .chat.UserStatus status = 2;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.User)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NewUserRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.NewUserRequest) */ {
+ public:
+  inline NewUserRequest() : NewUserRequest(nullptr) {}
+  ~NewUserRequest() override;
+  explicit PROTOBUF_CONSTEXPR NewUserRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NewUserRequest(const NewUserRequest& from);
+  NewUserRequest(NewUserRequest&& from) noexcept
+    : NewUserRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline NewUserRequest& operator=(const NewUserRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NewUserRequest& operator=(NewUserRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NewUserRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NewUserRequest* internal_default_instance() {
+    return reinterpret_cast<const NewUserRequest*>(
+               &_NewUserRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(NewUserRequest& a, NewUserRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NewUserRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NewUserRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NewUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NewUserRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NewUserRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NewUserRequest& from) {
+    NewUserRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NewUserRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.NewUserRequest";
+  }
+  protected:
+  explicit NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kResumeAfterFieldNumber = 2,
+    kCompressionFieldNumber = 3,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // optional uint64 resume_after = 2;
+  bool has_resume_after() const;
+  private:
+  bool _internal_has_resume_after() const;
+  public:
+  void clear_resume_after();
+  uint64_t resume_after() const;
+  void set_resume_after(uint64_t value);
+  private:
+  uint64_t _internal_resume_after() const;
+  void _internal_set_resume_after(uint64_t value);
+  public:
+
+  // .chat.Compression compression = 3;
+  void clear_compression();
+  ::chat::Compression compression() const;
+  void set_compression(::chat::Compression value);
+  private:
+  ::chat::Compression _internal_compression() const;
+  void _internal_set_compression(::chat::Compression value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.NewUserRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint64_t resume_after_;
+    int compression_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendMessageRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.SendMessageRequest) */ {
+ public:
+  inline SendMessageRequest() : SendMessageRequest(nullptr) {}
+  ~SendMessageRequest() override;
+  explicit PROTOBUF_CONSTEXPR SendMessageRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendMessageRequest(const SendMessageRequest& from);
+  SendMessageRequest(SendMessageRequest&& from) noexcept
+    : SendMessageRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SendMessageRequest& operator=(const SendMessageRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendMessageRequest& operator=(SendMessageRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendMessageRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendMessageRequest* internal_default_instance() {
+    return reinterpret_cast<const SendMessageRequest*>(
+               &_SendMessageRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SendMessageRequest& a, SendMessageRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendMessageRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendMessageRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendMessageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendMessageRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendMessageRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendMessageRequest& from) {
+    SendMessageRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendMessageRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.SendMessageRequest";
+  }
+  protected:
+  explicit SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRecipientFieldNumber = 1,
+    kContentFieldNumber = 2,
+    kChannelFieldNumber = 3,
+  };
+  // string recipient = 1;
+  void clear_recipient();
+  const std::string& recipient() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_recipient(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* recipient);
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(const std::string& value);
+  std::string* _internal_mutable_recipient();
+  public:
+
+  // string content = 2;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // string channel = 3;
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.SendMessageRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IncomingMessageResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.IncomingMessageResponse) */ {
+ public:
+  inline IncomingMessageResponse() : IncomingMessageResponse(nullptr) {}
+  ~IncomingMessageResponse() override;
+  explicit PROTOBUF_CONSTEXPR IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IncomingMessageResponse(const IncomingMessageResponse& from);
+  IncomingMessageResponse(IncomingMessageResponse&& from) noexcept
+    : IncomingMessageResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline IncomingMessageResponse& operator=(const IncomingMessageResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IncomingMessageResponse& operator=(IncomingMessageResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IncomingMessageResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IncomingMessageResponse* internal_default_instance() {
+    return reinterpret_cast<const IncomingMessageResponse*>(
+               &_IncomingMessageResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(IncomingMessageResponse& a, IncomingMessageResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IncomingMessageResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IncomingMessageResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IncomingMessageResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IncomingMessageResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IncomingMessageResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IncomingMessageResponse& from) {
+    IncomingMessageResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IncomingMessageResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.IncomingMessageResponse";
+  }
+  protected:
+  explicit IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSenderFieldNumber = 1,
+    kContentFieldNumber = 2,
+    kChannelFieldNumber = 5,
+    kOffsetFieldNumber = 4,
+    kTypeFieldNumber = 3,
+  };
+  // string sender = 1;
+  void clear_sender();
+  const std::string& sender() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
+  void set_allocated_sender(std::string* sender);
+  private:
+  const std::string& _internal_sender() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
+  std::string* _internal_mutable_sender();
+  public:
+
+  // string content = 2;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // string channel = 5;
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // uint64 offset = 4;
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // .chat.MessageType type = 3;
+  void clear_type();
+  ::chat::MessageType type() const;
+  void set_type(::chat::MessageType value);
+  private:
+  ::chat::MessageType _internal_type() const;
+  void _internal_set_type(::chat::MessageType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.IncomingMessageResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    uint64_t offset_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UserListRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListRequest) */ {
+ public:
+  inline UserListRequest() : UserListRequest(nullptr) {}
+  ~UserListRequest() override;
+  explicit PROTOBUF_CONSTEXPR UserListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UserListRequest(const UserListRequest& from);
+  UserListRequest(UserListRequest&& from) noexcept
+    : UserListRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UserListRequest& operator=(const UserListRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UserListRequest& operator=(UserListRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserListRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserListRequest* internal_default_instance() {
+    return reinterpret_cast<const UserListRequest*>(
+               &_UserListRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(UserListRequest& a, UserListRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserListRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserListRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UserListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserListRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserListRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserListRequest& from) {
+    UserListRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UserListRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UserListRequest";
+  }
+  protected:
+  explicit UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kCursorFieldNumber = 3,
+    kPrefixFieldNumber = 4,
+    kPageSizeFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string cursor = 3;
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
+  // string prefix = 4;
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // uint32 page_size = 2;
+  void clear_page_size();
+  uint32_t page_size() const;
+  void set_page_size(uint32_t value);
+  private:
+  uint32_t _internal_page_size() const;
+  void _internal_set_page_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UserListRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    uint32_t page_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UserListResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListResponse) */ {
+ public:
+  inline UserListResponse() : UserListResponse(nullptr) {}
+  ~UserListResponse() override;
+  explicit PROTOBUF_CONSTEXPR UserListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UserListResponse(const UserListResponse& from);
+  UserListResponse(UserListResponse&& from) noexcept
+    : UserListResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline UserListResponse& operator=(const UserListResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UserListResponse& operator=(UserListResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserListResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserListResponse* internal_default_instance() {
+    return reinterpret_cast<const UserListResponse*>(
+               &_UserListResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(UserListResponse& a, UserListResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserListResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserListResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UserListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserListResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserListResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserListResponse& from) {
+    UserListResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UserListResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UserListResponse";
+  }
+  protected:
+  explicit UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsersFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kVersionFieldNumber = 4,
+    kTypeFieldNumber = 2,
+  };
+  // repeated .chat.User users = 1;
+  int users_size() const;
+  private:
+  int _internal_users_size() const;
+  public:
+  void clear_users();
+  ::chat::User* mutable_users(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+      mutable_users();
+  private:
+  const ::chat::User& _internal_users(int index) const;
+  ::chat::User* _internal_add_users();
+  public:
+  const ::chat::User& users(int index) const;
+  ::chat::User* add_users();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+      users() const;
+
+  // string next_cursor = 3;
+  void clear_next_cursor();
+  const std::string& next_cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next_cursor();
+  PROTOBUF_NODISCARD std::string* release_next_cursor();
+  void set_allocated_next_cursor(std::string* next_cursor);
+  private:
+  const std::string& _internal_next_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next_cursor(const std::string& value);
+  std::string* _internal_mutable_next_cursor();
+  public:
+
+  // uint64 version = 4;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // .chat.UserListType type = 2;
+  void clear_type();
+  ::chat::UserListType type() const;
+  void set_type(::chat::UserListType value);
+  private:
+  ::chat::UserListType _internal_type() const;
+  void _internal_set_type(::chat::UserListType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UserListResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User > users_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_cursor_;
+    uint64_t version_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UpdateStatusRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UpdateStatusRequest) */ {
+ public:
+  inline UpdateStatusRequest() : UpdateStatusRequest(nullptr) {}
+  ~UpdateStatusRequest() override;
+  explicit PROTOBUF_CONSTEXPR UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UpdateStatusRequest(const UpdateStatusRequest& from);
+  UpdateStatusRequest(UpdateStatusRequest&& from) noexcept
+    : UpdateStatusRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UpdateStatusRequest& operator=(const UpdateStatusRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpdateStatusRequest& operator=(UpdateStatusRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateStatusRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpdateStatusRequest* internal_default_instance() {
+    return reinterpret_cast<const UpdateStatusRequest*>(
+               &_UpdateStatusRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(UpdateStatusRequest& a, UpdateStatusRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UpdateStatusRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateStatusRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UpdateStatusRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateStatusRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpdateStatusRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateStatusRequest& from) {
+    UpdateStatusRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UpdateStatusRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UpdateStatusRequest";
+  }
+  protected:
+  explicit UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kNewStatusFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // .chat.UserStatus new_status = 2;
+  void clear_new_status();
+  ::chat::UserStatus new_status() const;
+  void set_new_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_new_status() const;
+  void _internal_set_new_status(::chat::UserStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UpdateStatusRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int new_status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChannelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChannelRequest) */ {
+ public:
+  inline ChannelRequest() : ChannelRequest(nullptr) {}
+  ~ChannelRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChannelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChannelRequest(const ChannelRequest& from);
+  ChannelRequest(ChannelRequest&& from) noexcept
+    : ChannelRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ChannelRequest& operator=(const ChannelRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChannelRequest& operator=(ChannelRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelRequest* internal_default_instance() {
+    return reinterpret_cast<const ChannelRequest*>(
+               &_ChannelRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ChannelRequest& a, ChannelRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChannelRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChannelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelRequest& from) {
+    ChannelRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChannelRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ChannelRequest";
+  }
+  protected:
+  explicit ChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 1,
+  };
+  // string channel = 1;
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ChannelRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChannelResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ChannelResponse) */ {
+ public:
+  inline ChannelResponse() : ChannelResponse(nullptr) {}
+  ~ChannelResponse() override;
+  explicit PROTOBUF_CONSTEXPR ChannelResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChannelResponse(const ChannelResponse& from);
+  ChannelResponse(ChannelResponse&& from) noexcept
+    : ChannelResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ChannelResponse& operator=(const ChannelResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChannelResponse& operator=(ChannelResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChannelResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChannelResponse* internal_default_instance() {
+    return reinterpret_cast<const ChannelResponse*>(
+               &_ChannelResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ChannelResponse& a, ChannelResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChannelResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChannelResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChannelResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChannelResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChannelResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChannelResponse& from) {
+    ChannelResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChannelResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ChannelResponse";
+  }
+  protected:
+  explicit ChannelResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 1,
+  };
+  // string channel = 1;
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ChannelResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceRequest) */ {
+ public:
+  inline PresenceRequest() : PresenceRequest(nullptr) {}
+  ~PresenceRequest() override;
+  explicit PROTOBUF_CONSTEXPR PresenceRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceRequest(const PresenceRequest& from);
+  PresenceRequest(PresenceRequest&& from) noexcept
+    : PresenceRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceRequest& operator=(const PresenceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceRequest& operator=(PresenceRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceRequest* internal_default_instance() {
+    return reinterpret_cast<const PresenceRequest*>(
+               &_PresenceRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PresenceRequest& a, PresenceRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceRequest& from) {
+    PresenceRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceRequest";
+  }
+  protected:
+  explicit PresenceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKnownVersionFieldNumber = 2,
+    kSubscribeFieldNumber = 1,
+  };
+  // optional uint64 known_version = 2;
+  bool has_known_version() const;
+  private:
+  bool _internal_has_known_version() const;
+  public:
+  void clear_known_version();
+  uint64_t known_version() const;
+  void set_known_version(uint64_t value);
+  private:
+  uint64_t _internal_known_version() const;
+  void _internal_set_known_version(uint64_t value);
+  public:
+
+  // bool subscribe = 1;
+  void clear_subscribe();
+  bool subscribe() const;
+  void set_subscribe(bool value);
+  private:
+  bool _internal_subscribe() const;
+  void _internal_set_subscribe(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t known_version_;
+    bool subscribe_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceEvent) */ {
+ public:
+  inline PresenceEvent() : PresenceEvent(nullptr) {}
+  ~PresenceEvent() override;
+  explicit PROTOBUF_CONSTEXPR PresenceEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceEvent(const PresenceEvent& from);
+  PresenceEvent(PresenceEvent&& from) noexcept
+    : PresenceEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceEvent& operator=(const PresenceEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceEvent& operator=(PresenceEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceEvent* internal_default_instance() {
+    return reinterpret_cast<const PresenceEvent*>(
+               &_PresenceEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(PresenceEvent& a, PresenceEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceEvent& from) {
+    PresenceEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceEvent";
+  }
+  protected:
+  explicit PresenceEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 2,
+    kVersionFieldNumber = 1,
+    kChangeFieldNumber = 3,
+    kStatusFieldNumber = 4,
+  };
+  // string username = 2;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // uint64 version = 1;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // .chat.PresenceChange change = 3;
+  void clear_change();
+  ::chat::PresenceChange change() const;
+  void set_change(::chat::PresenceChange value);
+  private:
+  ::chat::PresenceChange _internal_change() const;
+  void _internal_set_change(::chat::PresenceChange value);
+  public:
+
+  // .chat.UserStatus status = 4;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint64_t version_;
+    int change_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceUpdate) */ {
+ public:
+  inline PresenceUpdate() : PresenceUpdate(nullptr) {}
+  ~PresenceUpdate() override;
+  explicit PROTOBUF_CONSTEXPR PresenceUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceUpdate(const PresenceUpdate& from);
+  PresenceUpdate(PresenceUpdate&& from) noexcept
+    : PresenceUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceUpdate& operator=(const PresenceUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceUpdate& operator=(PresenceUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceUpdate* internal_default_instance() {
+    return reinterpret_cast<const PresenceUpdate*>(
+               &_PresenceUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(PresenceUpdate& a, PresenceUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceUpdate& from) {
+    PresenceUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceUpdate";
+  }
+  protected:
+  explicit PresenceUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 4,
+    kFromVersionFieldNumber = 1,
+    kVersionFieldNumber = 2,
+    kSnapshotFieldNumber = 3,
+  };
+  // repeated .chat.PresenceEvent events = 4;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::chat::PresenceEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent >*
+      mutable_events();
+  private:
+  const ::chat::PresenceEvent& _internal_events(int index) const;
+  ::chat::PresenceEvent* _internal_add_events();
+  public:
+  const ::chat::PresenceEvent& events(int index) const;
+  ::chat::PresenceEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent >&
+      events() const;
+
+  // uint64 from_version = 1;
+  void clear_from_version();
+  uint64_t from_version() const;
+  void set_from_version(uint64_t value);
+  private:
+  uint64_t _internal_from_version() const;
+  void _internal_set_from_version(uint64_t value);
+  public:
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // bool snapshot = 3;
+  void clear_snapshot();
+  bool snapshot() const;
+  void set_snapshot(bool value);
+  private:
+  bool _internal_snapshot() const;
+  void _internal_set_snapshot(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent > events_;
+    uint64_t from_version_;
+    uint64_t version_;
+    bool snapshot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsCounter final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.StatsCounter) */ {
+ public:
+  inline StatsCounter() : StatsCounter(nullptr) {}
+  ~StatsCounter() override;
+  explicit PROTOBUF_CONSTEXPR StatsCounter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsCounter(const StatsCounter& from);
+  StatsCounter(StatsCounter&& from) noexcept
+    : StatsCounter() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsCounter& operator=(const StatsCounter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsCounter& operator=(StatsCounter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsCounter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsCounter* internal_default_instance() {
+    return reinterpret_cast<const StatsCounter*>(
+               &_StatsCounter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(StatsCounter& a, StatsCounter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsCounter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsCounter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsCounter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsCounter>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsCounter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsCounter& from) {
+    StatsCounter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsCounter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.StatsCounter";
+  }
+  protected:
+  explicit StatsCounter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 value = 2;
+  void clear_value();
+  uint64_t value() const;
+  void set_value(uint64_t value);
+  private:
+  uint64_t _internal_value() const;
+  void _internal_set_value(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.StatsCounter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsHistogram final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.StatsHistogram) */ {
+ public:
+  inline StatsHistogram() : StatsHistogram(nullptr) {}
+  ~StatsHistogram() override;
+  explicit PROTOBUF_CONSTEXPR StatsHistogram(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsHistogram(const StatsHistogram& from);
+  StatsHistogram(StatsHistogram&& from) noexcept
+    : StatsHistogram() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsHistogram& operator=(const StatsHistogram& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsHistogram& operator=(StatsHistogram&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsHistogram& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsHistogram* internal_default_instance() {
+    return reinterpret_cast<const StatsHistogram*>(
+               &_StatsHistogram_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(StatsHistogram& a, StatsHistogram& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsHistogram* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsHistogram* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsHistogram* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsHistogram>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsHistogram& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsHistogram& from) {
+    StatsHistogram::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsHistogram* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.StatsHistogram";
+  }
+  protected:
+  explicit StatsHistogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kSumFieldNumber = 3,
+    kP50FieldNumber = 4,
+    kP90FieldNumber = 5,
+    kP99FieldNumber = 6,
+    kP999FieldNumber = 7,
+    kMaxFieldNumber = 8,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 sum = 3;
+  void clear_sum();
+  uint64_t sum() const;
+  void set_sum(uint64_t value);
+  private:
+  uint64_t _internal_sum() const;
+  void _internal_set_sum(uint64_t value);
+  public:
+
+  // uint64 p50 = 4;
+  void clear_p50();
+  uint64_t p50() const;
+  void set_p50(uint64_t value);
+  private:
+  uint64_t _internal_p50() const;
+  void _internal_set_p50(uint64_t value);
+  public:
+
+  // uint64 p90 = 5;
+  void clear_p90();
+  uint64_t p90() const;
+  void set_p90(uint64_t value);
+  private:
+  uint64_t _internal_p90() const;
+  void _internal_set_p90(uint64_t value);
+  public:
+
+  // uint64 p99 = 6;
+  void clear_p99();
+  uint64_t p99() const;
+  void set_p99(uint64_t value);
+  private:
+  uint64_t _internal_p99() const;
+  void _internal_set_p99(uint64_t value);
+  public:
+
+  // uint64 p999 = 7;
+  void clear_p999();
+  uint64_t p999() const;
+  void set_p999(uint64_t value);
+  private:
+  uint64_t _internal_p999() const;
+  void _internal_set_p999(uint64_t value);
+  public:
+
+  // uint64 max = 8;
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.StatsHistogram)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t count_;
+    uint64_t sum_;
+    uint64_t p50_;
+    uint64_t p90_;
+    uint64_t p99_;
+    uint64_t p999_;
+    uint64_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.StatsResponse) */ {
+ public:
+  inline StatsResponse() : StatsResponse(nullptr) {}
+  ~StatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR StatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsResponse(const StatsResponse& from);
+  StatsResponse(StatsResponse&& from) noexcept
+    : StatsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsResponse& operator=(const StatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsResponse& operator=(StatsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsResponse* internal_default_instance() {
+    return reinterpret_cast<const StatsResponse*>(
+               &_StatsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(StatsResponse& a, StatsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsResponse& from) {
+    StatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.StatsResponse";
+  }
+  protected:
+  explicit StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountersFieldNumber = 1,
+    kHistogramsFieldNumber = 2,
+  };
+  // repeated .chat.StatsCounter counters = 1;
+  int counters_size() const;
+  private:
+  int _internal_counters_size() const;
+  public:
+  void clear_counters();
+  ::chat::StatsCounter* mutable_counters(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsCounter >*
+      mutable_counters();
+  private:
+  const ::chat::StatsCounter& _internal_counters(int index) const;
+  ::chat::StatsCounter* _internal_add_counters();
+  public:
+  const ::chat::StatsCounter& counters(int index) const;
+  ::chat::StatsCounter* add_counters();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsCounter >&
+      counters() const;
+
+  // repeated .chat.StatsHistogram histograms = 2;
+  int histograms_size() const;
+  private:
+  int _internal_histograms_size() const;
+  public:
+  void clear_histograms();
+  ::chat::StatsHistogram* mutable_histograms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsHistogram >*
+      mutable_histograms();
+  private:
+  const ::chat::StatsHistogram& _internal_histograms(int index) const;
+  ::chat::StatsHistogram* _internal_add_histograms();
+  public:
+  const ::chat::StatsHistogram& histograms(int index) const;
+  ::chat::StatsHistogram* add_histograms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsHistogram >&
+      histograms() const;
+
+  // @@protoc_insertion_point(class_scope:chat.StatsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsCounter > counters_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsHistogram > histograms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HistoryRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.HistoryRequest) */ {
+ public:
+  inline HistoryRequest() : HistoryRequest(nullptr) {}
+  ~HistoryRequest() override;
+  explicit PROTOBUF_CONSTEXPR HistoryRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HistoryRequest(const HistoryRequest& from);
+  HistoryRequest(HistoryRequest&& from) noexcept
+    : HistoryRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline HistoryRequest& operator=(const HistoryRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HistoryRequest& operator=(HistoryRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HistoryRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HistoryRequest* internal_default_instance() {
+    return reinterpret_cast<const HistoryRequest*>(
+               &_HistoryRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(HistoryRequest& a, HistoryRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HistoryRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HistoryRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HistoryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HistoryRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HistoryRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HistoryRequest& from) {
+    HistoryRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HistoryRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.HistoryRequest";
+  }
+  protected:
+  explicit HistoryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAfterOffsetFieldNumber = 2,
+    kLimitFieldNumber = 1,
+  };
+  // optional uint64 after_offset = 2;
+  bool has_after_offset() const;
+  private:
+  bool _internal_has_after_offset() const;
+  public:
+  void clear_after_offset();
+  uint64_t after_offset() const;
+  void set_after_offset(uint64_t value);
+  private:
+  uint64_t _internal_after_offset() const;
+  void _internal_set_after_offset(uint64_t value);
+  public:
+
+  // uint32 limit = 1;
+  void clear_limit();
+  uint32_t limit() const;
+  void set_limit(uint32_t value);
+  private:
+  uint32_t _internal_limit() const;
+  void _internal_set_limit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.HistoryRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t after_offset_;
+    uint32_t limit_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HistoryResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.HistoryResponse) */ {
+ public:
+  inline HistoryResponse() : HistoryResponse(nullptr) {}
+  ~HistoryResponse() override;
+  explicit PROTOBUF_CONSTEXPR HistoryResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HistoryResponse(const HistoryResponse& from);
+  HistoryResponse(HistoryResponse&& from) noexcept
+    : HistoryResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline HistoryResponse& operator=(const HistoryResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HistoryResponse& operator=(HistoryResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HistoryResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HistoryResponse* internal_default_instance() {
+    return reinterpret_cast<const HistoryResponse*>(
+               &_HistoryResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(HistoryResponse& a, HistoryResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HistoryResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HistoryResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HistoryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HistoryResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HistoryResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HistoryResponse& from) {
+    HistoryResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HistoryResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.HistoryResponse";
+  }
+  protected:
+  explicit HistoryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLastOffsetFieldNumber = 2,
+    kCountFieldNumber = 1,
+    kGapFieldNumber = 3,
+  };
+  // uint64 last_offset = 2;
+  void clear_last_offset();
+  uint64_t last_offset() const;
+  void set_last_offset(uint64_t value);
+  private:
+  uint64_t _internal_last_offset() const;
+  void _internal_set_last_offset(uint64_t value);
+  public:
+
+  // uint32 count = 1;
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // bool gap = 3;
+  void clear_gap();
+  bool gap() const;
+  void set_gap(bool value);
+  private:
+  bool _internal_gap() const;
+  void _internal_set_gap(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.HistoryResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t last_offset_;
+    uint32_t count_;
+    bool gap_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  enum PayloadCase {
+    kRegisterUser = 2,
+    kSendMessage = 3,
+    kUpdateStatus = 4,
+    kGetUsers = 5,
+    kUnregisterUser = 6,
+    kGetHistory = 7,
+    kJoinChannel = 8,
+    kLeaveChannel = 9,
+    kPresence = 10,
+    PAYLOAD_NOT_SET = 0,
+  };
+
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 11,
+    kOperationFieldNumber = 1,
+    kRegisterUserFieldNumber = 2,
+    kSendMessageFieldNumber = 3,
+    kUpdateStatusFieldNumber = 4,
+    kGetUsersFieldNumber = 5,
+    kUnregisterUserFieldNumber = 6,
+    kGetHistoryFieldNumber = 7,
+    kJoinChannelFieldNumber = 8,
+    kLeaveChannelFieldNumber = 9,
+    kPresenceFieldNumber = 10,
+  };
+  // optional uint64 request_id = 11;
+  bool has_request_id() const;
+  private:
+  bool _internal_has_request_id() const;
+  public:
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // .chat.NewUserRequest register_user = 2;
+  bool has_register_user() const;
+  private:
+  bool _internal_has_register_user() const;
+  public:
+  void clear_register_user();
+  const ::chat::NewUserRequest& register_user() const;
+  PROTOBUF_NODISCARD ::chat::NewUserRequest* release_register_user();
+  ::chat::NewUserRequest* mutable_register_user();
+  void set_allocated_register_user(::chat::NewUserRequest* register_user);
+  private:
+  const ::chat::NewUserRequest& _internal_register_user() const;
+  ::chat::NewUserRequest* _internal_mutable_register_user();
+  public:
+  void unsafe_arena_set_allocated_register_user(
+      ::chat::NewUserRequest* register_user);
+  ::chat::NewUserRequest* unsafe_arena_release_register_user();
+
+  // .chat.SendMessageRequest send_message = 3;
+  bool has_send_message() const;
+  private:
+  bool _internal_has_send_message() const;
+  public:
+  void clear_send_message();
+  const ::chat::SendMessageRequest& send_message() const;
+  PROTOBUF_NODISCARD ::chat::SendMessageRequest* release_send_message();
+  ::chat::SendMessageRequest* mutable_send_message();
+  void set_allocated_send_message(::chat::SendMessageRequest* send_message);
+  private:
+  const ::chat::SendMessageRequest& _internal_send_message() const;
+  ::chat::SendMessageRequest* _internal_mutable_send_message();
+  public:
+  void unsafe_arena_set_allocated_send_message(
+      ::chat::SendMessageRequest* send_message);
+  ::chat::SendMessageRequest* unsafe_arena_release_send_message();
+
+  // .chat.UpdateStatusRequest update_status = 4;
+  bool has_update_status() const;
+  private:
+  bool _internal_has_update_status() const;
+  public:
+  void clear_update_status();
+  const ::chat::UpdateStatusRequest& update_status() const;
+  PROTOBUF_NODISCARD ::chat::UpdateStatusRequest* release_update_status();
+  ::chat::UpdateStatusRequest* mutable_update_status();
+  void set_allocated_update_status(::chat::UpdateStatusRequest* update_status);
+  private:
+  const ::chat::UpdateStatusRequest& _internal_update_status() const;
+  ::chat::UpdateStatusRequest* _internal_mutable_update_status();
+  public:
+  void unsafe_arena_set_allocated_update_status(
+      ::chat::UpdateStatusRequest* update_status);
+  ::chat::UpdateStatusRequest* unsafe_arena_release_update_status();
+
+  // .chat.UserListRequest get_users = 5;
+  bool has_get_users() const;
+  private:
+  bool _internal_has_get_users() const;
+  public:
+  void clear_get_users();
+  const ::chat::UserListRequest& get_users() const;
+  PROTOBUF_NODISCARD ::chat::UserListRequest* release_get_users();
+  ::chat::UserListRequest* mutable_get_users();
+  void set_allocated_get_users(::chat::UserListRequest* get_users);
+  private:
+  const ::chat::UserListRequest& _internal_get_users() const;
+  ::chat::UserListRequest* _internal_mutable_get_users();
+  public:
+  void unsafe_arena_set_allocated_get_users(
+      ::chat::UserListRequest* get_users);
+  ::chat::UserListRequest* unsafe_arena_release_get_users();
+
+  // .chat.User unregister_user = 6;
+  bool has_unregister_user() const;
+  private:
+  bool _internal_has_unregister_user() const;
+  public:
+  void clear_unregister_user();
+  const ::chat::User& unregister_user() const;
+  PROTOBUF_NODISCARD ::chat::User* release_unregister_user();
+  ::chat::User* mutable_unregister_user();
+  void set_allocated_unregister_user(::chat::User* unregister_user);
+  private:
+  const ::chat::User& _internal_unregister_user() const;
+  ::chat::User* _internal_mutable_unregister_user();
+  public:
+  void unsafe_arena_set_allocated_unregister_user(
+      ::chat::User* unregister_user);
+  ::chat::User* unsafe_arena_release_unregister_user();
+
+  // .chat.HistoryRequest get_history = 7;
+  bool has_get_history() const;
+  private:
+  bool _internal_has_get_history() const;
+  public:
+  void clear_get_history();
+  const ::chat::HistoryRequest& get_history() const;
+  PROTOBUF_NODISCARD ::chat::HistoryRequest* release_get_history();
+  ::chat::HistoryRequest* mutable_get_history();
+  void set_allocated_get_history(::chat::HistoryRequest* get_history);
+  private:
+  const ::chat::HistoryRequest& _internal_get_history() const;
+  ::chat::HistoryRequest* _internal_mutable_get_history();
+  public:
+  void unsafe_arena_set_allocated_get_history(
+      ::chat::HistoryRequest* get_history);
+  ::chat::HistoryRequest* unsafe_arena_release_get_history();
+
+  // .chat.ChannelRequest join_channel = 8;
+  bool has_join_channel() const;
+  private:
+  bool _internal_has_join_channel() const;
+  public:
+  void clear_join_channel();
+  const ::chat::ChannelRequest& join_channel() const;
+  PROTOBUF_NODISCARD ::chat::ChannelRequest* release_join_channel();
+  ::chat::ChannelRequest* mutable_join_channel();
+  void set_allocated_join_channel(::chat::ChannelRequest* join_channel);
+  private:
+  const ::chat::ChannelRequest& _internal_join_channel() const;
+  ::chat::ChannelRequest* _internal_mutable_join_channel();
+  public:
+  void unsafe_arena_set_allocated_join_channel(
+      ::chat::ChannelRequest* join_channel);
+  ::chat::ChannelRequest* unsafe_arena_release_join_channel();
+
+  // .chat.ChannelRequest leave_channel = 9;
+  bool has_leave_channel() const;
+  private:
+  bool _internal_has_leave_channel() const;
+  public:
+  void clear_leave_channel();
+  const ::chat::ChannelRequest& leave_channel() const;
+  PROTOBUF_NODISCARD ::chat::ChannelRequest* release_leave_channel();
+  ::chat::ChannelRequest* mutable_leave_channel();
+  void set_allocated_leave_channel(::chat::ChannelRequest* leave_channel);
+  private:
+  const ::chat::ChannelRequest& _internal_leave_channel() const;
+  ::chat::ChannelRequest* _internal_mutable_leave_channel();
+  public:
+  void unsafe_arena_set_allocated_leave_channel(
+      ::chat::ChannelRequest* leave_channel);
+  ::chat::ChannelRequest* unsafe_arena_release_leave_channel();
+
+  // .chat.PresenceRequest presence = 10;
+  bool has_presence() const;
+  private:
+  bool _internal_has_presence() const;
+  public:
+  void clear_presence();
+  const ::chat::PresenceRequest& presence() const;
+  PROTOBUF_NODISCARD ::chat::PresenceRequest* release_presence();
+  ::chat::PresenceRequest* mutable_presence();
+  void set_allocated_presence(::chat::PresenceRequest* presence);
+  private:
+  const ::chat::PresenceRequest& _internal_presence() const;
+  ::chat::PresenceRequest* _internal_mutable_presence();
+  public:
+  void unsafe_arena_set_allocated_presence(
+      ::chat::PresenceRequest* presence);
+  ::chat::PresenceRequest* unsafe_arena_release_presence();
+
+  void clear_payload();
+  PayloadCase payload_case() const;
+  // @@protoc_insertion_point(class_scope:chat.Request)
+ private:
+  class _Internal;
+  void set_has_register_user();
+  void set_has_send_message();
+  void set_has_update_status();
+  void set_has_get_users();
+  void set_has_unregister_user();
+  void set_has_get_history();
+  void set_has_join_channel();
+  void set_has_leave_channel();
+  void set_has_presence();
+
+  inline bool has_payload() const;
+  inline void clear_has_payload();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t request_id_;
+    int operation_;
+    union PayloadUnion {
+      constexpr PayloadUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chat::NewUserRequest* register_user_;
+      ::chat::SendMessageRequest* send_message_;
+      ::chat::UpdateStatusRequest* update_status_;
+      ::chat::UserListRequest* get_users_;
+      ::chat::User* unregister_user_;
+      ::chat::HistoryRequest* get_history_;
+      ::chat::ChannelRequest* join_channel_;
+      ::chat::ChannelRequest* leave_channel_;
+      ::chat::PresenceRequest* presence_;
+    } payload_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.RequestBatch) */ {
+ public:
+  inline RequestBatch() : RequestBatch(nullptr) {}
+  ~RequestBatch() override;
+  explicit PROTOBUF_CONSTEXPR RequestBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestBatch(const RequestBatch& from);
+  RequestBatch(RequestBatch&& from) noexcept
+    : RequestBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestBatch& operator=(const RequestBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestBatch& operator=(RequestBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestBatch* internal_default_instance() {
+    return reinterpret_cast<const RequestBatch*>(
+               &_RequestBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(RequestBatch& a, RequestBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestBatch& from) {
+    RequestBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.RequestBatch";
+  }
+  protected:
+  explicit RequestBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestsFieldNumber = 1,
+  };
+  // repeated .chat.Request requests = 1;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::chat::Request* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request >*
+      mutable_requests();
+  private:
+  const ::chat::Request& _internal_requests(int index) const;
+  ::chat::Request* _internal_add_requests();
+  public:
+  const ::chat::Request& requests(int index) const;
+  ::chat::Request* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request >&
+      requests() const;
+
+  // @@protoc_insertion_point(class_scope:chat.RequestBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request > requests_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResponseBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ResponseBatch) */ {
+ public:
+  inline ResponseBatch() : ResponseBatch(nullptr) {}
+  ~ResponseBatch() override;
+  explicit PROTOBUF_CONSTEXPR ResponseBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResponseBatch(const ResponseBatch& from);
+  ResponseBatch(ResponseBatch&& from) noexcept
+    : ResponseBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline ResponseBatch& operator=(const ResponseBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResponseBatch& operator=(ResponseBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResponseBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResponseBatch* internal_default_instance() {
+    return reinterpret_cast<const ResponseBatch*>(
+               &_ResponseBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(ResponseBatch& a, ResponseBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResponseBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResponseBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResponseBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResponseBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResponseBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResponseBatch& from) {
+    ResponseBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResponseBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ResponseBatch";
+  }
+  protected:
+  explicit ResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+  };
+  // repeated .chat.Response responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::chat::Response* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response >*
+      mutable_responses();
+  private:
+  const ::chat::Response& _internal_responses(int index) const;
+  ::chat::Response* _internal_add_responses();
+  public:
+  const ::chat::Response& responses(int index) const;
+  ::chat::Response* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response >&
+      responses() const;
+
+  // @@protoc_insertion_point(class_scope:chat.ResponseBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response > responses_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Response) */ {
+ public:
+  inline Response() : Response(nullptr) {}
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Response(const Response& from);
+  Response(Response&& from) noexcept
+    : Response() {
+    *this = ::std::move(from);
+  }
+
+  inline Response& operator=(const Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Response& operator=(Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ResultCase {
+    kUserList = 4,
+    kIncomingMessage = 5,
+    kHistory = 6,
+    kChannel = 8,
+    kPresence = 9,
+    kStats = 10,
+    RESULT_NOT_SET = 0,
+  };
+
+  static inline const Response* internal_default_instance() {
+    return reinterpret_cast<const Response*>(
+               &_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(Response& a, Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Response";
+  }
+  protected:
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessageFieldNumber = 3,
+    kOperationFieldNumber = 1,
+    kStatusCodeFieldNumber = 2,
+    kCompressionFieldNumber = 7,
+    kNewStatusFieldNumber = 12,
+    kRequestIdFieldNumber = 11,
+    kUserListFieldNumber = 4,
+    kIncomingMessageFieldNumber = 5,
+    kHistoryFieldNumber = 6,
+    kChannelFieldNumber = 8,
+    kPresenceFieldNumber = 9,
+    kStatsFieldNumber = 10,
+  };
+  // string message = 3;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // .chat.StatusCode status_code = 2;
+  void clear_status_code();
+  ::chat::StatusCode status_code() const;
+  void set_status_code(::chat::StatusCode value);
+  private:
+  ::chat::StatusCode _internal_status_code() const;
+  void _internal_set_status_code(::chat::StatusCode value);
+  public:
+
+  // .chat.Compression compression = 7;
+  void clear_compression();
+  ::chat::Compression compression() const;
+  void set_compression(::chat::Compression value);
+  private:
+  ::chat::Compression _internal_compression() const;
+  void _internal_set_compression(::chat::Compression value);
+  public:
+
+  // optional .chat.UserStatus new_status = 12;
+  bool has_new_status() const;
+  private:
+  bool _internal_has_new_status() const;
+  public:
+  void clear_new_status();
+  ::chat::UserStatus new_status() const;
+  void set_new_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_new_status() const;
+  void _internal_set_new_status(::chat::UserStatus value);
+  public:
+
+  // optional uint64 request_id = 11;
+  bool has_request_id() const;
+  private:
+  bool _internal_has_request_id() const;
+  public:
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // .chat.UserListResponse user_list = 4;
+  bool has_user_list() const;
+  private:
+  bool _internal_has_user_list() const;
+  public:
+  void clear_user_list();
+  const ::chat::UserListResponse& user_list() const;
+  PROTOBUF_NODISCARD ::chat::UserListResponse* release_user_list();
+  ::chat::UserListResponse* mutable_user_list();
+  void set_allocated_user_list(::chat::UserListResponse* user_list);
+  private:
+  const ::chat::UserListResponse& _internal_user_list() const;
+  ::chat::UserListResponse* _internal_mutable_user_list();
+  public:
+  void unsafe_arena_set_allocated_user_list(
+      ::chat::UserListResponse* user_list);
+  ::chat::UserListResponse* unsafe_arena_release_user_list();
+
+  // .chat.IncomingMessageResponse incoming_message = 5;
+  bool has_incoming_message() const;
+  private:
+  bool _internal_has_incoming_message() const;
+  public:
+  void clear_incoming_message();
+  const ::chat::IncomingMessageResponse& incoming_message() const;
+  PROTOBUF_NODISCARD ::chat::IncomingMessageResponse* release_incoming_message();
+  ::chat::IncomingMessageResponse* mutable_incoming_message();
+  void set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message);
+  private:
+  const ::chat::IncomingMessageResponse& _internal_incoming_message() const;
+  ::chat::IncomingMessageResponse* _internal_mutable_incoming_message();
+  public:
+  void unsafe_arena_set_allocated_incoming_message(
+      ::chat::IncomingMessageResponse* incoming_message);
+  ::chat::IncomingMessageResponse* unsafe_arena_release_incoming_message();
+
+  // .chat.HistoryResponse history = 6;
+  bool has_history() const;
+  private:
+  bool _internal_has_history() const;
+  public:
+  void clear_history();
+  const ::chat::HistoryResponse& history() const;
+  PROTOBUF_NODISCARD ::chat::HistoryResponse* release_history();
+  ::chat::HistoryResponse* mutable_history();
+  void set_allocated_history(::chat::HistoryResponse* history);
+  private:
+  const ::chat::HistoryResponse& _internal_history() const;
+  ::chat::HistoryResponse* _internal_mutable_history();
+  public:
+  void unsafe_arena_set_allocated_history(
+      ::chat::HistoryResponse* history);
+  ::chat::HistoryResponse* unsafe_arena_release_history();
+
+  // .chat.ChannelResponse channel = 8;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const ::chat::ChannelResponse& channel() const;
+  PROTOBUF_NODISCARD ::chat::ChannelResponse* release_channel();
+  ::chat::ChannelResponse* mutable_channel();
+  void set_allocated_channel(::chat::ChannelResponse* channel);
+  private:
+  const ::chat::ChannelResponse& _internal_channel() const;
+  ::chat::ChannelResponse* _internal_mutable_channel();
+  public:
+  void unsafe_arena_set_allocated_channel(
+      ::chat::ChannelResponse* channel);
+  ::chat::ChannelResponse* unsafe_arena_release_channel();
+
+  // .chat.PresenceUpdate presence = 9;
+  bool has_presence() const;
+  private:
+  bool _internal_has_presence() const;
+  public:
+  void clear_presence();
+  const ::chat::PresenceUpdate& presence() const;
+  PROTOBUF_NODISCARD ::chat::PresenceUpdate* release_presence();
+  ::chat::PresenceUpdate* mutable_presence();
+  void set_allocated_presence(::chat::PresenceUpdate* presence);
+  private:
+  const ::chat::PresenceUpdate& _internal_presence() const;
+  ::chat::PresenceUpdate* _internal_mutable_presence();
+  public:
+  void unsafe_arena_set_allocated_presence(
+      ::chat::PresenceUpdate* presence);
+  ::chat::PresenceUpdate* unsafe_arena_release_presence();
+
+  // .chat.StatsResponse stats = 10;
+  bool has_stats() const;
+  private:
+  bool _internal_has_stats() const;
+  public:
+  void clear_stats();
+  const ::chat::StatsResponse& stats() const;
+  PROTOBUF_NODISCARD ::chat::StatsResponse* release_stats();
+  ::chat::StatsResponse* mutable_stats();
+  void set_allocated_stats(::chat::StatsResponse* stats);
+  private:
+  const ::chat::StatsResponse& _internal_stats() const;
+  ::chat::StatsResponse* _internal_mutable_stats();
+  public:
+  void unsafe_arena_set_allocated_stats(
+      ::chat::StatsResponse* stats);
+  ::chat::StatsResponse* unsafe_arena_release_stats();
+
+  void clear_result();
+  ResultCase result_case() const;
+  // @@protoc_insertion_point(class_scope:chat.Response)
+ private:
+  class _Internal;
+  void set_has_user_list();
+  void set_has_incoming_message();
+  void set_has_history();
+  void set_has_channel();
+  void set_has_presence();
+  void set_has_stats();
+
+  inline bool has_result() const;
+  inline void clear_has_result();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int operation_;
+    int status_code_;
+    int compression_;
+    int new_status_;
+    uint64_t request_id_;
+    union ResultUnion {
+      constexpr ResultUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chat::UserListResponse* user_list_;
+      ::chat::IncomingMessageResponse* incoming_message_;
+      ::chat::HistoryResponse* history_;
+      ::chat::ChannelResponse* channel_;
+      ::chat::PresenceUpdate* presence_;
+      ::chat::StatsResponse* stats_;
+    } result_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// User
+
+// string username = 1;
+inline void User::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& User::username() const {
+  // @@protoc_insertion_point(field_get:chat.User.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void User::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.User.username)
+}
+inline std::string* User::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.User.username)
+  return _s;
+}
+inline const std::string& User::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void User::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* User::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* User::release_username() {
+  // @@protoc_insertion_point(field_release:chat.User.username)
+  return _impl_.username_.Release();
+}
+inline void User::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.User.username)
+}
+
+// .chat.UserStatus status = 2;
+inline void User::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus User::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus User::status() const {
+  // @@protoc_insertion_point(field_get:chat.User.status)
+  return _internal_status();
+}
+inline void User::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void User::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.User.status)
+}
+
+// -------------------------------------------------------------------
+
+// NewUserRequest
+
+// string username = 1;
+inline void NewUserRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& NewUserRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewUserRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.username)
+}
+inline std::string* NewUserRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.NewUserRequest.username)
+  return _s;
+}
+inline const std::string& NewUserRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void NewUserRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NewUserRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NewUserRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.NewUserRequest.username)
+  return _impl_.username_.Release();
+}
+inline void NewUserRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.NewUserRequest.username)
+}
+
+// optional uint64 resume_after = 2;
+inline bool NewUserRequest::_internal_has_resume_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool NewUserRequest::has_resume_after() const {
+  return _internal_has_resume_after();
+}
+inline void NewUserRequest::clear_resume_after() {
+  _impl_.resume_after_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t NewUserRequest::_internal_resume_after() const {
+  return _impl_.resume_after_;
+}
+inline uint64_t NewUserRequest::resume_after() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.resume_after)
+  return _internal_resume_after();
+}
+inline void NewUserRequest::_internal_set_resume_after(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.resume_after_ = value;
+}
+inline void NewUserRequest::set_resume_after(uint64_t value) {
+  _internal_set_resume_after(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.resume_after)
+}
+
+// .chat.Compression compression = 3;
+inline void NewUserRequest::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::chat::Compression NewUserRequest::_internal_compression() const {
+  return static_cast< ::chat::Compression >(_impl_.compression_);
+}
+inline ::chat::Compression NewUserRequest::compression() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.compression)
+  return _internal_compression();
+}
+inline void NewUserRequest::_internal_set_compression(::chat::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void NewUserRequest::set_compression(::chat::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.compression)
+}
+
+// -------------------------------------------------------------------
+
+// SendMessageRequest
+
+// string recipient = 1;
+inline void SendMessageRequest::clear_recipient() {
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::recipient() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.recipient)
+  return _internal_recipient();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_recipient(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.recipient_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.recipient)
+}
+inline std::string* SendMessageRequest::mutable_recipient() {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.recipient)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_recipient() const {
+  return _impl_.recipient_.Get();
+}
+inline void SendMessageRequest::_internal_set_recipient(const std::string& value) {
+  
+  _impl_.recipient_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_recipient() {
+  
+  return _impl_.recipient_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_recipient() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void SendMessageRequest::set_allocated_recipient(std::string* recipient) {
+  if (recipient != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.recipient_.SetAllocated(recipient, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.recipient)
+}
+
+// string content = 2;
+inline void SendMessageRequest::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::content() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.content)
+}
+inline std::string* SendMessageRequest::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.content)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void SendMessageRequest::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_content() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.content)
+  return _impl_.content_.Release();
+}
+inline void SendMessageRequest::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.content)
+}
+
+// string channel = 3;
+inline void SendMessageRequest::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::channel() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_channel(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.channel)
+}
+inline std::string* SendMessageRequest::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.channel)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void SendMessageRequest::_internal_set_channel(const std::string& value) {
+  
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_channel() {
+  
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.channel)
+  return _impl_.channel_.Release();
+}
+inline void SendMessageRequest::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.channel)
+}
+
+// -------------------------------------------------------------------
+
+// IncomingMessageResponse
+
+// string sender = 1;
+inline void IncomingMessageResponse::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::sender() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_sender(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.sender)
+}
+inline std::string* IncomingMessageResponse::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.sender)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_sender(const std::string& value) {
+  
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_sender() {
+  
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_sender() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.sender)
+  return _impl_.sender_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.sender)
+}
+
+// string content = 2;
+inline void IncomingMessageResponse::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::content() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.content)
+}
+inline std::string* IncomingMessageResponse::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.content)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_content() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.content)
+  return _impl_.content_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.content)
+}
+
+// .chat.MessageType type = 3;
+inline void IncomingMessageResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::MessageType IncomingMessageResponse::_internal_type() const {
+  return static_cast< ::chat::MessageType >(_impl_.type_);
+}
+inline ::chat::MessageType IncomingMessageResponse::type() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.type)
+  return _internal_type();
+}
+inline void IncomingMessageResponse::_internal_set_type(::chat::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void IncomingMessageResponse::set_type(::chat::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.type)
+}
+
+// uint64 offset = 4;
+inline void IncomingMessageResponse::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+}
+inline uint64_t IncomingMessageResponse::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t IncomingMessageResponse::offset() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.offset)
+  return _internal_offset();
+}
+inline void IncomingMessageResponse::_internal_set_offset(uint64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void IncomingMessageResponse::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.offset)
+}
+
+// string channel = 5;
+inline void IncomingMessageResponse::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::channel() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_channel(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.channel)
+}
+inline std::string* IncomingMessageResponse::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.channel)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_channel(const std::string& value) {
+  
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_channel() {
+  
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.channel)
+  return _impl_.channel_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.channel)
+}
+
+// -------------------------------------------------------------------
+
+// UserListRequest
+
+// string username = 1;
+inline void UserListRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UserListRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.username)
+}
+inline std::string* UserListRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.username)
+  return _s;
+}
+inline const std::string& UserListRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UserListRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UserListRequest.username)
+  return _impl_.username_.Release();
+}
+inline void UserListRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.username)
+}
+
+// uint32 page_size = 2;
+inline void UserListRequest::clear_page_size() {
+  _impl_.page_size_ = 0u;
+}
+inline uint32_t UserListRequest::_internal_page_size() const {
+  return _impl_.page_size_;
+}
+inline uint32_t UserListRequest::page_size() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.page_size)
+  return _internal_page_size();
+}
+inline void UserListRequest::_internal_set_page_size(uint32_t value) {
+  
+  _impl_.page_size_ = value;
+}
+inline void UserListRequest::set_page_size(uint32_t value) {
+  _internal_set_page_size(value);
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.page_size)
+}
+
+// string cursor = 3;
+inline void UserListRequest::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+}
+inline const std::string& UserListRequest::cursor() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListRequest::set_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.cursor)
+}
+inline std::string* UserListRequest::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.cursor)
+  return _s;
+}
+inline const std::string& UserListRequest::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void UserListRequest::_internal_set_cursor(const std::string& value) {
+  
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListRequest::_internal_mutable_cursor() {
+  
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListRequest::release_cursor() {
+  // @@protoc_insertion_point(field_release:chat.UserListRequest.cursor)
+  return _impl_.cursor_.Release();
+}
+inline void UserListRequest::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.cursor)
+}
+
+// string prefix = 4;
+inline void UserListRequest::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+}
+inline const std::string& UserListRequest::prefix() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListRequest::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.prefix)
+}
+inline std::string* UserListRequest::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.prefix)
+  return _s;
+}
+inline const std::string& UserListRequest::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void UserListRequest::_internal_set_prefix(const std::string& value) {
+  
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListRequest::_internal_mutable_prefix() {
+  
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListRequest::release_prefix() {
+  // @@protoc_insertion_point(field_release:chat.UserListRequest.prefix)
+  return _impl_.prefix_.Release();
+}
+inline void UserListRequest::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.prefix)
+}
+
+// -------------------------------------------------------------------
+
+// UserListResponse
+
+// repeated .chat.User users = 1;
+inline int UserListResponse::_internal_users_size() const {
+  return _impl_.users_.size();
+}
+inline int UserListResponse::users_size() const {
+  return _internal_users_size();
+}
+inline void UserListResponse::clear_users() {
+  _impl_.users_.Clear();
+}
+inline ::chat::User* UserListResponse::mutable_users(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.UserListResponse.users)
+  return _impl_.users_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+UserListResponse::mutable_users() {
+  // @@protoc_insertion_point(field_mutable_list:chat.UserListResponse.users)
+  return &_impl_.users_;
+}
+inline const ::chat::User& UserListResponse::_internal_users(int index) const {
+  return _impl_.users_.Get(index);
+}
+inline const ::chat::User& UserListResponse::users(int index) const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.users)
+  return _internal_users(index);
+}
+inline ::chat::User* UserListResponse::_internal_add_users() {
+  return _impl_.users_.Add();
+}
+inline ::chat::User* UserListResponse::add_users() {
+  ::chat::User* _add = _internal_add_users();
+  // @@protoc_insertion_point(field_add:chat.UserListResponse.users)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+UserListResponse::users() const {
+  // @@protoc_insertion_point(field_list:chat.UserListResponse.users)
+  return _impl_.users_;
+}
+
+// .chat.UserListType type = 2;
+inline void UserListResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::UserListType UserListResponse::_internal_type() const {
+  return static_cast< ::chat::UserListType >(_impl_.type_);
+}
+inline ::chat::UserListType UserListResponse::type() const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.type)
+  return _internal_type();
+}
+inline void UserListResponse::_internal_set_type(::chat::UserListType value) {
+  
+  _impl_.type_ = value;
+}
+inline void UserListResponse::set_type(::chat::UserListType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.UserListResponse.type)
+}
+
+// string next_cursor = 3;
+inline void UserListResponse::clear_next_cursor() {
+  _impl_.next_cursor_.ClearToEmpty();
+}
+inline const std::string& UserListResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.next_cursor)
+  return _internal_next_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListResponse::set_next_cursor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.next_cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListResponse.next_cursor)
+}
+inline std::string* UserListResponse::mutable_next_cursor() {
+  std::string* _s = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:chat.UserListResponse.next_cursor)
+  return _s;
+}
+inline const std::string& UserListResponse::_internal_next_cursor() const {
+  return _impl_.next_cursor_.Get();
+}
+inline void UserListResponse::_internal_set_next_cursor(const std::string& value) {
+  
+  _impl_.next_cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListResponse::_internal_mutable_next_cursor() {
+  
+  return _impl_.next_cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListResponse::release_next_cursor() {
+  // @@protoc_insertion_point(field_release:chat.UserListResponse.next_cursor)
+  return _impl_.next_cursor_.Release();
+}
+inline void UserListResponse::set_allocated_next_cursor(std::string* next_cursor) {
+  if (next_cursor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.next_cursor_.SetAllocated(next_cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_cursor_.IsDefault()) {
+    _impl_.next_cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListResponse.next_cursor)
+}
+
+// uint64 version = 4;
+inline void UserListResponse::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t UserListResponse::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t UserListResponse::version() const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.version)
+  return _internal_version();
+}
+inline void UserListResponse::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void UserListResponse::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.UserListResponse.version)
+}
+
+// -------------------------------------------------------------------
+
+// UpdateStatusRequest
+
+// string username = 1;
+inline void UpdateStatusRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UpdateStatusRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateStatusRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.username)
+}
+inline std::string* UpdateStatusRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UpdateStatusRequest.username)
+  return _s;
+}
+inline const std::string& UpdateStatusRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UpdateStatusRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpdateStatusRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpdateStatusRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UpdateStatusRequest.username)
+  return _impl_.username_.Release();
+}
+inline void UpdateStatusRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UpdateStatusRequest.username)
+}
+
+// .chat.UserStatus new_status = 2;
+inline void UpdateStatusRequest::clear_new_status() {
+  _impl_.new_status_ = 0;
+}
+inline ::chat::UserStatus UpdateStatusRequest::_internal_new_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.new_status_);
+}
+inline ::chat::UserStatus UpdateStatusRequest::new_status() const {
+  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.new_status)
+  return _internal_new_status();
+}
+inline void UpdateStatusRequest::_internal_set_new_status(::chat::UserStatus value) {
+  
+  _impl_.new_status_ = value;
+}
+inline void UpdateStatusRequest::set_new_status(::chat::UserStatus value) {
+  _internal_set_new_status(value);
+  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.new_status)
+}
+
+// -------------------------------------------------------------------
+
+// ChannelRequest
+
+// string channel = 1;
+inline void ChannelRequest::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+}
+inline const std::string& ChannelRequest::channel() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelRequest.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelRequest::set_channel(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelRequest.channel)
+}
+inline std::string* ChannelRequest::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelRequest.channel)
+  return _s;
+}
+inline const std::string& ChannelRequest::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void ChannelRequest::_internal_set_channel(const std::string& value) {
+  
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelRequest::_internal_mutable_channel() {
+  
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelRequest::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.ChannelRequest.channel)
+  return _impl_.channel_.Release();
+}
+inline void ChannelRequest::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelRequest.channel)
+}
+
+// -------------------------------------------------------------------
+
+// ChannelResponse
+
+// string channel = 1;
+inline void ChannelResponse::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+}
+inline const std::string& ChannelResponse::channel() const {
+  // @@protoc_insertion_point(field_get:chat.ChannelResponse.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChannelResponse::set_channel(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ChannelResponse.channel)
+}
+inline std::string* ChannelResponse::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.ChannelResponse.channel)
+  return _s;
+}
+inline const std::string& ChannelResponse::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void ChannelResponse::_internal_set_channel(const std::string& value) {
+  
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChannelResponse::_internal_mutable_channel() {
+  
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChannelResponse::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.ChannelResponse.channel)
+  return _impl_.channel_.Release();
+}
+inline void ChannelResponse::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ChannelResponse.channel)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceRequest
+
+// bool subscribe = 1;
+inline void PresenceRequest::clear_subscribe() {
+  _impl_.subscribe_ = false;
+}
+inline bool PresenceRequest::_internal_subscribe() const {
+  return _impl_.subscribe_;
+}
+inline bool PresenceRequest::subscribe() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceRequest.subscribe)
+  return _internal_subscribe();
+}
+inline void PresenceRequest::_internal_set_subscribe(bool value) {
+  
+  _impl_.subscribe_ = value;
+}
+inline void PresenceRequest::set_subscribe(bool value) {
+  _internal_set_subscribe(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceRequest.subscribe)
+}
+
+// optional uint64 known_version = 2;
+inline bool PresenceRequest::_internal_has_known_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PresenceRequest::has_known_version() const {
+  return _internal_has_known_version();
+}
+inline void PresenceRequest::clear_known_version() {
+  _impl_.known_version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t PresenceRequest::_internal_known_version() const {
+  return _impl_.known_version_;
+}
+inline uint64_t PresenceRequest::known_version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceRequest.known_version)
+  return _internal_known_version();
+}
+inline void PresenceRequest::_internal_set_known_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.known_version_ = value;
+}
+inline void PresenceRequest::set_known_version(uint64_t value) {
+  _internal_set_known_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceRequest.known_version)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceEvent
+
+// uint64 version = 1;
+inline void PresenceEvent::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t PresenceEvent::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PresenceEvent::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEvent.version)
+  return _internal_version();
+}
+inline void PresenceEvent::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PresenceEvent::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEvent.version)
+}
+
+// string username = 2;
+inline void PresenceEvent::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& PresenceEvent::username() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEvent.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PresenceEvent::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PresenceEvent.username)
+}
+inline std::string* PresenceEvent::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.PresenceEvent.username)
+  return _s;
+}
+inline const std::string& PresenceEvent::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void PresenceEvent::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PresenceEvent::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PresenceEvent::release_username() {
+  // @@protoc_insertion_point(field_release:chat.PresenceEvent.username)
+  return _impl_.username_.Release();
+}
+inline void PresenceEvent::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PresenceEvent.username)
+}
+
+// .chat.PresenceChange change = 3;
+inline void PresenceEvent::clear_change() {
+  _impl_.change_ = 0;
+}
+inline ::chat::PresenceChange PresenceEvent::_internal_change() const {
+  return static_cast< ::chat::PresenceChange >(_impl_.change_);
+}
+inline ::chat::PresenceChange PresenceEvent::change() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEvent.change)
+  return _internal_change();
+}
+inline void PresenceEvent::_internal_set_change(::chat::PresenceChange value) {
+  
+  _impl_.change_ = value;
+}
+inline void PresenceEvent::set_change(::chat::PresenceChange value) {
+  _internal_set_change(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEvent.change)
+}
+
+// .chat.UserStatus status = 4;
+inline void PresenceEvent::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus PresenceEvent::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus PresenceEvent::status() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEvent.status)
+  return _internal_status();
+}
+inline void PresenceEvent::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void PresenceEvent::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEvent.status)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceUpdate
+
+// uint64 from_version = 1;
+inline void PresenceUpdate::clear_from_version() {
+  _impl_.from_version_ = uint64_t{0u};
+}
+inline uint64_t PresenceUpdate::_internal_from_version() const {
+  return _impl_.from_version_;
+}
+inline uint64_t PresenceUpdate::from_version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.from_version)
+  return _internal_from_version();
+}
+inline void PresenceUpdate::_internal_set_from_version(uint64_t value) {
+  
+  _impl_.from_version_ = value;
+}
+inline void PresenceUpdate::set_from_version(uint64_t value) {
+  _internal_set_from_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.from_version)
+}
+
+// uint64 version = 2;
+inline void PresenceUpdate::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t PresenceUpdate::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PresenceUpdate::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.version)
+  return _internal_version();
+}
+inline void PresenceUpdate::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PresenceUpdate::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.version)
+}
+
+// bool snapshot = 3;
+inline void PresenceUpdate::clear_snapshot() {
+  _impl_.snapshot_ = false;
+}
+inline bool PresenceUpdate::_internal_snapshot() const {
+  return _impl_.snapshot_;
+}
+inline bool PresenceUpdate::snapshot() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.snapshot)
+  return _internal_snapshot();
+}
+inline void PresenceUpdate::_internal_set_snapshot(bool value) {
+  
+  _impl_.snapshot_ = value;
+}
+inline void PresenceUpdate::set_snapshot(bool value) {
+  _internal_set_snapshot(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.snapshot)
+}
+
+// repeated .chat.PresenceEvent events = 4;
+inline int PresenceUpdate::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int PresenceUpdate::events_size() const {
+  return _internal_events_size();
+}
+inline void PresenceUpdate::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::chat::PresenceEvent* PresenceUpdate::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PresenceUpdate.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent >*
+PresenceUpdate::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PresenceUpdate.events)
+  return &_impl_.events_;
+}
+inline const ::chat::PresenceEvent& PresenceUpdate::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::chat::PresenceEvent& PresenceUpdate::events(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.events)
+  return _internal_events(index);
+}
+inline ::chat::PresenceEvent* PresenceUpdate::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::chat::PresenceEvent* PresenceUpdate::add_events() {
+  ::chat::PresenceEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:chat.PresenceUpdate.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent >&
+PresenceUpdate::events() const {
+  // @@protoc_insertion_point(field_list:chat.PresenceUpdate.events)
+  return _impl_.events_;
+}
+
+// -------------------------------------------------------------------
+
+// StatsCounter
+
+// string name = 1;
+inline void StatsCounter::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& StatsCounter::name() const {
+  // @@protoc_insertion_point(field_get:chat.StatsCounter.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatsCounter::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.StatsCounter.name)
+}
+inline std::string* StatsCounter::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.StatsCounter.name)
+  return _s;
+}
+inline const std::string& StatsCounter::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void StatsCounter::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StatsCounter::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StatsCounter::release_name() {
+  // @@protoc_insertion_point(field_release:chat.StatsCounter.name)
+  return _impl_.name_.Release();
+}
+inline void StatsCounter::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.StatsCounter.name)
+}
+
+// uint64 value = 2;
+inline void StatsCounter::clear_value() {
+  _impl_.value_ = uint64_t{0u};
+}
+inline uint64_t StatsCounter::_internal_value() const {
+  return _impl_.value_;
+}
+inline uint64_t StatsCounter::value() const {
+  // @@protoc_insertion_point(field_get:chat.StatsCounter.value)
+  return _internal_value();
+}
+inline void StatsCounter::_internal_set_value(uint64_t value) {
+  
+  _impl_.value_ = value;
+}
+inline void StatsCounter::set_value(uint64_t value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:chat.StatsCounter.value)
+}
+
+// -------------------------------------------------------------------
+
+// StatsHistogram
+
+// string name = 1;
+inline void StatsHistogram::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& StatsHistogram::name() const {
+  // @@protoc_insertion_point(field_get:chat.StatsHistogram.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StatsHistogram::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.StatsHistogram.name)
+}
+inline std::string* StatsHistogram::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.StatsHistogram.name)
+  return _s;
+}
+inline const std::string& StatsHistogram::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void StatsHistogram::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StatsHistogram::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StatsHistogram::release_name() {
+  // @@protoc_insertion_point(field_release:chat.StatsHistogram.name)
+  return _impl_.name_.Release();
+}
+inline void StatsHistogram::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.StatsHistogram.name)
+}
+
+// uint64 count = 2;
+inline void StatsHistogram::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t StatsHistogram::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t StatsHistogram::count() const {
+  // @@protoc_insertion_point(field_get:chat.StatsHistogram.count)
+  return _internal_count();
+}
+inline void StatsHistogram::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void StatsHistogram::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:chat.StatsHistogram.count)
+}
+
+// uint64 sum = 3;
+inline void StatsHistogram::clear_sum() {
+  _impl_.sum_ = uint64_t{0u};
+}
+inline uint64_t StatsHistogram::_internal_sum() const {
+  return _impl_.sum_;
+}
+inline uint64_t StatsHistogram::sum() const {
+  // @@protoc_insertion_point(field_get:chat.StatsHistogram.sum)
+  return _internal_sum();
+}
+inline void StatsHistogram::_internal_set_sum(uint64_t value) {
+  
+  _impl_.sum_ = value;
+}
+inline void StatsHistogram::set_sum(uint64_t value) {
+  _internal_set_sum(value);
+  // @@protoc_insertion_point(field_set:chat.StatsHistogram.sum)
+}
+
+// uint64 p50 = 4;
+inline void StatsHistogram::clear_p50() {
+  _impl_.p50_ = uint64_t{0u};
+}
+inline uint64_t StatsHistogram::_internal_p50() const {
+  return _impl_.p50_;
+}
+inline uint64_t StatsHistogram::p50() const {
+  // @@protoc_insertion_point(field_get:chat.StatsHistogram.p50)
+  return _internal_p50();
+}
+inline void StatsHistogram::_internal_set_p50(uint64_t value) {
+  
+  _impl_.p50_ = value;
+}
+inline void StatsHistogram::set_p50(uint64_t value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:chat.StatsHistogram.p50)
+}
+
+// uint64 p90 = 5;
+inline void StatsHistogram::clear_p90() {
+  _impl_.p90_ = uint64_t{0u};
+}
+inline uint64_t StatsHistogram::_internal_p90() const {
+  return _impl_.p90_;
+}
+inline uint64_t StatsHistogram::p90() const {
+  // @@protoc_insertion_point(field_get:chat.StatsHistogram.p90)
+  return _internal_p90();
+}
+inline void StatsHistogram::_internal_set_p90(uint64_t value) {
+  
+  _impl_.p90_ = value;
+}
+inline void StatsHistogram::set_p90(uint64_t value) {
+  _internal_set_p90(value);
+  // @@protoc_insertion_point(field_set:chat.StatsHistogram.p90)
+}
+
+// uint64 p99 = 6;
+inline void StatsHistogram::clear_p99() {
+  _impl_.p99_ = uint64_t{0u};
+}
+inline uint64_t StatsHistogram::_internal_p99() const {
+  return _impl_.p99_;
+}
+inline uint64_t StatsHistogram::p99() const {
+  // @@protoc_insertion_point(field_get:chat.StatsHistogram.p99)
+  return _internal_p99();
+}
+inline void StatsHistogram::_internal_set_p99(uint64_t value) {
+  
+  _impl_.p99_ = value;
+}
+inline void StatsHistogram::set_p99(uint64_t value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:chat.StatsHistogram.p99)
+}
+
+// uint64 p999 = 7;
+inline void StatsHistogram::clear_p999() {
+  _impl_.p999_ = uint64_t{0u};
+}
+inline uint64_t StatsHistogram::_internal_p999() const {
+  return _impl_.p999_;
+}
+inline uint64_t StatsHistogram::p999() const {
+  // @@protoc_insertion_point(field_get:chat.StatsHistogram.p999)
+  return _internal_p999();
+}
+inline void StatsHistogram::_internal_set_p999(uint64_t value) {
+  
+  _impl_.p999_ = value;
+}
+inline void StatsHistogram::set_p999(uint64_t value) {
+  _internal_set_p999(value);
+  // @@protoc_insertion_point(field_set:chat.StatsHistogram.p999)
+}
+
+// uint64 max = 8;
+inline void StatsHistogram::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+}
+inline uint64_t StatsHistogram::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t StatsHistogram::max() const {
+  // @@protoc_insertion_point(field_get:chat.StatsHistogram.max)
+  return _internal_max();
+}
+inline void StatsHistogram::_internal_set_max(uint64_t value) {
+  
+  _impl_.max_ = value;
+}
+inline void StatsHistogram::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:chat.StatsHistogram.max)
+}
+
+// -------------------------------------------------------------------
+
+// StatsResponse
+
+// repeated .chat.StatsCounter counters = 1;
+inline int StatsResponse::_internal_counters_size() const {
+  return _impl_.counters_.size();
+}
+inline int StatsResponse::counters_size() const {
+  return _internal_counters_size();
+}
+inline void StatsResponse::clear_counters() {
+  _impl_.counters_.Clear();
+}
+inline ::chat::StatsCounter* StatsResponse::mutable_counters(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.StatsResponse.counters)
+  return _impl_.counters_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsCounter >*
+StatsResponse::mutable_counters() {
+  // @@protoc_insertion_point(field_mutable_list:chat.StatsResponse.counters)
+  return &_impl_.counters_;
+}
+inline const ::chat::StatsCounter& StatsResponse::_internal_counters(int index) const {
+  return _impl_.counters_.Get(index);
+}
+inline const ::chat::StatsCounter& StatsResponse::counters(int index) const {
+  // @@protoc_insertion_point(field_get:chat.StatsResponse.counters)
+  return _internal_counters(index);
+}
+inline ::chat::StatsCounter* StatsResponse::_internal_add_counters() {
+  return _impl_.counters_.Add();
+}
+inline ::chat::StatsCounter* StatsResponse::add_counters() {
+  ::chat::StatsCounter* _add = _internal_add_counters();
+  // @@protoc_insertion_point(field_add:chat.StatsResponse.counters)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsCounter >&
+StatsResponse::counters() const {
+  // @@protoc_insertion_point(field_list:chat.StatsResponse.counters)
+  return _impl_.counters_;
+}
+
+// repeated .chat.StatsHistogram histograms = 2;
+inline int StatsResponse::_internal_histograms_size() const {
+  return _impl_.histograms_.size();
+}
+inline int StatsResponse::histograms_size() const {
+  return _internal_histograms_size();
+}
+inline void StatsResponse::clear_histograms() {
+  _impl_.histograms_.Clear();
+}
+inline ::chat::StatsHistogram* StatsResponse::mutable_histograms(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.StatsResponse.histograms)
+  return _impl_.histograms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsHistogram >*
+StatsResponse::mutable_histograms() {
+  // @@protoc_insertion_point(field_mutable_list:chat.StatsResponse.histograms)
+  return &_impl_.histograms_;
+}
+inline const ::chat::StatsHistogram& StatsResponse::_internal_histograms(int index) const {
+  return _impl_.histograms_.Get(index);
+}
+inline const ::chat::StatsHistogram& StatsResponse::histograms(int index) const {
+  // @@protoc_insertion_point(field_get:chat.StatsResponse.histograms)
+  return _internal_histograms(index);
+}
+inline ::chat::StatsHistogram* StatsResponse::_internal_add_histograms() {
+  return _impl_.histograms_.Add();
+}
+inline ::chat::StatsHistogram* StatsResponse::add_histograms() {
+  ::chat::StatsHistogram* _add = _internal_add_histograms();
+  // @@protoc_insertion_point(field_add:chat.StatsResponse.histograms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatsHistogram >&
+StatsResponse::histograms() const {
+  // @@protoc_insertion_point(field_list:chat.StatsResponse.histograms)
+  return _impl_.histograms_;
+}
+
+// -------------------------------------------------------------------
+
+// HistoryRequest
+
+// uint32 limit = 1;
+inline void HistoryRequest::clear_limit() {
+  _impl_.limit_ = 0u;
+}
+inline uint32_t HistoryRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t HistoryRequest::limit() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.limit)
+  return _internal_limit();
+}
+inline void HistoryRequest::_internal_set_limit(uint32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void HistoryRequest::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.limit)
+}
+
+// optional uint64 after_offset = 2;
+inline bool HistoryRequest::_internal_has_after_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HistoryRequest::has_after_offset() const {
+  return _internal_has_after_offset();
+}
+inline void HistoryRequest::clear_after_offset() {
+  _impl_.after_offset_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t HistoryRequest::_internal_after_offset() const {
+  return _impl_.after_offset_;
+}
+inline uint64_t HistoryRequest::after_offset() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryRequest.after_offset)
+  return _internal_after_offset();
+}
+inline void HistoryRequest::_internal_set_after_offset(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.after_offset_ = value;
+}
+inline void HistoryRequest::set_after_offset(uint64_t value) {
+  _internal_set_after_offset(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryRequest.after_offset)
+}
+
+// -------------------------------------------------------------------
+
+// HistoryResponse
+
+// uint32 count = 1;
+inline void HistoryResponse::clear_count() {
+  _impl_.count_ = 0u;
+}
+inline uint32_t HistoryResponse::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t HistoryResponse::count() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.count)
+  return _internal_count();
+}
+inline void HistoryResponse::_internal_set_count(uint32_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void HistoryResponse::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.count)
+}
+
+// uint64 last_offset = 2;
+inline void HistoryResponse::clear_last_offset() {
+  _impl_.last_offset_ = uint64_t{0u};
+}
+inline uint64_t HistoryResponse::_internal_last_offset() const {
+  return _impl_.last_offset_;
+}
+inline uint64_t HistoryResponse::last_offset() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.last_offset)
+  return _internal_last_offset();
+}
+inline void HistoryResponse::_internal_set_last_offset(uint64_t value) {
+  
+  _impl_.last_offset_ = value;
+}
+inline void HistoryResponse::set_last_offset(uint64_t value) {
+  _internal_set_last_offset(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.last_offset)
+}
+
+// bool gap = 3;
+inline void HistoryResponse::clear_gap() {
+  _impl_.gap_ = false;
+}
+inline bool HistoryResponse::_internal_gap() const {
+  return _impl_.gap_;
+}
+inline bool HistoryResponse::gap() const {
+  // @@protoc_insertion_point(field_get:chat.HistoryResponse.gap)
+  return _internal_gap();
+}
+inline void HistoryResponse::_internal_set_gap(bool value) {
+  
+  _impl_.gap_ = value;
+}
+inline void HistoryResponse::set_gap(bool value) {
+  _internal_set_gap(value);
+  // @@protoc_insertion_point(field_set:chat.HistoryResponse.gap)
+}
+
+// -------------------------------------------------------------------
+
+// Request
+
+// .chat.Operation operation = 1;
+inline void Request::clear_operation() {
+  _impl_.operation_ = 0;
+}
+inline ::chat::Operation Request::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
+}
+inline ::chat::Operation Request::operation() const {
+  // @@protoc_insertion_point(field_get:chat.Request.operation)
+  return _internal_operation();
+}
+inline void Request::_internal_set_operation(::chat::Operation value) {
+  
+  _impl_.operation_ = value;
+}
+inline void Request::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.Request.operation)
+}
+
+// .chat.NewUserRequest register_user = 2;
+inline bool Request::_internal_has_register_user() const {
+  return payload_case() == kRegisterUser;
+}
+inline bool Request::has_register_user() const {
+  return _internal_has_register_user();
+}
+inline void Request::set_has_register_user() {
+  _impl_._oneof_case_[0] = kRegisterUser;
+}
+inline void Request::clear_register_user() {
+  if (_internal_has_register_user()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.register_user_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::NewUserRequest* Request::release_register_user() {
+  // @@protoc_insertion_point(field_release:chat.Request.register_user)
+  if (_internal_has_register_user()) {
+    clear_has_payload();
+    ::chat::NewUserRequest* temp = _impl_.payload_.register_user_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.register_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::NewUserRequest& Request::_internal_register_user() const {
+  return _internal_has_register_user()
+      ? *_impl_.payload_.register_user_
+      : reinterpret_cast< ::chat::NewUserRequest&>(::chat::_NewUserRequest_default_instance_);
+}
+inline const ::chat::NewUserRequest& Request::register_user() const {
+  // @@protoc_insertion_point(field_get:chat.Request.register_user)
+  return _internal_register_user();
+}
+inline ::chat::NewUserRequest* Request::unsafe_arena_release_register_user() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.register_user)
+  if (_internal_has_register_user()) {
+    clear_has_payload();
+    ::chat::NewUserRequest* temp = _impl_.payload_.register_user_;
+    _impl_.payload_.register_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_register_user(::chat::NewUserRequest* register_user) {
+  clear_payload();
+  if (register_user) {
+    set_has_register_user();
+    _impl_.payload_.register_user_ = register_user;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.register_user)
+}
+inline ::chat::NewUserRequest* Request::_internal_mutable_register_user() {
+  if (!_internal_has_register_user()) {
+    clear_payload();
+    set_has_register_user();
+    _impl_.payload_.register_user_ = CreateMaybeMessage< ::chat::NewUserRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.register_user_;
+}
+inline ::chat::NewUserRequest* Request::mutable_register_user() {
+  ::chat::NewUserRequest* _msg = _internal_mutable_register_user();
+  // @@protoc_insertion_point(field_mutable:chat.Request.register_user)
+  return _msg;
+}
+
+// .chat.SendMessageRequest send_message = 3;
+inline bool Request::_internal_has_send_message() const {
+  return payload_case() == kSendMessage;
+}
+inline bool Request::has_send_message() const {
+  return _internal_has_send_message();
+}
+inline void Request::set_has_send_message() {
+  _impl_._oneof_case_[0] = kSendMessage;
+}
+inline void Request::clear_send_message() {
+  if (_internal_has_send_message()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.send_message_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::SendMessageRequest* Request::release_send_message() {
+  // @@protoc_insertion_point(field_release:chat.Request.send_message)
+  if (_internal_has_send_message()) {
+    clear_has_payload();
+    ::chat::SendMessageRequest* temp = _impl_.payload_.send_message_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.send_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::SendMessageRequest& Request::_internal_send_message() const {
+  return _internal_has_send_message()
+      ? *_impl_.payload_.send_message_
+      : reinterpret_cast< ::chat::SendMessageRequest&>(::chat::_SendMessageRequest_default_instance_);
+}
+inline const ::chat::SendMessageRequest& Request::send_message() const {
+  // @@protoc_insertion_point(field_get:chat.Request.send_message)
+  return _internal_send_message();
+}
+inline ::chat::SendMessageRequest* Request::unsafe_arena_release_send_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.send_message)
+  if (_internal_has_send_message()) {
+    clear_has_payload();
+    ::chat::SendMessageRequest* temp = _impl_.payload_.send_message_;
+    _impl_.payload_.send_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_send_message(::chat::SendMessageRequest* send_message) {
+  clear_payload();
+  if (send_message) {
+    set_has_send_message();
+    _impl_.payload_.send_message_ = send_message;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.send_message)
+}
+inline ::chat::SendMessageRequest* Request::_internal_mutable_send_message() {
+  if (!_internal_has_send_message()) {
+    clear_payload();
+    set_has_send_message();
+    _impl_.payload_.send_message_ = CreateMaybeMessage< ::chat::SendMessageRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.send_message_;
+}
+inline ::chat::SendMessageRequest* Request::mutable_send_message() {
+  ::chat::SendMessageRequest* _msg = _internal_mutable_send_message();
+  // @@protoc_insertion_point(field_mutable:chat.Request.send_message)
+  return _msg;
+}
+
+// .chat.UpdateStatusRequest update_status = 4;
+inline bool Request::_internal_has_update_status() const {
+  return payload_case() == kUpdateStatus;
+}
+inline bool Request::has_update_status() const {
+  return _internal_has_update_status();
+}
+inline void Request::set_has_update_status() {
+  _impl_._oneof_case_[0] = kUpdateStatus;
+}
+inline void Request::clear_update_status() {
+  if (_internal_has_update_status()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.update_status_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::UpdateStatusRequest* Request::release_update_status() {
+  // @@protoc_insertion_point(field_release:chat.Request.update_status)
+  if (_internal_has_update_status()) {
+    clear_has_payload();
+    ::chat::UpdateStatusRequest* temp = _impl_.payload_.update_status_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.update_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UpdateStatusRequest& Request::_internal_update_status() const {
+  return _internal_has_update_status()
+      ? *_impl_.payload_.update_status_
+      : reinterpret_cast< ::chat::UpdateStatusRequest&>(::chat::_UpdateStatusRequest_default_instance_);
+}
+inline const ::chat::UpdateStatusRequest& Request::update_status() const {
+  // @@protoc_insertion_point(field_get:chat.Request.update_status)
+  return _internal_update_status();
+}
+inline ::chat::UpdateStatusRequest* Request::unsafe_arena_release_update_status() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.update_status)
+  if (_internal_has_update_status()) {
+    clear_has_payload();
+    ::chat::UpdateStatusRequest* temp = _impl_.payload_.update_status_;
+    _impl_.payload_.update_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
+  clear_payload();
+  if (update_status) {
+    set_has_update_status();
+    _impl_.payload_.update_status_ = update_status;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.update_status)
+}
+inline ::chat::UpdateStatusRequest* Request::_internal_mutable_update_status() {
+  if (!_internal_has_update_status()) {
+    clear_payload();
+    set_has_update_status();
+    _impl_.payload_.update_status_ = CreateMaybeMessage< ::chat::UpdateStatusRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.update_status_;
+}
+inline ::chat::UpdateStatusRequest* Request::mutable_update_status() {
+  ::chat::UpdateStatusRequest* _msg = _internal_mutable_update_status();
+  // @@protoc_insertion_point(field_mutable:chat.Request.update_status)
+  return _msg;
+}
+
+// .chat.UserListRequest get_users = 5;
+inline bool Request::_internal_has_get_users() const {
+  return payload_case() == kGetUsers;
+}
+inline bool Request::has_get_users() const {
+  return _internal_has_get_users();
+}
+inline void Request::set_has_get_users() {
+  _impl_._oneof_case_[0] = kGetUsers;
+}
+inline void Request::clear_get_users() {
+  if (_internal_has_get_users()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.get_users_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::UserListRequest* Request::release_get_users() {
+  // @@protoc_insertion_point(field_release:chat.Request.get_users)
+  if (_internal_has_get_users()) {
+    clear_has_payload();
+    ::chat::UserListRequest* temp = _impl_.payload_.get_users_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.get_users_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UserListRequest& Request::_internal_get_users() const {
+  return _internal_has_get_users()
+      ? *_impl_.payload_.get_users_
+      : reinterpret_cast< ::chat::UserListRequest&>(::chat::_UserListRequest_default_instance_);
+}
+inline const ::chat::UserListRequest& Request::get_users() const {
+  // @@protoc_insertion_point(field_get:chat.Request.get_users)
+  return _internal_get_users();
+}
+inline ::chat::UserListRequest* Request::unsafe_arena_release_get_users() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.get_users)
+  if (_internal_has_get_users()) {
+    clear_has_payload();
+    ::chat::UserListRequest* temp = _impl_.payload_.get_users_;
+    _impl_.payload_.get_users_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_get_users(::chat::UserListRequest* get_users) {
+  clear_payload();
+  if (get_users) {
+    set_has_get_users();
+    _impl_.payload_.get_users_ = get_users;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.get_users)
+}
+inline ::chat::UserListRequest* Request::_internal_mutable_get_users() {
+  if (!_internal_has_get_users()) {
+    clear_payload();
+    set_has_get_users();
+    _impl_.payload_.get_users_ = CreateMaybeMessage< ::chat::UserListRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.get_users_;
+}
+inline ::chat::UserListRequest* Request::mutable_get_users() {
+  ::chat::UserListRequest* _msg = _internal_mutable_get_users();
+  // @@protoc_insertion_point(field_mutable:chat.Request.get_users)
+  return _msg;
+}
+
+// .chat.User unregister_user = 6;
+inline bool Request::_internal_has_unregister_user() const {
+  return payload_case() == kUnregisterUser;
+}
+inline bool Request::has_unregister_user() const {
+  return _internal_has_unregister_user();
+}
+inline void Request::set_has_unregister_user() {
+  _impl_._oneof_case_[0] = kUnregisterUser;
+}
+inline void Request::clear_unregister_user() {
+  if (_internal_has_unregister_user()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.unregister_user_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::User* Request::release_unregister_user() {
+  // @@protoc_insertion_point(field_release:chat.Request.unregister_user)
+  if (_internal_has_unregister_user()) {
+    clear_has_payload();
+    ::chat::User* temp = _impl_.payload_.unregister_user_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.unregister_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::User& Request::_internal_unregister_user() const {
+  return _internal_has_unregister_user()
+      ? *_impl_.payload_.unregister_user_
+      : reinterpret_cast< ::chat::User&>(::chat::_User_default_instance_);
+}
+inline const ::chat::User& Request::unregister_user() const {
+  // @@protoc_insertion_point(field_get:chat.Request.unregister_user)
+  return _internal_unregister_user();
+}
+inline ::chat::User* Request::unsafe_arena_release_unregister_user() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.unregister_user)
+  if (_internal_has_unregister_user()) {
+    clear_has_payload();
+    ::chat::User* temp = _impl_.payload_.unregister_user_;
+    _impl_.payload_.unregister_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_unregister_user(::chat::User* unregister_user) {
+  clear_payload();
+  if (unregister_user) {
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = unregister_user;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.unregister_user)
+}
+inline ::chat::User* Request::_internal_mutable_unregister_user() {
+  if (!_internal_has_unregister_user()) {
+    clear_payload();
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = CreateMaybeMessage< ::chat::User >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.unregister_user_;
+}
+inline ::chat::User* Request::mutable_unregister_user() {
+  ::chat::User* _msg = _internal_mutable_unregister_user();
+  // @@protoc_insertion_point(field_mutable:chat.Request.unregister_user)
+  return _msg;
+}
+
+// .chat.HistoryRequest get_history = 7;
+inline bool Request::_internal_has_get_history() const {
+  return payload_case() == kGetHistory;
+}
+inline bool Request::has_get_history() const {
+  return _internal_has_get_history();
+}
+inline void Request::set_has_get_history() {
+  _impl_._oneof_case_[0] = kGetHistory;
+}
+inline void Request::clear_get_history() {
+  if (_internal_has_get_history()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.get_history_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::HistoryRequest* Request::release_get_history() {
+  // @@protoc_insertion_point(field_release:chat.Request.get_history)
+  if (_internal_has_get_history()) {
+    clear_has_payload();
+    ::chat::HistoryRequest* temp = _impl_.payload_.get_history_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.get_history_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::HistoryRequest& Request::_internal_get_history() const {
+  return _internal_has_get_history()
+      ? *_impl_.payload_.get_history_
+      : reinterpret_cast< ::chat::HistoryRequest&>(::chat::_HistoryRequest_default_instance_);
+}
+inline const ::chat::HistoryRequest& Request::get_history() const {
+  // @@protoc_insertion_point(field_get:chat.Request.get_history)
+  return _internal_get_history();
+}
+inline ::chat::HistoryRequest* Request::unsafe_arena_release_get_history() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.get_history)
+  if (_internal_has_get_history()) {
+    clear_has_payload();
+    ::chat::HistoryRequest* temp = _impl_.payload_.get_history_;
+    _impl_.payload_.get_history_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_get_history(::chat::HistoryRequest* get_history) {
+  clear_payload();
+  if (get_history) {
+    set_has_get_history();
+    _impl_.payload_.get_history_ = get_history;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.get_history)
+}
+inline ::chat::HistoryRequest* Request::_internal_mutable_get_history() {
+  if (!_internal_has_get_history()) {
+    clear_payload();
+    set_has_get_history();
+    _impl_.payload_.get_history_ = CreateMaybeMessage< ::chat::HistoryRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.get_history_;
+}
+inline ::chat::HistoryRequest* Request::mutable_get_history() {
+  ::chat::HistoryRequest* _msg = _internal_mutable_get_history();
+  // @@protoc_insertion_point(field_mutable:chat.Request.get_history)
+  return _msg;
+}
+
+// .chat.ChannelRequest join_channel = 8;
+inline bool Request::_internal_has_join_channel() const {
+  return payload_case() == kJoinChannel;
+}
+inline bool Request::has_join_channel() const {
+  return _internal_has_join_channel();
+}
+inline void Request::set_has_join_channel() {
+  _impl_._oneof_case_[0] = kJoinChannel;
+}
+inline void Request::clear_join_channel() {
+  if (_internal_has_join_channel()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.join_channel_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::ChannelRequest* Request::release_join_channel() {
+  // @@protoc_insertion_point(field_release:chat.Request.join_channel)
+  if (_internal_has_join_channel()) {
+    clear_has_payload();
+    ::chat::ChannelRequest* temp = _impl_.payload_.join_channel_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.join_channel_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::ChannelRequest& Request::_internal_join_channel() const {
+  return _internal_has_join_channel()
+      ? *_impl_.payload_.join_channel_
+      : reinterpret_cast< ::chat::ChannelRequest&>(::chat::_ChannelRequest_default_instance_);
+}
+inline const ::chat::ChannelRequest& Request::join_channel() const {
+  // @@protoc_insertion_point(field_get:chat.Request.join_channel)
+  return _internal_join_channel();
+}
+inline ::chat::ChannelRequest* Request::unsafe_arena_release_join_channel() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.join_channel)
+  if (_internal_has_join_channel()) {
+    clear_has_payload();
+    ::chat::ChannelRequest* temp = _impl_.payload_.join_channel_;
+    _impl_.payload_.join_channel_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_join_channel(::chat::ChannelRequest* join_channel) {
+  clear_payload();
+  if (join_channel) {
+    set_has_join_channel();
+    _impl_.payload_.join_channel_ = join_channel;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.join_channel)
+}
+inline ::chat::ChannelRequest* Request::_internal_mutable_join_channel() {
+  if (!_internal_has_join_channel()) {
+    clear_payload();
+    set_has_join_channel();
+    _impl_.payload_.join_channel_ = CreateMaybeMessage< ::chat::ChannelRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.join_channel_;
+}
+inline ::chat::ChannelRequest* Request::mutable_join_channel() {
+  ::chat::ChannelRequest* _msg = _internal_mutable_join_channel();
+  // @@protoc_insertion_point(field_mutable:chat.Request.join_channel)
+  return _msg;
+}
+
+// .chat.ChannelRequest leave_channel = 9;
+inline bool Request::_internal_has_leave_channel() const {
+  return payload_case() == kLeaveChannel;
+}
+inline bool Request::has_leave_channel() const {
+  return _internal_has_leave_channel();
+}
+inline void Request::set_has_leave_channel() {
+  _impl_._oneof_case_[0] = kLeaveChannel;
+}
+inline void Request::clear_leave_channel() {
+  if (_internal_has_leave_channel()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.leave_channel_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::ChannelRequest* Request::release_leave_channel() {
+  // @@protoc_insertion_point(field_release:chat.Request.leave_channel)
+  if (_internal_has_leave_channel()) {
+    clear_has_payload();
+    ::chat::ChannelRequest* temp = _impl_.payload_.leave_channel_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.leave_channel_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::ChannelRequest& Request::_internal_leave_channel() const {
+  return _internal_has_leave_channel()
+      ? *_impl_.payload_.leave_channel_
+      : reinterpret_cast< ::chat::ChannelRequest&>(::chat::_ChannelRequest_default_instance_);
+}
+inline const ::chat::ChannelRequest& Request::leave_channel() const {
+  // @@protoc_insertion_point(field_get:chat.Request.leave_channel)
+  return _internal_leave_channel();
+}
+inline ::chat::ChannelRequest* Request::unsafe_arena_release_leave_channel() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.leave_channel)
+  if (_internal_has_leave_channel()) {
+    clear_has_payload();
+    ::chat::ChannelRequest* temp = _impl_.payload_.leave_channel_;
+    _impl_.payload_.leave_channel_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_leave_channel(::chat::ChannelRequest* leave_channel) {
+  clear_payload();
+  if (leave_channel) {
+    set_has_leave_channel();
+    _impl_.payload_.leave_channel_ = leave_channel;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.leave_channel)
+}
+inline ::chat::ChannelRequest* Request::_internal_mutable_leave_channel() {
+  if (!_internal_has_leave_channel()) {
+    clear_payload();
+    set_has_leave_channel();
+    _impl_.payload_.leave_channel_ = CreateMaybeMessage< ::chat::ChannelRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.leave_channel_;
+}
+inline ::chat::ChannelRequest* Request::mutable_leave_channel() {
+  ::chat::ChannelRequest* _msg = _internal_mutable_leave_channel();
+  // @@protoc_insertion_point(field_mutable:chat.Request.leave_channel)
+  return _msg;
+}
+
+// .chat.PresenceRequest presence = 10;
+inline bool Request::_internal_has_presence() const {
+  return payload_case() == kPresence;
+}
+inline bool Request::has_presence() const {
+  return _internal_has_presence();
+}
+inline void Request::set_has_presence() {
+  _impl_._oneof_case_[0] = kPresence;
+}
+inline void Request::clear_presence() {
+  if (_internal_has_presence()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.presence_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::PresenceRequest* Request::release_presence() {
+  // @@protoc_insertion_point(field_release:chat.Request.presence)
+  if (_internal_has_presence()) {
+    clear_has_payload();
+    ::chat::PresenceRequest* temp = _impl_.payload_.presence_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.presence_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::PresenceRequest& Request::_internal_presence() const {
+  return _internal_has_presence()
+      ? *_impl_.payload_.presence_
+      : reinterpret_cast< ::chat::PresenceRequest&>(::chat::_PresenceRequest_default_instance_);
+}
+inline const ::chat::PresenceRequest& Request::presence() const {
+  // @@protoc_insertion_point(field_get:chat.Request.presence)
+  return _internal_presence();
+}
+inline ::chat::PresenceRequest* Request::unsafe_arena_release_presence() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.presence)
+  if (_internal_has_presence()) {
+    clear_has_payload();
+    ::chat::PresenceRequest* temp = _impl_.payload_.presence_;
+    _impl_.payload_.presence_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_presence(::chat::PresenceRequest* presence) {
+  clear_payload();
+  if (presence) {
+    set_has_presence();
+    _impl_.payload_.presence_ = presence;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.presence)
+}
+inline ::chat::PresenceRequest* Request::_internal_mutable_presence() {
+  if (!_internal_has_presence()) {
+    clear_payload();
+    set_has_presence();
+    _impl_.payload_.presence_ = CreateMaybeMessage< ::chat::PresenceRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.presence_;
+}
+inline ::chat::PresenceRequest* Request::mutable_presence() {
+  ::chat::PresenceRequest* _msg = _internal_mutable_presence();
+  // @@protoc_insertion_point(field_mutable:chat.Request.presence)
+  return _msg;
+}
+
+// optional uint64 request_id = 11;
+inline bool Request::_internal_has_request_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Request::has_request_id() const {
+  return _internal_has_request_id();
+}
+inline void Request::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Request::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t Request::request_id() const {
+  // @@protoc_insertion_point(field_get:chat.Request.request_id)
+  return _internal_request_id();
+}
+inline void Request::_internal_set_request_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.request_id_ = value;
+}
+inline void Request::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:chat.Request.request_id)
+}
+
+inline bool Request::has_payload() const {
+  return payload_case() != PAYLOAD_NOT_SET;
+}
+inline void Request::clear_has_payload() {
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+inline Request::PayloadCase Request::payload_case() const {
+  return Request::PayloadCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// RequestBatch
+
+// repeated .chat.Request requests = 1;
+inline int RequestBatch::_internal_requests_size() const {
+  return _impl_.requests_.size();
+}
+inline int RequestBatch::requests_size() const {
+  return _internal_requests_size();
+}
+inline void RequestBatch::clear_requests() {
+  _impl_.requests_.Clear();
+}
+inline ::chat::Request* RequestBatch::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.RequestBatch.requests)
+  return _impl_.requests_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request >*
+RequestBatch::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:chat.RequestBatch.requests)
+  return &_impl_.requests_;
+}
+inline const ::chat::Request& RequestBatch::_internal_requests(int index) const {
+  return _impl_.requests_.Get(index);
+}
+inline const ::chat::Request& RequestBatch::requests(int index) const {
+  // @@protoc_insertion_point(field_get:chat.RequestBatch.requests)
+  return _internal_requests(index);
+}
+inline ::chat::Request* RequestBatch::_internal_add_requests() {
+  return _impl_.requests_.Add();
+}
+inline ::chat::Request* RequestBatch::add_requests() {
+  ::chat::Request* _add = _internal_add_requests();
+  // @@protoc_insertion_point(field_add:chat.RequestBatch.requests)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Request >&
+RequestBatch::requests() const {
+  // @@protoc_insertion_point(field_list:chat.RequestBatch.requests)
+  return _impl_.requests_;
+}
+
+// -------------------------------------------------------------------
+
+// ResponseBatch
+
+// repeated .chat.Response responses = 1;
+inline int ResponseBatch::_internal_responses_size() const {
+  return _impl_.responses_.size();
+}
+inline int ResponseBatch::responses_size() const {
+  return _internal_responses_size();
+}
+inline void ResponseBatch::clear_responses() {
+  _impl_.responses_.Clear();
+}
+inline ::chat::Response* ResponseBatch::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.ResponseBatch.responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response >*
+ResponseBatch::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:chat.ResponseBatch.responses)
+  return &_impl_.responses_;
+}
+inline const ::chat::Response& ResponseBatch::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const ::chat::Response& ResponseBatch::responses(int index) const {
+  // @@protoc_insertion_point(field_get:chat.ResponseBatch.responses)
+  return _internal_responses(index);
+}
+inline ::chat::Response* ResponseBatch::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::chat::Response* ResponseBatch::add_responses() {
+  ::chat::Response* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:chat.ResponseBatch.responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::Response >&
+ResponseBatch::responses() const {
+  // @@protoc_insertion_point(field_list:chat.ResponseBatch.responses)
+  return _impl_.responses_;
+}
+
+// -------------------------------------------------------------------
+
+// Response
+
+// .chat.Operation operation = 1;
+inline void Response::clear_operation() {
+  _impl_.operation_ = 0;
+}
+inline ::chat::Operation Response::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
+}
+inline ::chat::Operation Response::operation() const {
+  // @@protoc_insertion_point(field_get:chat.Response.operation)
+  return _internal_operation();
+}
+inline void Response::_internal_set_operation(::chat::Operation value) {
+  
+  _impl_.operation_ = value;
+}
+inline void Response::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.Response.operation)
+}
+
+// .chat.StatusCode status_code = 2;
+inline void Response::clear_status_code() {
+  _impl_.status_code_ = 0;
+}
+inline ::chat::StatusCode Response::_internal_status_code() const {
+  return static_cast< ::chat::StatusCode >(_impl_.status_code_);
+}
+inline ::chat::StatusCode Response::status_code() const {
+  // @@protoc_insertion_point(field_get:chat.Response.status_code)
+  return _internal_status_code();
+}
+inline void Response::_internal_set_status_code(::chat::StatusCode value) {
+  
+  _impl_.status_code_ = value;
+}
+inline void Response::set_status_code(::chat::StatusCode value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:chat.Response.status_code)
+}
+
+// string message = 3;
+inline void Response::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& Response::message() const {
+  // @@protoc_insertion_point(field_get:chat.Response.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.Response.message)
+}
+inline std::string* Response::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.Response.message)
+  return _s;
+}
+inline const std::string& Response::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void Response::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_message() {
+  // @@protoc_insertion_point(field_release:chat.Response.message)
+  return _impl_.message_.Release();
+}
+inline void Response::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.message)
+}
+
+// .chat.UserListResponse user_list = 4;
+inline bool Response::_internal_has_user_list() const {
+  return result_case() == kUserList;
+}
+inline bool Response::has_user_list() const {
+  return _internal_has_user_list();
+}
+inline void Response::set_has_user_list() {
+  _impl_._oneof_case_[0] = kUserList;
+}
+inline void Response::clear_user_list() {
+  if (_internal_has_user_list()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.user_list_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::UserListResponse* Response::release_user_list() {
+  // @@protoc_insertion_point(field_release:chat.Response.user_list)
+  if (_internal_has_user_list()) {
+    clear_has_result();
+    ::chat::UserListResponse* temp = _impl_.result_.user_list_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.user_list_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UserListResponse& Response::_internal_user_list() const {
+  return _internal_has_user_list()
+      ? *_impl_.result_.user_list_
+      : reinterpret_cast< ::chat::UserListResponse&>(::chat::_UserListResponse_default_instance_);
+}
+inline const ::chat::UserListResponse& Response::user_list() const {
+  // @@protoc_insertion_point(field_get:chat.Response.user_list)
+  return _internal_user_list();
+}
+inline ::chat::UserListResponse* Response::unsafe_arena_release_user_list() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.user_list)
+  if (_internal_has_user_list()) {
+    clear_has_result();
+    ::chat::UserListResponse* temp = _impl_.result_.user_list_;
+    _impl_.result_.user_list_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_user_list(::chat::UserListResponse* user_list) {
+  clear_result();
+  if (user_list) {
+    set_has_user_list();
+    _impl_.result_.user_list_ = user_list;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.user_list)
+}
+inline ::chat::UserListResponse* Response::_internal_mutable_user_list() {
+  if (!_internal_has_user_list()) {
+    clear_result();
+    set_has_user_list();
+    _impl_.result_.user_list_ = CreateMaybeMessage< ::chat::UserListResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.user_list_;
+}
+inline ::chat::UserListResponse* Response::mutable_user_list() {
+  ::chat::UserListResponse* _msg = _internal_mutable_user_list();
+  // @@protoc_insertion_point(field_mutable:chat.Response.user_list)
+  return _msg;
+}
+
+// .chat.IncomingMessageResponse incoming_message = 5;
+inline bool Response::_internal_has_incoming_message() const {
+  return result_case() == kIncomingMessage;
+}
+inline bool Response::has_incoming_message() const {
+  return _internal_has_incoming_message();
+}
+inline void Response::set_has_incoming_message() {
+  _impl_._oneof_case_[0] = kIncomingMessage;
+}
+inline void Response::clear_incoming_message() {
+  if (_internal_has_incoming_message()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.incoming_message_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::IncomingMessageResponse* Response::release_incoming_message() {
+  // @@protoc_insertion_point(field_release:chat.Response.incoming_message)
+  if (_internal_has_incoming_message()) {
+    clear_has_result();
+    ::chat::IncomingMessageResponse* temp = _impl_.result_.incoming_message_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.incoming_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::IncomingMessageResponse& Response::_internal_incoming_message() const {
+  return _internal_has_incoming_message()
+      ? *_impl_.result_.incoming_message_
+      : reinterpret_cast< ::chat::IncomingMessageResponse&>(::chat::_IncomingMessageResponse_default_instance_);
+}
+inline const ::chat::IncomingMessageResponse& Response::incoming_message() const {
+  // @@protoc_insertion_point(field_get:chat.Response.incoming_message)
+  return _internal_incoming_message();
+}
+inline ::chat::IncomingMessageResponse* Response::unsafe_arena_release_incoming_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.incoming_message)
+  if (_internal_has_incoming_message()) {
+    clear_has_result();
+    ::chat::IncomingMessageResponse* temp = _impl_.result_.incoming_message_;
+    _impl_.result_.incoming_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
+  clear_result();
+  if (incoming_message) {
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = incoming_message;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.incoming_message)
+}
+inline ::chat::IncomingMessageResponse* Response::_internal_mutable_incoming_message() {
+  if (!_internal_has_incoming_message()) {
+    clear_result();
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = CreateMaybeMessage< ::chat::IncomingMessageResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.incoming_message_;
+}
+inline ::chat::IncomingMessageResponse* Response::mutable_incoming_message() {
+  ::chat::IncomingMessageResponse* _msg = _internal_mutable_incoming_message();
+  // @@protoc_insertion_point(field_mutable:chat.Response.incoming_message)
+  return _msg;
+}
+
+// .chat.HistoryResponse history = 6;
+inline bool Response::_internal_has_history() const {
+  return result_case() == kHistory;
+}
+inline bool Response::has_history() const {
+  return _internal_has_history();
+}
+inline void Response::set_has_history() {
+  _impl_._oneof_case_[0] = kHistory;
+}
+inline void Response::clear_history() {
+  if (_internal_has_history()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.history_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::HistoryResponse* Response::release_history() {
+  // @@protoc_insertion_point(field_release:chat.Response.history)
+  if (_internal_has_history()) {
+    clear_has_result();
+    ::chat::HistoryResponse* temp = _impl_.result_.history_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.history_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::HistoryResponse& Response::_internal_history() const {
+  return _internal_has_history()
+      ? *_impl_.result_.history_
+      : reinterpret_cast< ::chat::HistoryResponse&>(::chat::_HistoryResponse_default_instance_);
+}
+inline const ::chat::HistoryResponse& Response::history() const {
+  // @@protoc_insertion_point(field_get:chat.Response.history)
+  return _internal_history();
+}
+inline ::chat::HistoryResponse* Response::unsafe_arena_release_history() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.history)
+  if (_internal_has_history()) {
+    clear_has_result();
+    ::chat::HistoryResponse* temp = _impl_.result_.history_;
+    _impl_.result_.history_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_history(::chat::HistoryResponse* history) {
+  clear_result();
+  if (history) {
+    set_has_history();
+    _impl_.result_.history_ = history;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.history)
+}
+inline ::chat::HistoryResponse* Response::_internal_mutable_history() {
+  if (!_internal_has_history()) {
+    clear_result();
+    set_has_history();
+    _impl_.result_.history_ = CreateMaybeMessage< ::chat::HistoryResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.history_;
+}
+inline ::chat::HistoryResponse* Response::mutable_history() {
+  ::chat::HistoryResponse* _msg = _internal_mutable_history();
+  // @@protoc_insertion_point(field_mutable:chat.Response.history)
+  return _msg;
+}
+
+// .chat.ChannelResponse channel = 8;
+inline bool Response::_internal_has_channel() const {
+  return result_case() == kChannel;
+}
+inline bool Response::has_channel() const {
+  return _internal_has_channel();
+}
+inline void Response::set_has_channel() {
+  _impl_._oneof_case_[0] = kChannel;
+}
+inline void Response::clear_channel() {
+  if (_internal_has_channel()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.channel_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::ChannelResponse* Response::release_channel() {
+  // @@protoc_insertion_point(field_release:chat.Response.channel)
+  if (_internal_has_channel()) {
+    clear_has_result();
+    ::chat::ChannelResponse* temp = _impl_.result_.channel_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.channel_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::ChannelResponse& Response::_internal_channel() const {
+  return _internal_has_channel()
+      ? *_impl_.result_.channel_
+      : reinterpret_cast< ::chat::ChannelResponse&>(::chat::_ChannelResponse_default_instance_);
+}
+inline const ::chat::ChannelResponse& Response::channel() const {
+  // @@protoc_insertion_point(field_get:chat.Response.channel)
+  return _internal_channel();
+}
+inline ::chat::ChannelResponse* Response::unsafe_arena_release_channel() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.channel)
+  if (_internal_has_channel()) {
+    clear_has_result();
+    ::chat::ChannelResponse* temp = _impl_.result_.channel_;
+    _impl_.result_.channel_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_channel(::chat::ChannelResponse* channel) {
+  clear_result();
+  if (channel) {
+    set_has_channel();
+    _impl_.result_.channel_ = channel;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.channel)
+}
+inline ::chat::ChannelResponse* Response::_internal_mutable_channel() {
+  if (!_internal_has_channel()) {
+    clear_result();
+    set_has_channel();
+    _impl_.result_.channel_ = CreateMaybeMessage< ::chat::ChannelResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.channel_;
+}
+inline ::chat::ChannelResponse* Response::mutable_channel() {
+  ::chat::ChannelResponse* _msg = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:chat.Response.channel)
+  return _msg;
+}
+
+// .chat.PresenceUpdate presence = 9;
+inline bool Response::_internal_has_presence() const {
+  return result_case() == kPresence;
+}
+inline bool Response::has_presence() const {
+  return _internal_has_presence();
+}
+inline void Response::set_has_presence() {
+  _impl_._oneof_case_[0] = kPresence;
+}
+inline void Response::clear_presence() {
+  if (_internal_has_presence()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.presence_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::PresenceUpdate* Response::release_presence() {
+  // @@protoc_insertion_point(field_release:chat.Response.presence)
+  if (_internal_has_presence()) {
+    clear_has_result();
+    ::chat::PresenceUpdate* temp = _impl_.result_.presence_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.presence_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::PresenceUpdate& Response::_internal_presence() const {
+  return _internal_has_presence()
+      ? *_impl_.result_.presence_
+      : reinterpret_cast< ::chat::PresenceUpdate&>(::chat::_PresenceUpdate_default_instance_);
+}
+inline const ::chat::PresenceUpdate& Response::presence() const {
+  // @@protoc_insertion_point(field_get:chat.Response.presence)
+  return _internal_presence();
+}
+inline ::chat::PresenceUpdate* Response::unsafe_arena_release_presence() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.presence)
+  if (_internal_has_presence()) {
+    clear_has_result();
+    ::chat::PresenceUpdate* temp = _impl_.result_.presence_;
+    _impl_.result_.presence_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_presence(::chat::PresenceUpdate* presence) {
+  clear_result();
+  if (presence) {
+    set_has_presence();
+    _impl_.result_.presence_ = presence;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.presence)
+}
+inline ::chat::PresenceUpdate* Response::_internal_mutable_presence() {
+  if (!_internal_has_presence()) {
+    clear_result();
+    set_has_presence();
+    _impl_.result_.presence_ = CreateMaybeMessage< ::chat::PresenceUpdate >(GetArenaForAllocation());
+  }
+  return _impl_.result_.presence_;
+}
+inline ::chat::PresenceUpdate* Response::mutable_presence() {
+  ::chat::PresenceUpdate* _msg = _internal_mutable_presence();
+  // @@protoc_insertion_point(field_mutable:chat.Response.presence)
+  return _msg;
+}
+
+// .chat.StatsResponse stats = 10;
+inline bool Response::_internal_has_stats() const {
+  return result_case() == kStats;
+}
+inline bool Response::has_stats() const {
+  return _internal_has_stats();
+}
+inline void Response::set_has_stats() {
+  _impl_._oneof_case_[0] = kStats;
+}
+inline void Response::clear_stats() {
+  if (_internal_has_stats()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.stats_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::StatsResponse* Response::release_stats() {
+  // @@protoc_insertion_point(field_release:chat.Response.stats)
+  if (_internal_has_stats()) {
+    clear_has_result();
+    ::chat::StatsResponse* temp = _impl_.result_.stats_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.stats_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::StatsResponse& Response::_internal_stats() const {
+  return _internal_has_stats()
+      ? *_impl_.result_.stats_
+      : reinterpret_cast< ::chat::StatsResponse&>(::chat::_StatsResponse_default_instance_);
+}
+inline const ::chat::StatsResponse& Response::stats() const {
+  // @@protoc_insertion_point(field_get:chat.Response.stats)
+  return _internal_stats();
+}
+inline ::chat::StatsResponse* Response::unsafe_arena_release_stats() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.stats)
+  if (_internal_has_stats()) {
+    clear_has_result();
+    ::chat::StatsResponse* temp = _impl_.result_.stats_;
+    _impl_.result_.stats_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_stats(::chat::StatsResponse* stats) {
+  clear_result();
+  if (stats) {
+    set_has_stats();
+    _impl_.result_.stats_ = stats;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.stats)
+}
+inline ::chat::StatsResponse* Response::_internal_mutable_stats() {
+  if (!_internal_has_stats()) {
+    clear_result();
+    set_has_stats();
+    _impl_.result_.stats_ = CreateMaybeMessage< ::chat::StatsResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.stats_;
+}
+inline ::chat::StatsResponse* Response::mutable_stats() {
+  ::chat::StatsResponse* _msg = _internal_mutable_stats();
+  // @@protoc_insertion_point(field_mutable:chat.Response.stats)
+  return _msg;
+}
+
+// .chat.Compression compression = 7;
+inline void Response::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::chat::Compression Response::_internal_compression() const {
+  return static_cast< ::chat::Compression >(_impl_.compression_);
+}
+inline ::chat::Compression Response::compression() const {
+  // @@protoc_insertion_point(field_get:chat.Response.compression)
+  return _internal_compression();
+}
+inline void Response::_internal_set_compression(::chat::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void Response::set_compression(::chat::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:chat.Response.compression)
+}
+
+// optional uint64 request_id = 11;
+inline bool Response::_internal_has_request_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Response::has_request_id() const {
+  return _internal_has_request_id();
+}
+inline void Response::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Response::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t Response::request_id() const {
+  // @@protoc_insertion_point(field_get:chat.Response.request_id)
+  return _internal_request_id();
+}
+inline void Response::_internal_set_request_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.request_id_ = value;
+}
+inline void Response::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:chat.Response.request_id)
+}
+
+// optional .chat.UserStatus new_status = 12;
+inline bool Response::_internal_has_new_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Response::has_new_status() const {
+  return _internal_has_new_status();
+}
+inline void Response::clear_new_status() {
+  _impl_.new_status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::chat::UserStatus Response::_internal_new_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.new_status_);
+}
+inline ::chat::UserStatus Response::new_status() const {
+  // @@protoc_insertion_point(field_get:chat.Response.new_status)
+  return _internal_new_status();
+}
+inline void Response::_internal_set_new_status(::chat::UserStatus value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.new_status_ = value;
+}
+inline void Response::set_new_status(::chat::UserStatus value) {
+  _internal_set_new_status(value);
+  // @@protoc_insertion_point(field_set:chat.Response.new_status)
+}
+
+inline bool Response::has_result() const {
+  return result_case() != RESULT_NOT_SET;
+}
+inline void Response::clear_has_result() {
+  _impl_._oneof_case_[0] = RESULT_NOT_SET;
+}
+inline Response::ResultCase Response::result_case() const {
+  return Response::ResultCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace chat
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::chat::UserStatus> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::UserStatus>() {
+  return ::chat::UserStatus_descriptor();
+}
+template <> struct is_proto_enum< ::chat::Compression> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::Compression>() {
+  return ::chat::Compression_descriptor();
+}
+template <> struct is_proto_enum< ::chat::MessageType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::MessageType>() {
+  return ::chat::MessageType_descriptor();
+}
+template <> struct is_proto_enum< ::chat::UserListType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::UserListType>() {
+  return ::chat::UserListType_descriptor();
+}
+template <> struct is_proto_enum< ::chat::Operation> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::Operation>() {
+  return ::chat::Operation_descriptor();
+}
+template <> struct is_proto_enum< ::chat::PresenceChange> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::PresenceChange>() {
+  return ::chat::PresenceChange_descriptor();
+}
+template <> struct is_proto_enum< ::chat::StatusCode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::StatusCode>() {
+  return ::chat::StatusCode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_chat_2eproto
@@ -1,55 +1,302 @@
 // message_util.cpp
 #include "./message.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <zlib.h>
+
+// Nivel de zlib. El mas rapido ya reduce mucho el texto de los chats y las
+// listas de usuarios, y no le quita tiempo al ciclo de eventos
+constexpr int CompressionLevel = 1;
+
+void writeFrameHeader(char *out, uint32_t size, uint8_t flags) {
+    uint32_t header = htonl((static_cast<uint32_t>(flags) << FrameFlagsShift) | (size & FrameSizeMask));
+    std::memcpy(out, &header, FrameHeaderSize);
+}
+
 /**
- * Funcion para manejar el envio de mensajes entre el servidor y el cliente
- * 
- * @param socket Socket a donde se enviar el mensaje
- * @param message Mensaje a enviar
-*/
-bool sendMessage(int socket, const google::protobuf::Message& message) {
-    // Serialize the message to a string
-    std::string serializedMessage = message.SerializeAsString();
+ * Agrega a out el frame comprimido de un payload
+ *
+ * @return false si comprimido no queda mas chico o no cabe en un frame, en ese caso out no cambia
+ */
+static bool appendCompressed(std::string &out, std::string_view payload, uint8_t flags) {
+    size_t offset = out.size();
+    uLongf length = compressBound(payload.size());
+    out.resize(offset + FrameHeaderSize + length);
+    int result = compress2(reinterpret_cast<Bytef *>(out.data() + offset + FrameHeaderSize), &length,
+                           reinterpret_cast<const Bytef *>(payload.data()), payload.size(), CompressionLevel);
+    if (result != Z_OK || length >= payload.size() || length > MaxFrameSize) {
+        out.resize(offset);
+        return false;
+    }
+    out.resize(offset + FrameHeaderSize + length);
+    writeFrameHeader(out.data() + offset, length, flags | FrameFlagCompressed);
+    return true;
+}
 
-    if (serializedMessage.size() > BufferSize) {
+bool appendFrame(std::string &out, const google::protobuf::Message &message, uint8_t flags, size_t compressAbove) {
+    size_t size = message.ByteSizeLong();
+    if (compressAbove != 0 && size >= compressAbove) {
+        if (size > MaxMessageSize) {
+            std::cerr << "El mensaje es muy grande" << std::endl;
+            return false;
+        }
+        // Se serializa aparte porque el frame lleva los bytes comprimidos
+        thread_local std::string plain;
+        plain.resize(size);
+        message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(plain.data()));
+        if (appendCompressed(out, plain, flags)) {
+            return true;
+        }
+        if (size > MaxFrameSize) {
+            std::cerr << "El mensaje es muy grande" << std::endl;
+            return false;
+        }
+        size_t offset = out.size();
+        out.resize(offset + FrameHeaderSize);
+        writeFrameHeader(out.data() + offset, size, flags);
+        out.append(plain);
+        return true;
+    }
+    if (size > MaxFrameSize) {
         std::cerr << "El mensaje es muy grande" << std::endl;
         return false;
     }
 
-    // Send the size of the message
-    ssize_t bytesSent = send(socket, serializedMessage.data(), serializedMessage.size(), 0);
-    if (bytesSent < 0) {
-        std::cerr << "Error al enviar el mensaje" << std::endl;
+    // Serializamos directamente despues del header, sin string intermedio
+    size_t offset = out.size();
+    out.resize(offset + FrameHeaderSize + size);
+    writeFrameHeader(out.data() + offset, size, flags);
+    message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(out.data() + offset + FrameHeaderSize));
+    return true;
+}
+
+SharedFrame encodeFrame(const google::protobuf::Message &message, uint8_t flags, size_t compressAbove) {
+    auto frame = std::make_shared<std::string>();
+    if (!appendFrame(*frame, message, flags, compressAbove)) {
+        return nullptr;
+    }
+    return frame;
+}
+
+SharedFrame compressFrame(const SharedFrame &frame, size_t compressAbove) {
+    if (!frame || compressAbove == 0 || frame->size() < FrameHeaderSize + compressAbove) {
+        return frame;
+    }
+    uint32_t header;
+    std::memcpy(&header, frame->data(), FrameHeaderSize);
+    uint8_t flags = static_cast<uint8_t>(ntohl(header) >> FrameFlagsShift);
+    if (flags & FrameFlagCompressed) {
+        return frame;
+    }
+    std::string_view payload(frame->data() + FrameHeaderSize, frame->size() - FrameHeaderSize);
+    auto compressed = std::make_shared<std::string>();
+    if (!appendCompressed(*compressed, payload, flags)) {
+        return frame;
+    }
+    return compressed;
+}
+
+bool decompressPayload(std::string_view payload, std::string &out, size_t maxSize) {
+    z_stream stream{};
+    if (inflateInit(&stream) != Z_OK) {
         return false;
-    } else if (bytesSent < serializedMessage.size()) {
-        std::cerr << "No se envio toda la data" << std::endl;
+    }
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(payload.data()));
+    stream.avail_in = payload.size();
+
+    // El tamaño original no viaja en el frame, el buffer crece hasta pasar maxSize por un byte
+    size_t limit = maxSize + 1;
+    size_t capacity = std::min(limit, std::max<size_t>(payload.size() * 4, 1024));
+    int result;
+    while (true) {
+        out.resize(capacity);
+        stream.next_out = reinterpret_cast<Bytef *>(out.data() + stream.total_out);
+        stream.avail_out = capacity - stream.total_out;
+        result = inflate(&stream, Z_NO_FLUSH);
+        if (result != Z_OK && result != Z_BUF_ERROR) {
+            break;
+        }
+        // Si quedo espacio sin terminar el stream los datos estan truncados,
+        // y si se lleno el limite el payload original es demasiado grande
+        if (stream.avail_out > 0 || capacity == limit) {
+            result = Z_DATA_ERROR;
+            break;
+        }
+        capacity = std::min(limit, capacity * 2);
+    }
+    size_t size = stream.total_out;
+    bool complete = result == Z_STREAM_END && stream.avail_in == 0 && size <= maxSize;
+    inflateEnd(&stream);
+    out.resize(complete ? size : 0);
+    return complete;
+}
+
+FrameBuffer::FrameBuffer(size_t initialCapacity) : data(initialCapacity) {}
+
+void FrameBuffer::reserve(size_t minFree) {
+    if (data.size() - writePos >= minFree) {
+        return;
+    }
+    // Primero movemos lo pendiente al inicio para reutilizar lo ya consumido
+    if (readPos > 0) {
+        std::memmove(data.data(), data.data() + readPos, writePos - readPos);
+        writePos -= readPos;
+        readPos = 0;
+    }
+    if (data.size() - writePos < minFree) {
+        data.resize(std::max(data.size() * 2, writePos + minFree));
+    }
+}
+
+ssize_t FrameBuffer::readFrom(int socket) {
+    // Si el buffer esta vacio volvemos al inicio sin copiar nada
+    if (readPos == writePos) {
+        readPos = writePos = 0;
+    }
+    reserve(1024);
+
+    ssize_t bytesRead;
+    do {
+        bytesRead = recv(socket, data.data() + writePos, data.size() - writePos, 0);
+    } while (bytesRead < 0 && errno == EINTR);
+
+    if (bytesRead > 0) {
+        writePos += bytesRead;
+    }
+    return bytesRead;
+}
+
+void FrameBuffer::append(const char *bytes, size_t size) {
+    if (readPos == writePos) {
+        readPos = writePos = 0;
+    }
+    reserve(size);
+    std::memcpy(data.data() + writePos, bytes, size);
+    writePos += size;
+}
+
+FrameBuffer::Status FrameBuffer::nextFrame(std::string_view &payload, uint8_t &flags) {
+    size_t available = writePos - readPos;
+    if (available < FrameHeaderSize) {
+        return Status::Incomplete;
+    }
+
+    uint32_t header;
+    std::memcpy(&header, data.data() + readPos, FrameHeaderSize);
+    header = ntohl(header);
+    size_t size = header & FrameSizeMask;
+    // Se rechaza con solo leer el header, sin esperar el resto del frame
+    if (size > MaxFrameSize) {
+        return Status::Invalid;
+    }
+    if (available < FrameHeaderSize + size) {
+        // Dejamos espacio para que la siguiente lectura complete el frame
+        reserve(FrameHeaderSize + size - available);
+        return Status::Incomplete;
+    }
+
+    flags = static_cast<uint8_t>(header >> FrameFlagsShift);
+    payload = std::string_view(data.data() + readPos + FrameHeaderSize, size);
+    readPos += FrameHeaderSize + size;
+    return Status::Complete;
+}
+
+/**
+ * Funcion para manejar el envio de mensajes entre el servidor y el cliente
+ *
+ * @param socket Socket a donde se enviar el mensaje
+ * @param message Mensaje a enviar
+ * @param compressAbove Tamaño desde el que se comprime, 0 para no comprimir
+*/
+bool sendMessage(int socket, const google::protobuf::Message& message, size_t compressAbove) {
+    // Serialize the message with its size header
+    std::string frame;
+    if (!appendFrame(frame, message, 0, compressAbove)) {
         return false;
     }
 
+    // Keep sending until the whole frame is out, send may write only part of it
+    size_t sent = 0;
+    while (sent < frame.size()) {
+        ssize_t bytesSent = send(socket, frame.data() + sent, frame.size() - sent, MSG_NOSIGNAL);
+        if (bytesSent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "Error al enviar el mensaje" << std::endl;
+            return false;
+        }
+        sent += bytesSent;
+    }
+
+    return true;
+}
+
+/**
+ * Lee exactamente size bytes del socket
+ */
+static bool receiveExact(int socket, char *buffer, size_t size) {
+    size_t received = 0;
+    while (received < size) {
+        ssize_t bytesRead = recv(socket, buffer + received, size - received, MSG_WAITALL);
+        if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytesRead <= 0) {
+            return false;
+        }
+        received += bytesRead;
+    }
     return true;
 }
 
 /**
  * Funcion para manejar el recibir de mensajes entre el servidor y el cliente
- * 
+ *
  * @param socket Socket a donde se enviar el mensaje
  * @param message Mensaje a recibir
 */
 bool receiveMessage(int socket, google::protobuf::Message& message) {
     // Receive the size of the message
-    std::vector<char> buffer(BufferSize);
+    char headerBytes[FrameHeaderSize];
+    if (!receiveExact(socket, headerBytes, FrameHeaderSize)) {
+        std::cerr << "Error al recibir el mensaje" << std::endl;
+        return false;
+    }
+    uint32_t header;
+    std::memcpy(&header, headerBytes, FrameHeaderSize);
+    size_t size = ntohl(header) & FrameSizeMask;
+    if (size > MaxFrameSize) {
+        std::cerr << "El mensaje es muy grande" << std::endl;
+        return false;
+    }
 
-    ssize_t bytesRead = recv(socket, buffer.data(), buffer.size(), 0);
-    if (bytesRead < 0) {
+    // Only the bytes of this frame are read, so the next frame stays in the socket
+    thread_local std::vector<char> buffer(BufferSize);
+    if (!receiveExact(socket, buffer.data(), size)) {
         std::cerr << "Error al recibir el mensaje" << std::endl;
         return false;
     }
 
+    // Compressed frames are expanded before parsing
+    std::string_view payload(buffer.data(), size);
+    if ((ntohl(header) >> FrameFlagsShift) & FrameFlagCompressed) {
+        thread_local std::string expanded;
+        if (!decompressPayload(payload, expanded, MaxMessageSize)) {
+            std::cerr << "Error al descomprimir el mensaje" << std::endl;
+            return false;
+        }
+        payload = expanded;
+    }
+
     // Parse the received message using protobuf
-    if (!message.ParseFromArray(buffer.data(), bytesRead)) {
+    if (!message.ParseFromArray(payload.data(), payload.size())) {
         std::cerr << "Error al parsear el mensaje" << std::endl;
         return false;
     }
 
     return true;
-}
\ No newline at end of file
+}
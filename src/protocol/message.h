@@ -2,8 +2,10 @@
 #ifndef MESSAGE_UTIL_H
 #define MESSAGE_UTIL_H
 
+#include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cstdint>                   // For uint32_t
 #include <sys/types.h>               // For ssize_t
 #include <sys/socket.h>              // For send, recv, and MSG_WAITALL
@@ -13,20 +15,147 @@
 // Indicating the static size of the buffer
 constexpr size_t BufferSize = 64 * 1024;
 
+// Each frame is a big-endian uint32 header followed by the payload.
+// The low 24 bits of the header hold the payload size and the high 8 bits are flags.
+constexpr size_t FrameHeaderSize = 4;
+constexpr uint32_t FrameSizeMask = 0x00FFFFFF;
+constexpr int FrameFlagsShift = 24;
+
+// Largest payload accepted in a single frame
+constexpr size_t MaxFrameSize = BufferSize;
+
+// Frame flags
+constexpr uint8_t FrameFlagBatch = 0x01;      // The payload is a RequestBatch or ResponseBatch
+constexpr uint8_t FrameFlagCompressed = 0x02; // The payload is compressed with zlib
+
+// Largest payload a compressed frame may expand to. The compressed bytes still
+// have to fit in MaxFrameSize.
+constexpr size_t MaxMessageSize = 16 * BufferSize;
+
+// Payloads smaller than this are sent uncompressed, they barely shrink
+constexpr size_t DefaultCompressionThreshold = 1024;
+
+/**
+ * Escribe el header de un frame
+ *
+ * @param out Destino de 4 bytes
+ * @param size Tamaño del payload
+ * @param flags Flags del frame
+ */
+void writeFrameHeader(char *out, uint32_t size, uint8_t flags = 0);
+
+/**
+ * Serializa un mensaje como frame al final de un string. Con compressAbove
+ * distinto de 0 los mensajes de ese tamaño o mas se comprimen, siempre que
+ * queden mas chicos, y pueden llegar hasta MaxMessageSize.
+ *
+ * @param out String donde se agrega el frame
+ * @param message Mensaje a serializar
+ * @param flags Flags del header del frame
+ * @param compressAbove Tamaño desde el que se comprime, 0 para no comprimir
+ * @return false si el mensaje no cabe en un frame
+ */
+bool appendFrame(std::string &out, const google::protobuf::Message &message, uint8_t flags = 0,
+                 size_t compressAbove = 0);
+
+// Frame ya serializado e inmutable, se comparte entre todos los destinatarios
+using SharedFrame = std::shared_ptr<const std::string>;
+
+/**
+ * Serializa un mensaje como frame una sola vez para poder enviarlo a varios sockets
+ *
+ * @param message Mensaje a serializar
+ * @param flags Flags del header del frame
+ * @param compressAbove Tamaño desde el que se comprime, 0 para no comprimir
+ * @return El frame, o nullptr si el mensaje no cabe en un frame
+ */
+SharedFrame encodeFrame(const google::protobuf::Message &message, uint8_t flags = 0, size_t compressAbove = 0);
+
+/**
+ * Version comprimida de un frame ya serializado, para los destinatarios que
+ * negociaron compresion. Se calcula una vez y se comparte como el original.
+ *
+ * @param frame Frame sin comprimir
+ * @param compressAbove Tamaño del payload desde el que se comprime
+ * @return El frame comprimido, o el mismo frame si es chico o no se reduce
+ */
+SharedFrame compressFrame(const SharedFrame &frame, size_t compressAbove);
+
+/**
+ * Descomprime el payload de un frame con FrameFlagCompressed
+ *
+ * @param payload Bytes comprimidos
+ * @param out String donde queda el payload original
+ * @param maxSize Tamaño maximo aceptado del payload original
+ * @return false si los datos no son validos o pasan de maxSize
+ */
+bool decompressPayload(std::string_view payload, std::string &out, size_t maxSize);
+
+/**
+ * Buffer de entrada reutilizable por conexion. Acumula lo que llega del
+ * socket y va entregando frames completos, aunque un frame llegue partido
+ * en varias lecturas o varias frames lleguen en una sola.
+ */
+class FrameBuffer {
+public:
+    enum class Status {
+        Complete,   // Hay un frame completo en payload
+        Incomplete, // Faltan bytes, hay que leer mas del socket
+        Invalid     // El header anuncia un frame mas grande que MaxFrameSize
+    };
+
+    explicit FrameBuffer(size_t initialCapacity = 4096);
+
+    /**
+     * Hace un recv en el espacio libre del buffer
+     *
+     * @param socket Socket a leer
+     * @return Lo mismo que recv: bytes leidos, 0 si se cerro, -1 si hubo error
+     */
+    ssize_t readFrom(int socket);
+
+    /**
+     * Agrega bytes al buffer (para cuando los datos no vienen de un socket)
+     */
+    void append(const char *data, size_t size);
+
+    /**
+     * Extrae el siguiente frame completo. El payload apunta al interior del
+     * buffer y es valido hasta la siguiente llamada a cualquier otro metodo.
+     *
+     * @param payload Bytes del frame sin el header
+     * @param flags Flags del header del frame
+     */
+    Status nextFrame(std::string_view &payload, uint8_t &flags);
+
+    // Cantidad de bytes recibidos que aun no se han consumido
+    size_t pending() const { return writePos - readPos; }
+
+private:
+    // Asegura que haya espacio libre para al menos minFree bytes
+    void reserve(size_t minFree);
+
+    std::vector<char> data;
+    size_t readPos = 0;
+    size_t writePos = 0;
+};
+
 /**
  * Funcion para manejar el envio de mensajes entre el servidor y el cliente
- * 
+ *
  * @param socket Socket a donde se enviar el mensaje
  * @param message Mensaje a enviar
+ * @param compressAbove Tamaño desde el que se comprime, 0 para no comprimir
 */
-bool sendMessage(int socket, const google::protobuf::Message &message);
+bool sendMessage(int socket, const google::protobuf::Message &message, size_t compressAbove = 0);
 
 /**
- * Funcion para manejar el recibir de mensajes entre el servidor y el cliente
- * 
+ * Funcion para manejar el recibir de mensajes entre el servidor y el cliente.
+ * Los frames comprimidos se descomprimen antes de parsearlos.
+ *
  * @param socket Socket a donde se enviar el mensaje
  * @param message Mensaje a recibir
 */
 bool receiveMessage(int socket, google::protobuf::Message &message);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,53 @@
+// message_arena.h
+#ifndef MESSAGE_ARENA_H
+#define MESSAGE_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <google/protobuf/arena.h>
+
+/**
+ * Arena de protobuf para los mensajes de un request. Los requests, las
+ * respuestas y sus strings se crean en el arena y se liberan todos juntos
+ * con reset() al terminar el request, en lugar de pedir y liberar memoria
+ * del heap por cada campo. El primer bloque es propio y sobrevive a reset(),
+ * asi un request normal no hace ninguna llamada a malloc.
+ */
+class MessageArena {
+public:
+    /**
+     * @param initialBlockSize Tamaño del bloque que se reutiliza entre requests
+     */
+    explicit MessageArena(size_t initialBlockSize = 16 * 1024)
+        : initialBlock(new char[initialBlockSize]), arena(optionsFor(initialBlock.get(), initialBlockSize)) {}
+
+    MessageArena(const MessageArena&) = delete;
+    MessageArena& operator=(const MessageArena&) = delete;
+
+    /**
+     * Crea un mensaje en el arena, es valido hasta el siguiente reset()
+     */
+    template<typename T>
+    T* create() {
+        return google::protobuf::Arena::CreateMessage<T>(&arena);
+    }
+
+    /**
+     * Libera todos los mensajes del arena. Los bloques extra que se pidieron
+     * para requests grandes vuelven al heap, el primer bloque se conserva.
+     */
+    void reset() { arena.Reset(); }
+
+private:
+    static google::protobuf::ArenaOptions optionsFor(char* block, size_t size) {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = block;
+        options.initial_block_size = size;
+        return options;
+    }
+
+    std::unique_ptr<char[]> initialBlock;
+    google::protobuf::Arena arena;
+};
+
+#endif
@@ -1,26 +1,427 @@
-#include <iostream>
 #include <string>
+#include <cstring>
+#include <memory>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
-#include <deque>
+#include <algorithm>
 #include <thread>
-#include <mutex>
+#include <utility>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <unistd.h>
-#include "protocol/message.h" 
-#include "protocol/chat.pb.h"  
+#include "protocol/message.h"
+#include "protocol/chat.pb.h"
+#include "server/reactor.h"
+#include "server/connection.h"
+#include "server/config.h"
+#include "server/session_registry.h"
+#include "server/worker.h"
+#include "server/history_log.h"
+#include "server/broadcast_ring.h"
+#include "server/channel_index.h"
+#include "server/presence_feed.h"
+#include "server/metrics.h"
+#include "server/logger.h"
 
-std::vector<std::thread> clientThreads; // Vector donde se almacenan los threads de los clientes
-std::deque<std::string> messagesBroadcast; // Variable donde almacenamos todos los mensajes en broadcast 
-std::unordered_map<std::string, chat::UserStatus> usersState; // Variable donde almacenamos el status de los usuarios
-std::unordered_map<std::string, int> userSockets; // Variable donde almacenamos los sockets de los usuarios
-std::unordered_map<std::string, std::string> ipsUsers; // Variable donde almacenamos las ips de los usuarios
-std::mutex clientsMutex; // Mutex para proteger las variables compartidas
-std::unordered_map<std::string, int> usersTiming; // Variable donde almacenamos el tiempo de inactividad de los usuarios
-int waitTime = 60; // Variable donde se guarda el tiempo de inactividad predeterminado
+ServerConfig config; // Configuracion del servidor leida de la linea de comandos
+std::vector<std::unique_ptr<Worker>> workers; // Hilos del servidor, cada uno con su reactor y sus conexiones
+SessionRegistry sessions; // Registro de usuarios con su socket, status, IP y ultima actividad
+HistoryLog history; // Log en disco con los mensajes enviados, asigna el offset de cada mensaje
+BroadcastRing recentBroadcasts; // Ultimos broadcasts serializados, para ponerse al dia al reconectarse
+ChannelDirectory channelDirectory; // Workers con suscriptores de cada canal
+PresenceFeed presence; // Cambios de presencia con su version, se empujan a los suscriptores
+Metrics metrics; // Contadores e histogramas de cada worker, se exportan con STATS y --metrics-port
+
+// Tamaño de la cola de envio del io_uring de cada worker
+constexpr unsigned RingEntries = 4096;
+
+// Limite de mensajes que se devuelven en un GET_HISTORY
+constexpr size_t MaxHistoryMessages = 1000;
+// Limite de bytes que se devuelven en un GET_HISTORY
+constexpr size_t MaxHistoryBytes = 1024 * 1024;
+// Largo maximo del nombre de un canal
+constexpr size_t MaxChannelName = 64;
+// Canales a los que puede estar suscrito un usuario
+constexpr size_t MaxChannelsPerUser = 64;
+// Tamaño aproximado de los cambios de presencia que se ponen en un frame
+constexpr size_t MaxPresenceFrameBytes = MaxFrameSize / 2;
+// Usuarios por pagina de GET_USERS
+constexpr size_t MaxUsersPage = 1000;
+// Espera antes de volver a aceptar conexiones cuando se acabaron los descriptores
+constexpr std::chrono::milliseconds AcceptBackoff{100};
+// Tamaño aproximado de los usuarios que se ponen en una pagina de GET_USERS
+constexpr size_t MaxUsersPageBytes = MaxFrameSize / 2;
+
+void closeConnection(int clientSocket);
+bool processFrames(Connection& connection);
+void updateInterest(Connection& connection);
+
+/**
+ * Crea un mensaje protobuf en el arena del worker actual. El arena se libera
+ * al terminar el request que se esta procesando, el mensaje no debe usarse
+ * despues de eso.
+ */
+template<typename T>
+T& newMessage() {
+    return *Worker::current().arena().create<T>();
+}
+
+/**
+ * Metricas del worker actual
+ */
+WorkerMetrics& localMetrics() {
+    return metrics.worker(Worker::current().index());
+}
+
+#ifdef CHAT_IO_URING
+/**
+ * Empieza a recibir de una conexion con un recv multishot
+ *
+ * @param connection Conexion a leer
+ * @param ring io_uring del worker
+ */
+void startReceiving(Connection& connection, Uring& ring) {
+    int clientSocket = connection.fd;
+    uint64_t serial = connection.serial;
+    connection.recvOperation = ring.recvMultishot(clientSocket, [clientSocket, serial](uint64_t operation, int result, uint32_t flags) {
+        Uring& ring = *Worker::current().reactor().uring();
+        Connection* connection = Worker::current().connections().find(clientSocket);
+        bool valid = connection != nullptr && connection->serial == serial;
+        // Los datos se copian al buffer de la conexion y el buffer vuelve al ring de inmediato
+        if (result > 0 && Uring::hasBuffer(flags)) {
+            if (valid) {
+                connection->inBuffer.append(ring.bufferData(flags), result);
+                connection->receivedAt = std::chrono::steady_clock::now();
+                localMetrics().bytesIn.add(result);
+            }
+            ring.recycleBuffer(flags);
+        }
+        // Los CQE de un recv que ya se cancelo solo entregan sus datos
+        if (!valid || connection->recvOperation != operation) {
+            return;
+        }
+        if (!Uring::hasMore(flags)) {
+            connection->recvOperation = 0;
+        }
+        if (result == 0 || (result < 0 && result != -ENOBUFS)) {
+            // En caso no se imprime el error y se cierra el socket del cliente
+            logInfo("Error receiving request or client disconnected");
+            closeConnection(clientSocket);
+            return;
+        }
+        // Se procesan todos los frames completos y se vuelve a recibir si hace falta
+        if (processFrames(*connection)) {
+            updateInterest(*connection);
+        }
+    });
+}
+
+/**
+ * Envia con io_uring los frames pendientes de una conexion. Solo hay un envio
+ * a la vez por conexion, lo que se encola mientras tanto sale en el siguiente.
+ *
+ * @param connection Conexion con frames pendientes
+ * @param ring io_uring del worker
+ */
+void startSending(Connection& connection, Uring& ring) {
+    iovec iov[MaxIovecs];
+    size_t count = collectPending(connection, iov, MaxIovecs);
+    std::vector<SharedFrame> frames(connection.outQueue.begin(), connection.outQueue.begin() + count);
+    int clientSocket = connection.fd;
+    uint64_t serial = connection.serial;
+    connection.sending = ring.sendFrames(clientSocket, iov, count, std::move(frames), [clientSocket, serial](uint64_t, int result, uint32_t) {
+        Connection* connection = Worker::current().connections().find(clientSocket);
+        if (connection == nullptr || connection->serial != serial) {
+            return;
+        }
+        connection->sending = false;
+        if (result < 0) {
+            logError("Error al enviar el mensaje");
+            closeConnection(clientSocket);
+            return;
+        }
+        bool wasCongested = connection->congested;
+        consumeSent(*connection, result, config.outbound);
+        if (connection->outQueue.empty() && connection->closeAfterFlush) {
+            closeConnection(clientSocket);
+            return;
+        }
+        // Si la cola se vacio lo suficiente se retoman los requests que ya estaban en el buffer
+        if (wasCongested && !connection->congested && !processFrames(*connection)) {
+            return;
+        }
+        updateInterest(*connection);
+    }) != 0;
+}
+
+/**
+ * Aplica con io_uring los eventos que le interesan a una conexion: recibir
+ * mientras no este congestionada y enviar mientras tenga frames pendientes
+ *
+ * @param connection Conexion a actualizar
+ * @param ring io_uring del worker
+ * @param events Eventos que quiere la conexion
+ */
+void updateUringInterest(Connection& connection, Uring& ring, uint32_t events) {
+    if ((events & EPOLLIN) && connection.recvOperation == 0) {
+        startReceiving(connection, ring);
+    } else if (!(events & EPOLLIN) && connection.recvOperation != 0) {
+        // Se deja de leer al cliente hasta que baje su cola de salida
+        ring.cancel(connection.recvOperation);
+        connection.recvOperation = 0;
+    }
+    if (connection.sending) {
+        return;
+    }
+    if (!connection.outQueue.empty()) {
+        startSending(connection, ring);
+    } else if (connection.closeAfterFlush) {
+        // No hay nada que esperar, se cierra fuera de quien llamo para evitar reentradas
+        int clientSocket = connection.fd;
+        uint64_t serial = connection.serial;
+        Worker::current().post([clientSocket, serial] {
+            Connection* connection = Worker::current().connections().find(clientSocket);
+            if (connection != nullptr && connection->serial == serial) {
+                closeConnection(clientSocket);
+            }
+        });
+    }
+}
+#endif
+
+/**
+ * Indica si el worker actual hace el I/O de sus sockets con io_uring
+ */
+bool usingUring() {
+#ifdef CHAT_IO_URING
+    return Worker::current().reactor().uring() != nullptr;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Actualiza los eventos de epoll de una conexion si cambiaron
+ *
+ * @param connection Conexion a actualizar
+ */
+void updateInterest(Connection& connection) {
+    uint32_t events = wantedEvents(connection);
+#ifdef CHAT_IO_URING
+    if (Uring* ring = Worker::current().reactor().uring()) {
+        updateUringInterest(connection, *ring, events);
+        return;
+    }
+#endif
+    if (events != connection.events) {
+        Worker::current().reactor().modify(connection.fd, events);
+        connection.events = events;
+    }
+}
+
+/**
+ * Marca una conexion para cerrarse descartando lo pendiente. No se cierra aqui
+ * porque quien llama puede estar recorriendo las variables compartidas, el
+ * cierre se hace en el siguiente evento del socket.
+ *
+ * @param connection Conexion a cerrar
+ */
+void abortConnection(Connection& connection) {
+    connection.outQueue.clear();
+    connection.outOffset = 0;
+    connection.outBytes = 0;
+    connection.closeAfterFlush = true;
+    updateInterest(connection);
+}
+
+/**
+ * Encola varios frames ya serializados hacia un socket. La cola se envia sin
+ * bloquear al final de la vuelta del ciclo de eventos, junto con todo lo que
+ * se le haya encolado a la conexion en esa vuelta.
+ *
+ * @param clientSocket Socket destino
+ * @param frames Frames a enviar, compartidos entre todos sus destinatarios
+ * @param count Cantidad de frames
+ * @param droppable Si los frames se pueden descartar cuando el cliente va atrasado
+ * @return false si no se encolo ningun frame
+ */
+bool sendFramesToSocket(int clientSocket, const SharedFrame* frames, size_t count, bool droppable = false) {
+    Connection* target = Worker::current().connections().find(clientSocket);
+    if (target == nullptr) {
+        return false;
+    }
+    Connection& connection = *target;
+    // Una conexion que se va a cerrar ya no recibe mas frames
+    if (connection.closeAfterFlush) {
+        return false;
+    }
+
+    bool queued = false;
+    for (size_t i = 0; i < count; i++) {
+        QueueResult result = queueFrame(connection, frames[i], config.outbound, droppable);
+        if (result == QueueResult::Overflow) {
+            logWarn("Client socket {} is too slow, disconnecting", clientSocket);
+            abortConnection(connection);
+            return false;
+        }
+        queued = queued || result == QueueResult::Queued;
+    }
+    if (!queued) {
+        return false;
+    }
+    localMetrics().queueDepth.record(connection.outBytes);
+
+    // No se envia de inmediato: todo lo que se le encole a la conexion en esta
+    // vuelta del ciclo de eventos sale junto al final, en una sola llamada
+    Worker::current().scheduleFlush(connection);
+    return true;
+}
+
+/**
+ * Encola un frame ya serializado hacia un socket
+ *
+ * @param clientSocket Socket destino
+ * @param frame Frame a enviar, compartido entre todos sus destinatarios
+ * @param droppable Si el frame se puede descartar cuando el cliente va atrasado
+ */
+bool sendFrameToSocket(int clientSocket, const SharedFrame& frame, bool droppable = false) {
+    return sendFramesToSocket(clientSocket, &frame, 1, droppable);
+}
+
+/**
+ * Tamaño desde el que se comprimen los frames de un socket
+ *
+ * @param clientSocket Socket destino
+ * @return 0 si el cliente no negocio compresion
+ */
+size_t compressAboveFor(int clientSocket) {
+    Connection* connection = Worker::current().connections().find(clientSocket);
+    return connection != nullptr && connection->compression ? config.compressionThreshold : 0;
+}
+
+// Respuestas a un RequestBatch que se estan juntando para enviarlas en un solo ResponseBatch
+struct ResponseBatchState {
+    int fd = -1;                          // Socket que envio el batch, -1 si no se esta procesando uno
+    chat::ResponseBatch* batch = nullptr; // Vive en el arena del worker
+    size_t bytes = 0;                     // Tamaño aproximado del batch serializado
+};
+thread_local ResponseBatchState responseBatch;
+
+// Request que se esta atendiendo, las respuestas que se le envian a su socket llevan su request_id
+struct CurrentRequest {
+    int fd = -1;        // Socket que envio el request, -1 fuera de un request
+    bool hasId = false; // El cliente puso request_id
+    uint64_t id = 0;
+};
+thread_local CurrentRequest currentRequest;
+
+/**
+ * Copia el request_id del request en curso a una respuesta hacia su mismo socket
+ *
+ * @param clientSocket Socket destino de la respuesta
+ * @param response Respuesta a marcar
+ */
+void stampRequestId(int clientSocket, chat::Response& response) {
+    if (clientSocket == currentRequest.fd && currentRequest.hasId && !response.has_request_id()) {
+        response.set_request_id(currentRequest.id);
+    }
+}
+
+/**
+ * Envia las respuestas juntadas del RequestBatch en curso como un frame ResponseBatch
+ */
+void flushResponseBatch() {
+    if (responseBatch.fd < 0 || responseBatch.batch->responses_size() == 0) {
+        return;
+    }
+    SharedFrame frame = encodeFrame(*responseBatch.batch, FrameFlagBatch, compressAboveFor(responseBatch.fd));
+    responseBatch.batch->Clear();
+    responseBatch.bytes = 0;
+    if (!frame || !sendFrameToSocket(responseBatch.fd, frame)) {
+        logError("Error sending response batch to client socket {}", responseBatch.fd);
+    }
+}
+
+/**
+ * Serializa una respuesta y la envia a un socket. Si el socket esta enviando
+ * un RequestBatch la respuesta se agrega a su ResponseBatch. Si el cliente
+ * negocio compresion las respuestas grandes se comprimen. Si es la respuesta
+ * al request en curso se le agrega su request_id.
+ *
+ * @param clientSocket Socket destino
+ * @param response Respuesta a enviar
+ */
+bool sendToSocket(int clientSocket, chat::Response& response) {
+    stampRequestId(clientSocket, response);
+    if (clientSocket == responseBatch.fd) {
+        // Un batch demasiado grande para un frame se parte en varios
+        size_t size = response.ByteSizeLong() + 8;
+        if (responseBatch.bytes + size > MaxFrameSize) {
+            flushResponseBatch();
+        }
+        responseBatch.batch->add_responses()->CopyFrom(response);
+        responseBatch.bytes += size;
+        return true;
+    }
+    SharedFrame frame = encodeFrame(response, 0, compressAboveFor(clientSocket));
+    if (!frame) {
+        return false;
+    }
+    return sendFrameToSocket(clientSocket, frame);
+}
+
+/**
+ * Envia un frame a la conexion de una sesion. Se debe llamar desde el worker
+ * de la sesion; se verifica que el socket siga siendo de esa sesion porque
+ * pudo cerrarse y reutilizarse mientras el frame estaba en el mailbox. Si la
+ * conexion negocio compresion el frame se comprime para ella.
+ *
+ * @param session Sesion destino
+ * @param frame Frame a enviar
+ */
+bool sendFrameToSession(const SessionPtr& session, const SharedFrame& frame) {
+    Connection* connection = Worker::current().connections().find(session->fd);
+    if (connection == nullptr || connection->session != session) {
+        return false;
+    }
+    if (connection->compression) {
+        return sendFrameToSocket(session->fd, compressFrame(frame, config.compressionThreshold));
+    }
+    return sendFrameToSocket(session->fd, frame);
+}
+
+/**
+ * Entrega un frame a una sesion desde cualquier worker. Si la sesion es de
+ * otro worker el frame se le manda por su mailbox.
+ *
+ * @param session Sesion destino
+ * @param frame Frame a enviar
+ * @return false si no se pudo enviar de inmediato en el worker actual
+ */
+bool deliverToSession(const SessionPtr& session, const SharedFrame& frame) {
+    if (session->worker == Worker::current().index()) {
+        return sendFrameToSession(session, frame);
+    }
+    workers[session->worker]->post([session, frame] { sendFrameToSession(session, frame); });
+    return true;
+}
+
+/**
+ * Envia un broadcast a todos los usuarios registrados en el worker actual
+ *
+ * @param frame Frame del broadcast
+ * @param compressed El mismo frame comprimido, para los clientes que negociaron compresion
+ */
+void deliverBroadcast(const SharedFrame& frame, const SharedFrame& compressed) {
+    // Enviar nunca cierra conexiones en el momento, asi que la lista no cambia mientras se recorre.
+    // A los clientes atrasados se les puede descartar el broadcast
+    localMetrics().fanout.record(Worker::current().members().size());
+    for (Connection* member : Worker::current().members()) {
+        sendFrameToSocket(member->fd, member->compression ? compressed : frame, true);
+    }
+}
 
 /**
  * Funcion que maneja el envío de mensajes broadcast a través de un socket
@@ -28,490 +429,1423 @@ int waitTime = 60; // Variable donde se guarda el tiempo de inactividad predeter
  * @param userSender Usuario que envía el mensaje
  */
 void broadcastMessage(const std::string& message, const std::string& userSender) {
-    // Bloqueamos el mutex para proteger la variable userSockets
-    std::lock_guard<std::mutex> lock(clientsMutex);
-    // Iteramos sobre todos los sockets de los usuarios
-    std::cout << "Broadcasting message: " << message << "\n";
-    for (const auto& [username, clientSocket] : userSockets) {
-        // Creamos un mensaje de respuesta
-        chat::Response response;
+    logDebug("Broadcasting message: {}", LogContent{message});
+    // Creamos el mensaje de respuesta una sola vez, es igual para todos los usuarios
+    chat::Response& response = newMessage<chat::Response>();
+    response.set_operation(chat::Operation::INCOMING_MESSAGE);
+    response.set_status_code(chat::StatusCode::OK);
+    auto *incomingMessage = response.mutable_incoming_message();
+    // Definimos el contenido del mensaje, tipo y el usuario que lo envía
+    incomingMessage->set_content(message);
+    incomingMessage->set_type(chat::MessageType::BROADCAST);
+    incomingMessage->set_sender(userSender);
+    // El log asigna el offset y guarda los mismos bytes que reciben los clientes
+    HistoryLog::Entry entry{HistoryLog::Kind::Broadcast, userSender, ""};
+    SharedFrame frame = history.append(entry, [&](uint64_t offset) {
+        incomingMessage->set_offset(offset);
+        return encodeFrame(response);
+    });
+    if (!frame) {
+        return;
+    }
+    recentBroadcasts.push(incomingMessage->offset(), frame);
+    // Se comprime una sola vez para todos los clientes que negociaron compresion
+    SharedFrame compressed = compressFrame(frame, config.compressionThreshold);
+
+    // Cada worker recibe una sola tarea con una referencia al mismo frame y
+    // la reparte entre sus propias conexiones
+    Worker& current = Worker::current();
+    for (auto& worker : workers) {
+        if (worker.get() != &current) {
+            worker->post([frame, compressed] { deliverBroadcast(frame, compressed); });
+        }
+    }
+    deliverBroadcast(frame, compressed);
+}
+
+/**
+ * Funcion que maneja el envío de mensajes directos a través de un socket
+ *
+ * @param message Mensaje a enviar en directo
+ * @param sender Conexion del usuario que envía el mensaje
+ * @param recipient Usuario que recibe el mensaje
+ */
+void directMessage(const std::string& message, Connection& sender, const std::string& recipient) {
+    // Verificamos si el usuario destinatario se encuentra registrado
+    SessionPtr target = sessions.find(recipient);
+    if (target) {
+        // Si el usuario se encuentra registrado, creamos un mensaje de respuesta
+        chat::Response& response = newMessage<chat::Response>();
         response.set_operation(chat::Operation::INCOMING_MESSAGE);
         response.set_status_code(chat::StatusCode::OK);
         auto *incomingMessage = response.mutable_incoming_message();
         // Definimos el contenido del mensaje, tipo y el usuario que lo envía
         incomingMessage->set_content(message);
-        incomingMessage->set_type(chat::MessageType::BROADCAST);
-        incomingMessage->set_sender(userSender);
+        incomingMessage->set_type(chat::MessageType::DIRECT);
+        incomingMessage->set_sender(sender.session ? sender.session->username : "");
+        // Enviamos el mensaje a través del worker que atiende al destinatario
+        HistoryLog::Entry entry{HistoryLog::Kind::Direct, incomingMessage->sender(), recipient};
+        SharedFrame frame = history.append(entry, [&](uint64_t offset) {
+            incomingMessage->set_offset(offset);
+            return encodeFrame(response);
+        });
+        if (!frame || !deliverToSession(target, frame)) {
+            logError("Error sending direct message to client socket {}", target->fd);
+        }
+
+        // Creamos un mensaje de respuesta para el usuario que envía el mensaje
+        chat::Response& responseSender = newMessage<chat::Response>();
+        responseSender.set_operation(chat::Operation::SEND_MESSAGE);
+        responseSender.set_message("Message sent successfully.");
+        responseSender.set_status_code(chat::StatusCode::OK);
         // Enviamos el mensaje a través del socket
-        if (!sendMessage(clientSocket, response)) {
-            std::cerr << "Error sending broadcast message to client socket " << clientSocket << "\n";
+        if (!sendToSocket(sender.fd, responseSender)) {
+            logError("Error sending direct message to client socket {}", sender.fd);
+        }
+    } else {
+        // Si el usuario no se encuentra registrado, creamos un mensaje de respuesta
+        chat::Response& response = newMessage<chat::Response>();
+        response.set_operation(chat::Operation::INCOMING_MESSAGE);
+        // Definimos el status code como error y el mensaje de error
+        response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
+        response.set_message("Recipient not found");
+        // Enviamos el mensaje a través del socket
+        if (!sendToSocket(sender.fd, response)) {
+            logError("Error sending response to client socket {}", sender.fd);
         }
     }
 }
 
 /**
- * Funcion que maneja el envío de mensajes directos a través de un socket
- * 
- * @param message Mensaje a enviar en directo
- * @param userSender Usuario que envía el mensaje
- * @param recipient Usuario que recibe el mensaje
+ * Envia un mensaje de canal a los suscriptores del canal en el worker actual
+ *
+ * @param channel Canal del mensaje
+ * @param frame Frame del mensaje
+ * @param compressed El mismo frame comprimido, para los clientes que negociaron compresion
  */
-void directMessage(const std::string& message, const std::string& userSender, const std::string& recipient) {
-    {
-        // Bloqueamos el mutex para proteger la variable userSockets
-        std::lock_guard<std::mutex> lock(clientsMutex);
-        // Verificamos si el usuario destinatario se encuentra en la lista de sockets
-        if (userSockets.find(recipient) != userSockets.end()) {
-            // Si el usuario se encuentra en la lista de sockets, creamos un mensaje de respuesta
-            chat::Response response;
-            response.set_operation(chat::Operation::INCOMING_MESSAGE);
-            response.set_status_code(chat::StatusCode::OK);
-            auto *incomingMessage = response.mutable_incoming_message();
-            // Definimos el contenido del mensaje, tipo y el usuario que lo envía
-            incomingMessage->set_content(message);
-            incomingMessage->set_type(chat::MessageType::DIRECT);
-            incomingMessage->set_sender(userSender);
-            // Enviamos el mensaje a través del socket
-            if (!sendMessage(userSockets[recipient], response)) {
-                std::cerr << "Error sending direct message to client socket " << userSockets[recipient] << "\n";
-            }
+void deliverToChannel(const std::string& channel, const SharedFrame& frame, const SharedFrame& compressed) {
+    const std::vector<Connection*>* subscribers = Worker::current().channels().subscribers(channel);
+    if (subscribers == nullptr) {
+        return;
+    }
+    // Igual que un broadcast: enviar no cierra conexiones y a los atrasados se les puede descartar
+    localMetrics().fanout.record(subscribers->size());
+    for (Connection* subscriber : *subscribers) {
+        sendFrameToSocket(subscriber->fd, subscriber->compression ? compressed : frame, true);
+    }
+}
 
-            // Creamos un mensaje de respuesta para el usuario que envía el mensaje
-            chat::Response responseSender;
-            responseSender.set_operation(chat::Operation::SEND_MESSAGE);
-            responseSender.set_message("Message sent successfully.");
-            responseSender.set_status_code(chat::StatusCode::OK);
-            // Enviamos el mensaje a través del socket
-            if (!sendMessage(userSockets[userSender], responseSender)) {
-                std::cerr << "Error sending direct message to client socket " << userSockets[userSender] << "\n";
-            }
-        } else {
-            // Si el usuario no se encuentra en la lista de sockets, creamos un mensaje de respuesta
-            chat::Response response;
-            response.set_operation(chat::Operation::INCOMING_MESSAGE);
-            // Definimos el status code como error y el mensaje de error
+/**
+ * Responde a un request de canal con su resultado
+ *
+ * @param connection Conexion del usuario
+ * @param operation JOIN_CHANNEL, LEAVE_CHANNEL o SEND_MESSAGE
+ * @param channel Canal del request
+ * @param code Resultado
+ * @param message Descripcion del resultado
+ */
+void sendChannelResponse(Connection& connection, chat::Operation operation, const std::string& channel,
+                         chat::StatusCode code, const char* message) {
+    chat::Response& response = newMessage<chat::Response>();
+    response.set_operation(operation);
+    response.set_status_code(code);
+    response.set_message(message);
+    response.mutable_channel()->set_channel(channel);
+    if (!sendToSocket(connection.fd, response)) {
+        logError("Error sending channel response to client socket {}", connection.fd);
+    }
+}
+
+/**
+ * Confirma un mensaje broadcast o de canal a quien lo envio. Sin request_id el
+ * cliente recibe su propio mensaje como a los demas y no hace falta confirmarlo.
+ *
+ * @param clientSocket Socket del remitente
+ */
+void acknowledgeMessage(int clientSocket) {
+    if (!currentRequest.hasId) {
+        return;
+    }
+    chat::Response& response = newMessage<chat::Response>();
+    response.set_operation(chat::Operation::SEND_MESSAGE);
+    response.set_status_code(chat::StatusCode::OK);
+    response.set_message("Message sent successfully.");
+    if (!sendToSocket(clientSocket, response)) {
+        logError("Error sending message ack to client socket {}", clientSocket);
+    }
+}
+
+/**
+ * Envia un mensaje a los suscriptores de un canal. Se serializa una sola vez
+ * y solo se le pasa a los workers que tienen suscriptores del canal, el costo
+ * depende de cuantos estan suscritos y no de cuantos usuarios hay conectados.
+ *
+ * @param message Contenido del mensaje
+ * @param sender Conexion del usuario que envia el mensaje, debe estar suscrito
+ * @param channel Canal destino
+ */
+void channelMessage(const std::string& message, Connection& sender, const std::string& channel) {
+    if (!ChannelIndex::isMember(sender, channel)) {
+        sendChannelResponse(sender, chat::Operation::SEND_MESSAGE, channel, chat::StatusCode::BAD_REQUEST,
+                            "Not subscribed to the channel");
+        return;
+    }
+    chat::Response& response = newMessage<chat::Response>();
+    response.set_operation(chat::Operation::INCOMING_MESSAGE);
+    response.set_status_code(chat::StatusCode::OK);
+    auto *incomingMessage = response.mutable_incoming_message();
+    incomingMessage->set_content(message);
+    incomingMessage->set_type(chat::MessageType::CHANNEL);
+    incomingMessage->set_sender(sender.session->username);
+    incomingMessage->set_channel(channel);
+    HistoryLog::Entry entry{HistoryLog::Kind::Channel, incomingMessage->sender(), channel};
+    SharedFrame frame = history.append(entry, [&](uint64_t offset) {
+        incomingMessage->set_offset(offset);
+        return encodeFrame(response);
+    });
+    if (!frame) {
+        return;
+    }
+    SharedFrame compressed = compressFrame(frame, config.compressionThreshold);
+
+    // Solo los workers con suscriptores reciben el mensaje, el remitente esta suscrito
+    // asi que la lista nunca esta vacia
+    ChannelDirectory::WorkerList targets = channelDirectory.workers(channel);
+    size_t currentIndex = Worker::current().index();
+    for (size_t index : *targets) {
+        if (index != currentIndex) {
+            workers[index]->post([channel, frame, compressed] { deliverToChannel(channel, frame, compressed); });
+        }
+    }
+    deliverToChannel(channel, frame, compressed);
+    acknowledgeMessage(sender.fd);
+}
+
+/**
+ * Suscribe al usuario de una conexion a un canal
+ *
+ * @param connection Conexion del usuario
+ * @param channel Canal
+ */
+void joinChannel(Connection& connection, const std::string& channel) {
+    chat::Operation operation = chat::Operation::JOIN_CHANNEL;
+    if (!connection.session) {
+        sendChannelResponse(connection, operation, channel, chat::StatusCode::BAD_REQUEST, "User not registered");
+    } else if (channel.empty() || channel.size() > MaxChannelName) {
+        sendChannelResponse(connection, operation, channel, chat::StatusCode::BAD_REQUEST, "Invalid channel name");
+    } else if (ChannelIndex::isMember(connection, channel)) {
+        sendChannelResponse(connection, operation, channel, chat::StatusCode::OK, "Already subscribed");
+    } else if (connection.channels.size() >= MaxChannelsPerUser) {
+        sendChannelResponse(connection, operation, channel, chat::StatusCode::BAD_REQUEST, "Too many channels");
+    } else {
+        Worker& worker = Worker::current();
+        // El primer suscriptor del worker lo registra para que le lleguen los mensajes del canal
+        if (worker.channels().join(channel, connection)) {
+            channelDirectory.add(channel, worker.index());
+        }
+        sendChannelResponse(connection, operation, channel, chat::StatusCode::OK, "Joined channel");
+    }
+}
+
+/**
+ * Quita la suscripcion del usuario de una conexion a un canal
+ *
+ * @param connection Conexion del usuario
+ * @param channel Canal
+ */
+void leaveChannel(Connection& connection, const std::string& channel) {
+    chat::Operation operation = chat::Operation::LEAVE_CHANNEL;
+    if (!ChannelIndex::isMember(connection, channel)) {
+        sendChannelResponse(connection, operation, channel, chat::StatusCode::BAD_REQUEST, "Not subscribed to the channel");
+        return;
+    }
+    Worker& worker = Worker::current();
+    if (worker.channels().leave(channel, connection)) {
+        channelDirectory.remove(channel, worker.index());
+    }
+    sendChannelResponse(connection, operation, channel, chat::StatusCode::OK, "Left channel");
+}
+
+// Cambios de presencia que ya se enviaron a los suscriptores del worker
+struct PresencePushState {
+    uint64_t version = 0;    // Version hasta la que llegan los cambios enviados
+    bool scheduled = false;  // Hay un timer programado para el siguiente envio
+};
+thread_local PresencePushState presencePush;
+
+/**
+ * Serializa cambios de presencia como respuestas PRESENCE_UPDATE. Si no caben
+ * en un frame se parten en varios, cada uno sigue la version del anterior.
+ *
+ * @param events Cambios ordenados por version
+ * @param fromVersion Version sobre la que se aplican
+ * @param version Version despues de aplicarlos
+ * @param snapshot Si los cambios son el estado completo
+ * @return Los frames, vacio si no se pudieron serializar
+ */
+std::vector<SharedFrame> encodePresence(const std::vector<PresenceFeed::Event>& events, uint64_t fromVersion,
+                                        uint64_t version, bool snapshot) {
+    std::vector<SharedFrame> frames;
+    size_t next = 0;
+    do {
+        chat::Response& response = newMessage<chat::Response>();
+        response.set_operation(chat::Operation::PRESENCE_UPDATE);
+        response.set_status_code(chat::StatusCode::OK);
+        chat::PresenceUpdate& update = *response.mutable_presence();
+        update.set_from_version(fromVersion);
+        update.set_snapshot(snapshot && frames.empty());
+        size_t bytes = 0;
+        for (; next < events.size() && bytes < MaxPresenceFrameBytes; next++) {
+            const PresenceFeed::Event& event = events[next];
+            chat::PresenceEvent& added = *update.add_events();
+            added.set_version(event.version);
+            added.set_username(event.username);
+            added.set_change(event.change);
+            added.set_status(event.status);
+            bytes += event.username.size() + 16;
+        }
+        // Un frame intermedio llega hasta la version de su ultimo cambio
+        fromVersion = next < events.size() ? events[next - 1].version : version;
+        update.set_version(fromVersion);
+        SharedFrame frame = encodeFrame(response);
+        if (!frame) {
+            return {};
+        }
+        frames.push_back(std::move(frame));
+    } while (next < events.size());
+    return frames;
+}
+
+/**
+ * Encola frames de presencia a un suscriptor, comprimidos si negocio compresion
+ *
+ * @param connection Suscriptor
+ * @param frames Frames de presencia
+ * @param compressed Los mismos frames comprimidos, vacio para comprimirlos aqui
+ * @param droppable Si se pueden descartar cuando el cliente va atrasado
+ */
+void sendPresenceFrames(Connection& connection, const std::vector<SharedFrame>& frames,
+                        const std::vector<SharedFrame>& compressed, bool droppable) {
+    if (!connection.compression) {
+        sendFramesToSocket(connection.fd, frames.data(), frames.size(), droppable);
+    } else if (!compressed.empty()) {
+        sendFramesToSocket(connection.fd, compressed.data(), compressed.size(), droppable);
+    } else {
+        std::vector<SharedFrame> own;
+        for (const SharedFrame& frame : frames) {
+            own.push_back(compressFrame(frame, config.compressionThreshold));
+        }
+        sendFramesToSocket(connection.fd, own.data(), own.size(), droppable);
+    }
+}
+
+void pushPresence();
+
+/**
+ * Programa el siguiente envio de presencia del worker actual, si no hay uno
+ */
+void schedulePresencePush() {
+    if (!presencePush.scheduled) {
+        presencePush.scheduled = true;
+        Worker::current().reactor().timers().schedule(config.presenceInterval, pushPresence);
+    }
+}
+
+/**
+ * Envia a los suscriptores del worker los cambios de presencia desde el envio
+ * anterior. Se ejecuta una vez por intervalo mientras haya suscriptores, asi
+ * los cambios de ese intervalo se coalescen y se serializan una sola vez por
+ * worker sin importar cuantos suscriptores tenga.
+ */
+void pushPresence() {
+    Worker& worker = Worker::current();
+    presencePush.scheduled = false;
+    if (worker.presenceSubscribers().empty()) {
+        return;
+    }
+    schedulePresencePush();
+    if (presence.version() == presencePush.version) {
+        return;
+    }
+
+    // Si el worker se atraso mas que el backlog todos sus suscriptores reciben un snapshot
+    std::vector<PresenceFeed::Event> events;
+    uint64_t version = 0;
+    bool snapshot = !presence.since(presencePush.version, events, version);
+    if (snapshot) {
+        version = presence.snapshot(events);
+    }
+    std::vector<SharedFrame> frames = encodePresence(events, snapshot ? 0 : presencePush.version, version, snapshot);
+    // Los mensajes se crearon en el arena del worker, fuera de un request
+    worker.arena().reset();
+    if (frames.empty()) {
+        logError("Error encoding presence update");
+        return;
+    }
+    presencePush.version = version;
+
+    std::vector<SharedFrame> compressed;
+    for (const SharedFrame& frame : frames) {
+        compressed.push_back(compressFrame(frame, config.compressionThreshold));
+    }
+    // Igual que un broadcast se pueden descartar a los atrasados, el cliente lo nota por from_version
+    localMetrics().fanout.record(worker.presenceSubscribers().size());
+    for (Connection* subscriber : worker.presenceSubscribers()) {
+        sendPresenceFrames(*subscriber, frames, compressed, true);
+    }
+}
+
+/**
+ * Suscribe o desuscribe a un usuario de los cambios de presencia. Al
+ * suscribirse recibe los cambios posteriores a la version que ya conoce o,
+ * si ya no estan en el backlog, un snapshot de todos los usuarios.
+ *
+ * @param connection Conexion del usuario
+ * @param request Pedido de suscripcion
+ */
+void subscribePresence(Connection& connection, const chat::PresenceRequest& request) {
+    Worker& worker = Worker::current();
+    chat::Response& response = newMessage<chat::Response>();
+    response.set_operation(chat::Operation::SUBSCRIBE_PRESENCE);
+    response.set_status_code(chat::StatusCode::OK);
+
+    std::vector<SharedFrame> frames;
+    if (!connection.session) {
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        response.set_message("User not registered");
+    } else if (!request.subscribe()) {
+        worker.removePresenceSubscriber(connection);
+        response.set_message("Presence unsubscribed");
+    } else {
+        std::vector<PresenceFeed::Event> events;
+        uint64_t version = 0;
+        bool snapshot = !request.has_known_version() || !presence.since(request.known_version(), events, version);
+        if (snapshot) {
+            version = presence.snapshot(events);
+        }
+        frames = encodePresence(events, snapshot ? 0 : request.known_version(), version, snapshot);
+        if (frames.empty()) {
             response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
-            response.set_message("Recipient not found");
-            // Enviamos el mensaje a través del socket
-            if (!sendMessage(userSockets[userSender], response)) {
-                std::cerr << "Error sending response to client socket " << userSockets[userSender] << "\n";
+            response.set_message("Could not encode presence");
+        } else {
+            // El primer suscriptor del worker define desde donde siguen los envios
+            if (worker.presenceSubscribers().empty()) {
+                presencePush.version = version;
             }
+            worker.addPresenceSubscriber(connection);
+            schedulePresencePush();
+            response.set_message("Presence subscribed");
         }
     }
+
+    if (!sendToSocket(connection.fd, response)) {
+        logError("Error sending presence response to client socket {}", connection.fd);
+        return;
+    }
+    if (!frames.empty()) {
+        sendPresenceFrames(connection, frames, {}, false);
+    }
+}
+
+/**
+ * Envia los mensajes guardados en el historial que puede ver el usuario.
+ * Los mensajes se mandan como los frames INCOMING_MESSAGE que ya estan en el
+ * log, todos juntos en una sola escritura, y al final una respuesta GET_HISTORY
+ * con la cantidad enviada y el offset desde el que se puede seguir leyendo.
+ *
+ * @param connection Conexion del usuario
+ * @param request Pedido con el limite y el offset desde el que leer
+ */
+void returnHistory(Connection& connection, const chat::HistoryRequest& request) {
+    chat::Response& response = newMessage<chat::Response>();
+    response.set_operation(chat::Operation::GET_HISTORY);
+    if (!connection.session) {
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        response.set_message("User not registered");
+        sendToSocket(connection.fd, response);
+        return;
+    }
+
+    size_t limit = request.limit() == 0 ? MaxHistoryMessages : std::min<size_t>(request.limit(), MaxHistoryMessages);
+    // La respuesta tiene que entrar en la cola de envio sin llegar al limite de la conexion
+    size_t maxBytes = std::min(MaxHistoryBytes, config.outbound.maxQueueBytes / 2);
+    uint64_t afterOffset = request.after_offset();
+    // Los mensajes de canal solo se devuelven de los canales a los que esta suscrito ahora
+    auto inChannel = [&connection](std::string_view channel) { return ChannelIndex::isMember(connection, channel); };
+    HistoryLog::ReadResult result = history.read(connection.session->username, inChannel,
+                                                 request.has_after_offset() ? &afterOffset : nullptr, limit, maxBytes);
+    if (!result.frames.empty() &&
+        !sendFrameToSocket(connection.fd, std::make_shared<const std::string>(std::move(result.frames)))) {
+        return;
+    }
+
+    response.set_status_code(chat::StatusCode::OK);
+    response.mutable_history()->set_count(result.count);
+    response.mutable_history()->set_last_offset(result.lastOffset);
+    if (!sendToSocket(connection.fd, response)) {
+        logError("Error sending history to client socket {}", connection.fd);
+    }
+}
+
+/**
+ * Responde el registro de un cliente que se reconecta y le envia los broadcasts
+ * posteriores a su cursor que siguen en memoria. La respuesta, los broadcasts y
+ * una respuesta GET_HISTORY final se encolan juntos y salen en una sola escritura.
+ *
+ * @param connection Conexion del usuario
+ * @param registered Respuesta del registro
+ * @param afterOffset Offset del ultimo mensaje que vio el cliente
+ */
+void registerAndResume(Connection& connection, chat::Response& registered, uint64_t afterOffset) {
+    // Se limita a la mitad de la cola para que ponerse al dia no desconecte al cliente
+    BroadcastRing::Slice slice = recentBroadcasts.since(afterOffset, config.outbound.maxQueueBytes / 2);
+
+    chat::Response& summary = newMessage<chat::Response>();
+    summary.set_operation(chat::Operation::GET_HISTORY);
+    summary.set_status_code(chat::StatusCode::OK);
+    summary.mutable_history()->set_count(static_cast<uint32_t>(slice.frames.size()));
+    summary.mutable_history()->set_last_offset(slice.lastOffset);
+    summary.mutable_history()->set_gap(slice.gap);
+
+    stampRequestId(connection.fd, registered);
+    SharedFrame first = encodeFrame(registered);
+    SharedFrame last = encodeFrame(summary);
+    if (!first || !last) {
+        return;
+    }
+    slice.frames.insert(slice.frames.begin(), first);
+    slice.frames.push_back(last);
+    if (!sendFramesToSocket(connection.fd, slice.frames.data(), slice.frames.size())) {
+        logError("Error sending missed broadcasts to client socket {}", connection.fd);
+    }
 }
 
 /**
- * Funcion que envia todos los usuarios conectados
- * 
+ * Funcion que envia una pagina de los usuarios conectados. Se lee de la lista
+ * publicada del registro, sin bloquear sus shards, y las paginas siguen el
+ * orden por username.
+ *
  * @param clientSocket Socket del cliente a enviar los usuarios
+ * @param request Pedido con el tamaño de pagina, el cursor y el prefijo
  */
-void returnAllUsers(int clientSocket) {
+void returnAllUsers(int clientSocket, const chat::UserListRequest& request) {
+    SessionRegistry::SnapshotPtr snapshot = sessions.snapshot();
+    const std::vector<SessionPtr>& list = snapshot->sessions;
+    size_t pageSize = request.page_size() == 0 ? MaxUsersPage : std::min<size_t>(request.page_size(), MaxUsersPage);
+    const std::string& prefix = request.prefix();
+
+    // La pagina empieza en el primer usuario con el prefijo que va despues del cursor
+    auto start = std::lower_bound(list.begin(), list.end(), prefix,
+                                  [](const SessionPtr& session, const std::string& name) { return session->username < name; });
+    if (!request.cursor().empty()) {
+        auto afterCursor = std::upper_bound(list.begin(), list.end(), request.cursor(),
+                                            [](const std::string& name, const SessionPtr& session) { return name < session->username; });
+        start = std::max(start, afterCursor);
+    }
+
     // Preparamos la respuesta
-    chat::Response response;
+    chat::Response& response = newMessage<chat::Response>();
     response.set_operation(chat::Operation::GET_USERS);
     response.set_status_code(chat::StatusCode::OK);
 
-    // Creamos la lista que va a tener todos los usuarios
-    chat::UserListResponse user_list;
+    // La lista de usuarios se llena directo dentro de la respuesta
+    chat::UserListResponse& user_list = *response.mutable_user_list();
     user_list.set_type(chat::UserListType::ALL);
-    {
-        // Bloqueamos el mutex para proteger la variable usersState
-        std::lock_guard<std::mutex> lock(clientsMutex);
-        // Recorremos la lista y vamos agregando los usuarios a la lista con su respectivo estado
-        for (const auto& [user, state] : usersState){
-            chat::User *newUser = user_list.add_users();
-            newUser->set_username(user);
-            newUser->set_status(state);
+    user_list.set_version(snapshot->version);
+    // Vamos agregando los usuarios a la lista con su respectivo estado, la pagina tambien
+    // se corta antes de que deje de caber en un frame
+    auto hasPrefix = [&prefix](const SessionPtr& session) { return session->username.compare(0, prefix.size(), prefix) == 0; };
+    size_t bytes = 0;
+    auto it = start;
+    for (; it != list.end() && hasPrefix(*it); ++it) {
+        if (static_cast<size_t>(user_list.users_size()) == pageSize || (bytes > 0 && bytes + (*it)->username.size() > MaxUsersPageBytes)) {
+            break;
         }
+        chat::User *newUser = user_list.add_users();
+        newUser->set_username((*it)->username);
+        newUser->set_status((*it)->status.load());
+        bytes += (*it)->username.size() + 8;
+    }
+    // Si quedan usuarios con el prefijo la siguiente pagina sigue despues del ultimo enviado
+    if (it != list.end() && hasPrefix(*it) && it != start) {
+        user_list.set_next_cursor((*(it - 1))->username);
     }
 
-    std::cout << "All users fetched successfully." << "\n";
-
-    // Copiamos la lista de usuarios a la respuesta
-    response.mutable_user_list()->CopyFrom(user_list);
+    logDebug("All users fetched successfully.");
 
     // Enviamos la respuesta a través del socket
-    if (!sendMessage(clientSocket, response)) {
-        std::cerr << "Error sending users list to client socket " << clientSocket << "\n";
+    if (!sendToSocket(clientSocket, response)) {
+        logError("Error sending users list to client socket {}", clientSocket);
     }
 }
 
 /**
  * Funcion que envia la informacion de un usuario en especifico
- * 
+ *
  * @param clientSocket Socket del cliente a enviar la informacion del usuario
  * @param username Nombre del usuario que se pidio la informacion
  */
 void returnUserInfo(int clientSocket, const std::string& username) {
-    {
-        // Bloqueamos el mutex para proteger la variable userSockets
-        std::lock_guard<std::mutex> lock(clientsMutex);
-        // Verificamos si el usuario se encuentra en la lista de sockets
-        if (userSockets.find(username) == userSockets.end()) {
-            // Si el usuario no se encuentra en la lista de sockets, creamos un mensaje de respuesta
-            chat::Response response;
-            response.set_operation(chat::Operation::GET_USERS);
-            response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
-            response.set_message("User not found");
+    // Verificamos si el usuario se encuentra registrado
+    SessionPtr session = sessions.find(username);
+    if (!session) {
+        // Si el usuario no se encuentra registrado, creamos un mensaje de respuesta
+        chat::Response& response = newMessage<chat::Response>();
+        response.set_operation(chat::Operation::GET_USERS);
+        response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
+        response.set_message("User not found");
 
-            if (!sendMessage(clientSocket, response)) {
-                std::cerr << "Error sending user info to client socket " << clientSocket << "\n";
-            }
-        } else {
-            // Si el usuario se encuentra en la lista de sockets, creamos un mensaje de respuesta
-            chat::Response response;
-            response.set_operation(chat::Operation::GET_USERS);
-            response.set_status_code(chat::StatusCode::OK);
-
-            chat::UserListResponse user_list;
-            user_list.set_type(chat::UserListType::SINGLE);
-            chat::User *newUser = user_list.add_users();
-            // Agregamos los datos del usuario, incluyendo el IP address
-            newUser->set_username(username + " (IP: " + ipsUsers[username] + ")");
-            newUser->set_status(usersState[username]);
-
-            std::cout << "User info fetched successfully." << "\n";
-
-            // Copiamos la lista del usuario en la respuesta
-            response.mutable_user_list()->CopyFrom(user_list);
-
-            // Enviamos la respuesta a través del socket
-            if (!sendMessage(clientSocket, response)) {
-                std::cerr << "Error sending user info to client socket " << clientSocket << "\n";
-            }
+        if (!sendToSocket(clientSocket, response)) {
+            logError("Error sending user info to client socket {}", clientSocket);
+        }
+    } else {
+        // Si el usuario se encuentra registrado, creamos un mensaje de respuesta
+        chat::Response& response = newMessage<chat::Response>();
+        response.set_operation(chat::Operation::GET_USERS);
+        response.set_status_code(chat::StatusCode::OK);
+
+        chat::UserListResponse& user_list = *response.mutable_user_list();
+        user_list.set_type(chat::UserListType::SINGLE);
+        chat::User *newUser = user_list.add_users();
+        // Agregamos los datos del usuario, incluyendo el IP address
+        newUser->set_username(username + " (IP: " + session->ip + ")");
+        newUser->set_status(session->status.load());
+
+        logDebug("User info fetched successfully.");
+
+        // Enviamos la respuesta a través del socket
+        if (!sendToSocket(clientSocket, response)) {
+            logError("Error sending user info to client socket {}", clientSocket);
+        }
+    }
+}
+
+/**
+ * Suma las metricas de todos los workers junto con los contadores globales.
+ * Se puede llamar desde cualquier hilo.
+ */
+MetricsReport buildMetricsReport() {
+    MetricsReport report = metrics.collect([](size_t operation) {
+        int value = static_cast<int>(operation);
+        return chat::Operation_IsValid(value) ? chat::Operation_Name(static_cast<chat::Operation>(value)) : std::string();
+    });
+    report.counters.emplace_back("chat_dropped_broadcasts_total", outboundCounters.droppedBroadcasts.load());
+    report.counters.emplace_back("chat_slow_consumer_disconnects_total", outboundCounters.slowConsumerDisconnects.load());
+    report.counters.emplace_back("chat_read_pauses_total", outboundCounters.readPauses.load());
+    report.gauges.emplace_back("chat_connected_users", sessions.size());
+    report.gauges.emplace_back("chat_presence_version", presence.version());
+    return report;
+}
+
+/**
+ * Envia las metricas del servidor
+ *
+ * @param clientSocket Socket del cliente que las pidio
+ */
+void returnStats(int clientSocket) {
+    MetricsReport report = buildMetricsReport();
+    chat::Response& response = newMessage<chat::Response>();
+    response.set_operation(chat::Operation::STATS);
+    response.set_status_code(chat::StatusCode::OK);
+    chat::StatsResponse& stats = *response.mutable_stats();
+    for (const auto* series : {&report.counters, &report.gauges}) {
+        for (const auto& [name, value] : *series) {
+            chat::StatsCounter& counter = *stats.add_counters();
+            counter.set_name(name);
+            counter.set_value(value);
         }
     }
+    for (const auto& [name, data] : report.histograms) {
+        chat::StatsHistogram& histogram = *stats.add_histograms();
+        histogram.set_name(name);
+        histogram.set_count(data.count);
+        histogram.set_sum(data.sum);
+        histogram.set_p50(data.percentile(50));
+        histogram.set_p90(data.percentile(90));
+        histogram.set_p99(data.percentile(99));
+        histogram.set_p999(data.percentile(99.9));
+        histogram.set_max(data.max);
+    }
+    if (!sendToSocket(clientSocket, response)) {
+        logError("Error sending stats to client socket {}", clientSocket);
+    }
 }
 
 /**
  * Maneja el cambio de estado de un usuario
- * 
- * @param clientSocket Socket del cliente a cambiar el estado
+ *
+ * @param connection Conexion del cliente a cambiar el estado
  * @param status Nuevo estado del usuario
  */
-void changeStatus (int clientSocket, chat::UserStatus status, int automatic = 0){
-    {
-        // Bloqueamos el mutex para proteger la variable usersState
-        std::lock_guard<std::mutex> lock(clientsMutex);
-        // Buscamos el usuario que se quiere cambiar el estado
-        std::string userToChange;
-        // Recorremos la lista para encontrar el username del socket correspondiente
-        for (const auto& [username, socket] : userSockets) {
-            if (socket == clientSocket) {
-                userToChange = username;
-                break;
-            }
-        }
-        // Cambiamos el estado del usuario
-        usersState[userToChange] = status;
+void changeStatus (Connection& connection, chat::UserStatus status, int automatic = 0){
+    // La conexion apunta directamente a su sesion, no hay que buscar al usuario.
+    // Solo un cambio real se publica a los suscriptores de presencia
+    if (connection.session && connection.session->status.exchange(status) != status) {
+        presence.record(chat::PresenceChange::STATUS_CHANGED, connection.session->username, status);
     }
 
     // Creamos la respuesta
-    chat::Response response;
+    chat::Response& response = newMessage<chat::Response>();
     response.set_operation(chat::Operation::UPDATE_STATUS);
     response.set_status_code(chat::StatusCode::OK);
+    // El cliente toma el status de la respuesta, asi no tiene que adivinar el de un aviso automatico
+    response.set_new_status(status);
     // Mencionamos que el update fue exitoso
     if (automatic == 1) {
         response.set_message("Status actualizado automáticamente por el server");
-    } else { 
-        response.set_message("Se actualizó el estado del usuario exitosamente");
+        // El aviso automatico no responde al request en curso, se envia sin su request_id
+        CurrentRequest handling = std::exchange(currentRequest, CurrentRequest{});
+        sendToSocket(connection.fd, response);
+        currentRequest = handling;
+        return;
     }
+    response.set_message("Se actualizó el estado del usuario exitosamente");
 
     // Enviamos la respuesta a través del socket
-    sendMessage(clientSocket, response);
+    sendToSocket(connection.fd, response);
 }
 
+void onIdleTimer(int clientSocket);
+
 /**
- * Funcion que maneja el tiempo de inactividad de los usuarios
+ * Programa el timer de inactividad de una conexion
+ *
+ * @param connection Conexion del usuario
+ * @param delay Tiempo hasta revisar la inactividad
  */
-void userScanner() {
-    while (true) {
-        // Recorremos la lista de sockets
-        std::this_thread::sleep_for(std::chrono::seconds(1));
-        for (const auto& [username, timer] : usersTiming) {
-            // Verificamos si el tiempo de inactividad es mayor al tiempo establecido
-            if (timer == waitTime) {
-                // Si el tiempo de inactividad es mayor, cambiamos el estado del usuario a OFFLINE
-                changeStatus(userSockets[username], chat::UserStatus::OFFLINE, 1);
-                usersTiming[username] = timer + 1;
-            } else {
-                // Si el tiempo de inactividad no es mayor, incrementamos el tiempo de inactividad
-                usersTiming[username] = timer + 1;
-            }            
-        }
+void armIdleTimer(Connection& connection, std::chrono::steady_clock::duration delay) {
+    int clientSocket = connection.fd;
+    connection.idleTimer = Worker::current().reactor().timers().schedule(delay, [clientSocket] { onIdleTimer(clientSocket); });
+}
+
+/**
+ * Funcion que maneja el tiempo de inactividad de un usuario, se ejecuta cuando
+ * vence su timer. Enviar mensajes no mueve el timer, solo actualiza la ultima
+ * actividad; al vencer se revisa y si hubo actividad se reprograma por lo que falta.
+ *
+ * @param clientSocket Socket del usuario
+ */
+void onIdleTimer(int clientSocket) {
+    Connection* connection = Worker::current().connections().find(clientSocket);
+    if (connection == nullptr || !connection->session) {
+        return;
+    }
+    connection->idleTimer = 0;
+
+    auto lastActivity = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(connection->session->lastActivity.load()));
+    auto idle = std::chrono::steady_clock::now() - lastActivity;
+    if (idle < config.idleTimeout) {
+        armIdleTimer(*connection, config.idleTimeout - idle);
+        return;
     }
+    // Si el tiempo de inactividad es mayor, cambiamos el estado del usuario a OFFLINE.
+    // El timer no se reprograma hasta que el usuario vuelva a enviar un mensaje
+    changeStatus(*connection, chat::UserStatus::OFFLINE, 1);
+    // La respuesta se creo en el arena del worker, fuera de un request
+    Worker::current().arena().reset();
 }
 
 /**
- * Maneja los requests de los clientes
- * 
- * @param clientSocket Socket del cliente
- * @param clientIp IP del cliente
+ * Elimina del registro al usuario de una conexion
+ *
+ * @param connection Conexion del usuario
  */
-void handleClient(int clientSocket, std::string clientIp) {
-    // Se guarda el username del cliente
-    std::string username;
-    // Se crea un loop infinito para recibir requests del socket del cliente
-    while (true) {
-        // Se crea un objeto request para recibir el mensaje
-        chat::Request request;
-        // Se verifica si el mensaje fue recibido correctamente
-        if (!receiveMessage(clientSocket, request)) {
-            // En caso no se imprime el error y se cierra el socket del cliente
-            std::cerr << "Error receiving request or client disconnected\n";
-            {
-                // Se bloquea el mutex para proteger la variable usersState
-                std::lock_guard<std::mutex> lock(clientsMutex);
-                // Se verifica si el usuario se encuentra en la lista de sockets, en caso no se haya eliminado previamente, después de su desregistro
-                if (userSockets.find(username) != userSockets.end()) {
-                    usersState.erase(username);
-                    userSockets.erase(username);
-                    ipsUsers.erase(username);
-                    usersTiming.erase(username);
-                }
-            }
-            close(clientSocket);
-            break;
-        }
-        // Se verifica el tipo de operacion que se quiere realizar
-        if (request.operation() == chat::Operation::REGISTER_USER) {
-            // Si se quiere registrar un usuario se crea un response
-            chat::Response response;
-            // Se obtiene el username del request
-            username = request.register_user().username();
-            {
-                // Se bloquea el mutex para proteger la variable usersState
-                std::lock_guard<std::mutex> lock(clientsMutex);
-                // Se verifica si el username ya existe
-                if (usersState.find(username) != usersState.end()) {
-                    // Si ya existe se envia un mensaje de error y se cierra el socket del cliente
-                    std::cout << "Username already taken\n";
-                    response.set_message("Username already taken");
-                    response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
-                    if (!sendMessage(clientSocket, response)) {
-                        std::cerr << "Error sending response\n";
-                        close(clientSocket);
-                        break;
-                    }
-                    close(clientSocket);
-                    break;
-                }
-                for (const auto& [user, Ip] : ipsUsers) {
-                    std::cout << "User: " << user << " IP: " << Ip << "\n";
-                    std::cout << "Client IP: " << clientIp << "\n";
-                    if (Ip == clientIp) {
-                        std::cout << "Encontramos un cliente con esta IP\n";
-                        response.set_message("Ya existe un usuario registrado con esta IP");
-                        response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
-                        if (!sendMessage(clientSocket, response)) {
-                            std::cerr << "Error sending response\n";
-                            close(clientSocket);
-                            break;
-                        }
-                        close(clientSocket);
-                        break;
-                    }
-                }
-                // Si no existe, se agrega el username a la lista de usuarios y se guarda su ip, su socket y su estado
-                ipsUsers[username] = clientIp;
-                usersState[username] = chat::UserStatus::ONLINE;
-                userSockets[username] = clientSocket;
-                usersTiming[username] = 0;
-            }
-            std::cout << "User registered: " << username << "\n";
+void removeUser(Connection& connection) {
+    // Se verifica si el usuario se encuentra registrado, en caso no se haya eliminado previamente, después de su desregistro
+    Worker& worker = Worker::current();
+    if (connection.session) {
+        // La salida se publica antes de liberar el nombre, asi queda antes de la entrada de quien lo reutilice
+        presence.record(chat::PresenceChange::USER_LEFT, connection.session->username, chat::UserStatus::OFFLINE);
+        sessions.remove(connection.session);
+        connection.session.reset();
+    }
+    worker.removeMember(connection);
+    worker.removePresenceSubscriber(connection);
+    worker.channels().leaveAll(connection, [&worker](const std::string& channel) {
+        channelDirectory.remove(channel, worker.index());
+    });
+    worker.reactor().timers().cancel(connection.idleTimer);
+    connection.idleTimer = 0;
+}
 
-            // Se imprime la lista de usuarios conectados
-            for (const auto& [user, clientSocket] : userSockets) {
-                std::cout << user << "\n";
-            }
+/**
+ * Cierra la conexion de un cliente y libera su estado
+ *
+ * @param clientSocket Socket del cliente
+ */
+void closeConnection(int clientSocket) {
+    // Sacamos la conexion de la tabla antes de liberar para evitar reentradas
+    std::unique_ptr<Connection> connection = Worker::current().connections().release(clientSocket);
+    if (!connection) {
+        return;
+    }
+    removeUser(*connection);
+#ifdef CHAT_IO_URING
+    // El recv pendiente mantiene abierto el socket hasta que se cancele
+    if (Uring* ring = Worker::current().reactor().uring()) {
+        ring->cancel(connection->recvOperation);
+    }
+#endif
+    Worker::current().reactor().remove(clientSocket);
+    close(clientSocket);
+}
 
-            // Se envia un mensaje de exito al cliente
-            response.set_message("User registered successfully");
-            response.set_status_code(chat::StatusCode::OK);
+/**
+ * Cierra la conexion una vez que se hayan enviado todas las respuestas pendientes
+ *
+ * @param connection Conexion a cerrar
+ */
+void closeAfterFlush(Connection& connection) {
+    // Las respuestas del batch en curso salen antes de cerrar
+    if (connection.fd == responseBatch.fd) {
+        flushResponseBatch();
+    }
+    if (connection.outQueue.empty()) {
+        closeConnection(connection.fd);
+    } else {
+        connection.closeAfterFlush = true;
+        updateInterest(connection);
+    }
+}
 
-            if (!sendMessage(clientSocket, response)) {
-                std::cerr << "Error sending user info to client socket " << clientSocket << "\n";
-            }
-        } else if (request.operation() == chat::Operation::UNREGISTER_USER) {
-            // Si se quiere desregistrar un usuario se crea un response
-            chat::Response response;
-            response.set_operation(chat::Operation::UNREGISTER_USER);
-            // Se obtiene el username del request
-            username = request.unregister_user().username();
-            {
-                // Se bloquea el mutex para proteger la variable usersState
-                std::lock_guard<std::mutex> lock(clientsMutex);
-                ipsUsers.erase(username);
-                usersState.erase(username);
-                userSockets.erase(username);
-                usersTiming.erase(username);
-            }
-            // Se imprime el username del usuario que se desregistro
-            std::cout << "User unregistered: " << username << "\n";
-            response.set_message("User unregistered successfully");
-            response.set_status_code(chat::StatusCode::OK);
-            // Se envia un mensaje de exito al cliente
-            if (!sendMessage(clientSocket, response)) {
-                std::cerr << "Error sending response\n";
+/**
+ * Maneja un request de un cliente
+ *
+ * @param connection Conexion del cliente
+ * @param request Request recibido
+ */
+void handleRequest(Connection& connection, const chat::Request& request) {
+    int clientSocket = connection.fd;
+    currentRequest = {clientSocket, request.has_request_id(), request.request_id()};
+    if (static_cast<size_t>(request.operation()) < WorkerMetrics::Operations) {
+        localMetrics().requests[request.operation()].add();
+    }
+    // Se verifica el tipo de operacion que se quiere realizar
+    if (request.operation() == chat::Operation::REGISTER_USER) {
+        // Si se quiere registrar un usuario se crea un response
+        chat::Response& response = newMessage<chat::Response>();
+        // Se obtiene el username del request
+        std::string requestedName = request.register_user().username();
+        // Se crea la sesion con su ip, su socket y su estado
+        auto session = std::make_shared<Session>();
+        session->username = requestedName;
+        session->ip = connection.ip;
+        session->fd = clientSocket;
+        session->worker = Worker::current().index();
+        session->touch();
+        // Se intenta registrar, el registro verifica si el username o la IP ya existen
+        SessionRegistry::AddResult result = sessions.add(session);
+        if (result != SessionRegistry::AddResult::Added) {
+            // Si ya existe se envia un mensaje de error y se cierra el socket del cliente
+            if (result == SessionRegistry::AddResult::NameTaken) {
+                logInfo("Username already taken");
+                response.set_message("Username already taken");
+            } else {
+                logInfo("Encontramos un cliente con esta IP");
+                response.set_message("Ya existe un usuario registrado con esta IP");
             }
-            // Se cierra el socket del cliente
-            close(clientSocket);
-            break;
-        } else if (request.operation() == chat::Operation::SEND_MESSAGE) {
-            if (usersTiming.find(username) != usersTiming.end()){
-                {
-                    // Bloqueamos el mutex para proteger las variables compartidas
-                    std::lock_guard<std::mutex> lock(clientsMutex);
-                    usersTiming[username] = 0;
-                }
-                changeStatus(clientSocket, chat::UserStatus::ONLINE, 1);
+            response.set_status_code(chat::StatusCode::INTERNAL_SERVER_ERROR);
+            if (sendToSocket(clientSocket, response)) {
+                closeAfterFlush(connection);
             }
-            // Si se quiere enviar un mensaje se crea un response
-            if (request.send_message().recipient() == "") {
-                // Si el mensaje no tiene un recipient, se envia en broadcast
-                std::string message = request.send_message().content();
-                // Armamos el mensaje con el username del cliente y el contenido del mensaje
-                std::cout << "Message received: " << "[" + username + "]" + ": " + message << "\n";
-                // Se utiliza la funcion auxiliar para envia el mensaje en broadcast
-                broadcastMessage(message, username);
-            } else {
-                // Si el mensaje tiene un recipient, se envia en directo
-                std::string recipient = request.send_message().recipient();
-                std::string message = request.send_message().content();
-                // Armamos el mensaje con el username del cliente, el contenido del mensaje y el recipient
-                std::cout << "Direct message received: " << "[" + username + "]" + ": " + message << "\n";
-                // Se utiliza la funcion auxiliar para envia el mensaje en directo, colocando el recipient
-                directMessage(message, username, recipient);
+            return;
+        }
+        // La conexion guarda su sesion para no tener que buscarla en cada request
+        connection.session = session;
+        presence.record(chat::PresenceChange::USER_JOINED, requestedName, chat::UserStatus::ONLINE);
+        Worker::current().addMember(connection);
+        armIdleTimer(connection, config.idleTimeout);
+        logInfo("User registered: {}", requestedName);
+        logInfo("Connected users: {}", sessions.size());
+
+        // Se envia un mensaje de exito al cliente
+        response.set_message("User registered successfully");
+        response.set_status_code(chat::StatusCode::OK);
+        // Si el cliente acepta compresion se le confirma, desde aqui sus frames grandes van comprimidos
+        if (config.compressionThreshold > 0 && request.register_user().compression() == chat::Compression::ZLIB) {
+            connection.compression = true;
+            response.set_compression(chat::Compression::ZLIB);
+        }
+
+        if (request.register_user().has_resume_after()) {
+            // El cliente se reconecta, junto con la respuesta recibe los broadcasts que se perdio
+            registerAndResume(connection, response, request.register_user().resume_after());
+        } else if (!sendToSocket(clientSocket, response)) {
+            logError("Error sending user info to client socket {}", clientSocket);
+        }
+    } else if (request.operation() == chat::Operation::UNREGISTER_USER) {
+        // Si se quiere desregistrar un usuario se crea un response
+        chat::Response& response = newMessage<chat::Response>();
+        response.set_operation(chat::Operation::UNREGISTER_USER);
+        // Se obtiene el username del request
+        const std::string& username = request.unregister_user().username();
+        removeUser(connection);
+        // Se imprime el username del usuario que se desregistro
+        logInfo("User unregistered: {}", username);
+        response.set_message("User unregistered successfully");
+        response.set_status_code(chat::StatusCode::OK);
+        // Se envia un mensaje de exito al cliente y se cierra su socket
+        if (!sendToSocket(clientSocket, response)) {
+            logError("Error sending response");
+            return;
+        }
+        closeAfterFlush(connection);
+    } else if (request.operation() == chat::Operation::SEND_MESSAGE) {
+        // Se guarda el username del cliente
+        std::string username;
+        if (connection.session) {
+            username = connection.session->username;
+            // Se reinicia el tiempo de inactividad del usuario, si ya habia vencido se vuelve a programar
+            connection.session->touch();
+            if (connection.idleTimer == 0) {
+                armIdleTimer(connection, config.idleTimeout);
             }
-            continue;
-        } else if (request.operation() == chat::Operation::GET_USERS){
-            // Si se quiere obtener los usuarios se crea un response
-            if (request.get_users().username().empty()) {
-                // Si no se especifica un usuario, se envian todos los usuarios
-                returnAllUsers(clientSocket);
-            } else {
-                // Si se especifica un usuario, se envia la informacion de ese usuario
-                returnUserInfo(clientSocket, request.get_users().username());
+            changeStatus(connection, chat::UserStatus::ONLINE, 1);
+        }
+        // Si se quiere enviar un mensaje se crea un response
+        if (!request.send_message().channel().empty()) {
+            // Si el mensaje tiene un canal, se envia a los suscriptores del canal
+            const std::string& channel = request.send_message().channel();
+            const std::string& message = request.send_message().content();
+            if (!request.send_message().recipient().empty() || !connection.session) {
+                sendChannelResponse(connection, chat::Operation::SEND_MESSAGE, channel, chat::StatusCode::BAD_REQUEST,
+                                    "A channel message needs a registered sender and no recipient");
+                return;
             }
-            continue;
-        } else if (request.operation() == chat::Operation::UPDATE_STATUS) {
-            // Si se quiere actualizar el estado de un usuario 
-            auto status_request = request.update_status();
-            // Se utiliza la funcion auxiliar para cambiar el estado del usuario, agregando el nuevo estado del cliente
-            changeStatus(clientSocket, status_request.new_status());
+            logDebug("Channel message received: [{}] #{}: {}", username, channel, LogContent{message});
+            channelMessage(message, connection, channel);
+        } else if (request.send_message().recipient() == "") {
+            // Si el mensaje no tiene un recipient, se envia en broadcast
+            const std::string& message = request.send_message().content();
+            // Armamos el mensaje con el username del cliente y el contenido del mensaje
+            logDebug("Message received: [{}]: {}", username, LogContent{message});
+            // Se utiliza la funcion auxiliar para envia el mensaje en broadcast
+            broadcastMessage(message, username);
+            acknowledgeMessage(clientSocket);
+        } else {
+            // Si el mensaje tiene un recipient, se envia en directo
+            const std::string& recipient = request.send_message().recipient();
+            const std::string& message = request.send_message().content();
+            // Armamos el mensaje con el username del cliente, el contenido del mensaje y el recipient
+            logDebug("Direct message received: [{}] -> {}: {}", username, recipient, LogContent{message});
+            // Se utiliza la funcion auxiliar para envia el mensaje en directo, colocando el recipient
+            directMessage(message, connection, recipient);
+        }
+    } else if (request.operation() == chat::Operation::GET_USERS){
+        // Si se quiere obtener los usuarios se crea un response
+        if (request.get_users().username().empty()) {
+            // Si no se especifica un usuario, se envian todos los usuarios
+            returnAllUsers(clientSocket, request.get_users());
         } else {
-            // Si la operacion no es reconocida, se envia un mensaje de error
-            chat::Response response;
-            std::cerr << "Unknown operation\n";
-            // Se envia con un status code de Bad Request
-            response.set_status_code(chat::StatusCode::BAD_REQUEST);
-            response.set_message("Unknown operation");
-            if (!sendMessage(clientSocket, response)) {
-                std::cerr << "Error sending response\n";
+            // Si se especifica un usuario, se envia la informacion de ese usuario
+            returnUserInfo(clientSocket, request.get_users().username());
+        }
+    } else if (request.operation() == chat::Operation::UPDATE_STATUS) {
+        // Si se quiere actualizar el estado de un usuario
+        auto status_request = request.update_status();
+        // Se utiliza la funcion auxiliar para cambiar el estado del usuario, agregando el nuevo estado del cliente
+        changeStatus(connection, status_request.new_status());
+    } else if (request.operation() == chat::Operation::GET_HISTORY) {
+        // Se envian los mensajes anteriores que el usuario puede ver
+        returnHistory(connection, request.get_history());
+    } else if (request.operation() == chat::Operation::JOIN_CHANNEL) {
+        // Se suscribe al usuario al canal
+        joinChannel(connection, request.join_channel().channel());
+    } else if (request.operation() == chat::Operation::LEAVE_CHANNEL) {
+        // Se quita la suscripcion del usuario al canal
+        leaveChannel(connection, request.leave_channel().channel());
+    } else if (request.operation() == chat::Operation::SUBSCRIBE_PRESENCE) {
+        // Se suscribe o desuscribe al usuario de los cambios de presencia
+        subscribePresence(connection, request.presence());
+    } else if (request.operation() == chat::Operation::STATS) {
+        // Se envian las metricas del servidor
+        returnStats(clientSocket);
+    } else {
+        // Si la operacion no es reconocida, se envia un mensaje de error
+        chat::Response& response = newMessage<chat::Response>();
+        logWarn("Unknown operation");
+        // Se envia con un status code de Bad Request
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        response.set_message("Unknown operation");
+        if (!sendToSocket(clientSocket, response)) {
+            logError("Error sending response");
+        }
+    }
+}
+
+/**
+ * Atiende un frame con un solo request
+ *
+ * @param connection Conexion del cliente
+ * @param payload Request serializado
+ * @return false si la conexion se cerro
+ */
+bool handleFrame(Connection& connection, std::string_view payload) {
+    int clientSocket = connection.fd;
+    chat::Request& request = newMessage<chat::Request>();
+    if (!request.ParseFromArray(payload.data(), payload.size())) {
+        logWarn("Error al parsear el mensaje");
+        return true;
+    }
+    handleRequest(connection, request);
+    currentRequest = {};
+    return Worker::current().connections().find(clientSocket) != nullptr;
+}
+
+/**
+ * Atiende un frame RequestBatch: los requests se atienden en orden y sus
+ * respuestas se juntan en un ResponseBatch que se envia al terminar
+ *
+ * @param connection Conexion del cliente
+ * @param payload RequestBatch serializado
+ * @return false si la conexion se cerro
+ */
+bool handleBatch(Connection& connection, std::string_view payload) {
+    int clientSocket = connection.fd;
+    chat::RequestBatch& batch = newMessage<chat::RequestBatch>();
+    if (!batch.ParseFromArray(payload.data(), payload.size())) {
+        logWarn("Error al parsear el batch");
+        return true;
+    }
+    responseBatch = {clientSocket, &newMessage<chat::ResponseBatch>(), 0};
+    bool open = true;
+    for (const chat::Request& request : batch.requests()) {
+        handleRequest(connection, request);
+        if (Worker::current().connections().find(clientSocket) == nullptr) {
+            open = false;
+            break;
+        }
+        // Los requests que siguen a un UNREGISTER_USER ya no se atienden
+        if (connection.closeAfterFlush) {
+            break;
+        }
+    }
+    currentRequest = {};
+    if (open) {
+        flushResponseBatch();
+    }
+    responseBatch = {};
+    return open;
+}
+
+/**
+ * Procesa los frames completos que esten en el buffer de entrada de una conexion
+ *
+ * @param connection Conexion del cliente
+ * @return false si la conexion se cerro mientras se procesaban
+ */
+bool processFrames(Connection& connection) {
+    int clientSocket = connection.fd;
+    std::string_view payload;
+    uint8_t flags;
+    // El procesamiento se detiene si la cola de salida se congestiona, el resto
+    // se procesa cuando el cliente lea sus respuestas
+    while (!connection.congested && !connection.closeAfterFlush) {
+        FrameBuffer::Status status = connection.inBuffer.nextFrame(payload, flags);
+        if (status == FrameBuffer::Status::Incomplete) {
+            break;
+        }
+        if (status == FrameBuffer::Status::Invalid) {
+            // Un frame mas grande de lo permitido no se puede recuperar, se cierra la conexion
+            logWarn("Frame too large from client socket {}", clientSocket);
+            closeConnection(clientSocket);
+            return false;
+        }
+        if (flags & FrameFlagCompressed) {
+            // Un request no puede crecer mas que un frame normal, su contenido se reenvia a clientes sin compresion
+            thread_local std::string expanded;
+            if (!connection.compression || !decompressPayload(payload, expanded, MaxFrameSize)) {
+                logWarn("Invalid compressed frame from client socket {}", clientSocket);
+                closeConnection(clientSocket);
+                return false;
             }
+            payload = expanded;
+        }
+        // El request y todas sus respuestas se crean en el arena del worker,
+        // que se libera completo al terminar el request
+        bool open = true;
+        {
+            // Se mide desde que se leyo del socket hasta que se encola lo ultimo que genera el frame en este worker
+            ScopedTimer handling(&localMetrics().requestTime, connection.receivedAt);
+            open = (flags & FrameFlagBatch) ? handleBatch(connection, payload)
+                                            : handleFrame(connection, payload);
+        }
+        Worker::current().arena().reset();
+        // El request pudo haber cerrado la conexion (por ejemplo UNREGISTER_USER)
+        if (!open) {
+            return false;
         }
     }
-    // Si 
-    {
-        // Bloqueamos el mutex para proteger las variables compartidas
-        std::lock_guard<std::mutex> lock(clientsMutex);
-        // Se verifica si el usuario se encuentra en la lista de sockets, en caso no se haya eliminado previamente, después de su desregistro
-        if (userSockets.find(username) != userSockets.end()) {
-            usersState.erase(username);
-            userSockets.erase(username);
-            ipsUsers.erase(username);
-            usersTiming.erase(username);
+    return true;
+}
+
+/**
+ * Envia lo pendiente de una conexion sin bloquear. Cierra la conexion si el
+ * envio falla o si ya salio su ultima respuesta.
+ *
+ * @param connection Conexion del cliente
+ * @return false si la conexion se cerro
+ */
+bool writePending(Connection& connection) {
+    int clientSocket = connection.fd;
+    bool wasCongested = connection.congested;
+    if (!flushConnection(connection, config.outbound)) {
+        closeConnection(clientSocket);
+        return false;
+    }
+    if (connection.outQueue.empty() && connection.closeAfterFlush) {
+        closeConnection(clientSocket);
+        return false;
+    }
+    // Si la cola se vacio lo suficiente se retoman los requests que ya estaban en el buffer
+    if (wasCongested && !connection.congested && !processFrames(connection)) {
+        return false;
+    }
+    updateInterest(connection);
+    return true;
+}
+
+/**
+ * Envia la cola de una conexion al final de la vuelta del ciclo de eventos
+ *
+ * @param connection Conexion con frames nuevos
+ */
+void flushScheduled(Connection& connection) {
+    // Con io_uring el envio se prepara aqui y sale en el submit de la siguiente vuelta
+    if (usingUring()) {
+        updateInterest(connection);
+    } else {
+        writePending(connection);
+    }
+}
+
+/**
+ * Maneja los eventos de epoll del socket de un cliente
+ *
+ * @param clientSocket Socket del cliente
+ * @param events Eventos listos
+ */
+void handleClient(int clientSocket, uint32_t events) {
+    Connection* found = Worker::current().connections().find(clientSocket);
+    if (found == nullptr) {
+        return;
+    }
+    Connection& connection = *found;
+
+    // El socket esta listo para escritura, enviamos lo pendiente
+    if ((events & EPOLLOUT) && !writePending(connection)) {
+        return;
+    }
+
+    if (events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+        // Ya no se atienden requests de una conexion que se va a cerrar
+        if (connection.closeAfterFlush) {
+            if (events & (EPOLLHUP | EPOLLERR)) {
+                closeConnection(clientSocket);
+            }
+            return;
+        }
+        ssize_t bytesRead = connection.inBuffer.readFrom(clientSocket);
+        if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        }
+        if (bytesRead <= 0) {
+            // En caso no se imprime el error y se cierra el socket del cliente
+            logInfo("Error receiving request or client disconnected");
+            closeConnection(clientSocket);
+            return;
         }
+        connection.receivedAt = std::chrono::steady_clock::now();
+        localMetrics().bytesIn.add(static_cast<uint64_t>(bytesRead));
+        // Se procesan todos los frames completos que llegaron en esta lectura
+        processFrames(connection);
     }
 }
 
 /**
- * Funcion principal del servidor
- * 
- * @param argc Cantidad de argumentos
- * @param argv Argumentos
+ * Imprime los contadores de la cola de salida si cambiaron desde la ultima vez
  */
-int main(int argc, char* argv[]) {
-    // Se verifica que se haya ingresado la IP del servidor
-    if (argc != 2) {
-        std::cerr << "Usage: server <server_ip>\n";
-        return 1;
+void reportOutboundCounters() {
+    static uint64_t lastTotal = 0;
+    uint64_t dropped = outboundCounters.droppedBroadcasts;
+    uint64_t disconnects = outboundCounters.slowConsumerDisconnects;
+    uint64_t pauses = outboundCounters.readPauses;
+    if (dropped + disconnects + pauses == lastTotal) {
+        return;
+    }
+    lastTotal = dropped + disconnects + pauses;
+    logInfo("Outbound queues: dropped broadcasts={} slow consumer disconnects={} read pauses={}", dropped, disconnects,
+            pauses);
+}
+
+/**
+ * Programa la revision periodica de los contadores de las colas de salida
+ */
+void scheduleCounterReport() {
+    Worker::current().reactor().timers().schedule(std::chrono::seconds(1), [] {
+        reportOutboundCounters();
+        scheduleCounterReport();
+    });
+}
+
+/**
+ * Registra la conexion de un cliente recien aceptado en el worker actual
+ *
+ * @param clientSocket Socket del cliente, ya no bloqueante
+ * @param clientAddress Direccion del cliente
+ */
+void addClient(int clientSocket, const sockaddr_in& clientAddress) {
+    // Cada conexion del worker tiene un numero distinto aunque se reutilice el socket
+    static thread_local uint64_t nextSerial = 1;
+
+    char clientIP[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &(clientAddress.sin_addr), clientIP, INET_ADDRSTRLEN);
+    logInfo("Client IP: {}", clientIP);
+
+    // Se registra la conexion en el ciclo de eventos
+    auto connection = std::make_unique<Connection>();
+    connection->fd = clientSocket;
+    connection->ip = clientIP;
+    connection->serial = nextSerial++;
+    connection->events = EPOLLIN;
+    // Las respuestas ya se juntan por vuelta del ciclo de eventos, Nagle solo agregaria espera
+    int noDelay = 1;
+    setsockopt(clientSocket, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    Connection& added = *connection;
+    Worker& worker = Worker::current();
+    worker.connections().insert(std::move(connection));
+    if (usingUring()) {
+        updateInterest(added);
+        return;
+    }
+    if (!worker.reactor().add(clientSocket, EPOLLIN, [clientSocket](uint32_t events) { handleClient(clientSocket, events); })) {
+        worker.connections().release(clientSocket);
+        close(clientSocket);
     }
+}
 
-    // Se crea el socket del servidor con la IP ingresada
-    std::string serverIP = argv[1];
-    int serverSocket = socket(AF_INET, SOCK_STREAM, 0);
+/**
+ * Acepta todas las conexiones pendientes del socket del servidor
+ *
+ * @param serverSocket Socket del servidor
+ */
+void acceptClients(int serverSocket) {
+    while (true) {
+        // Se acepta la conexión de un cliente
+        sockaddr_in clientAddress{};
+        socklen_t clientAddressLength = sizeof(clientAddress);
+        // Se crea un socket para el cliente
+        int clientSocket = accept4(serverSocket, (struct sockaddr*)&clientAddress, &clientAddressLength, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        // Se verifica si se aceptó la conexión correctamente
+        if (clientSocket < 0) {
+            if (errno == EMFILE || errno == ENFILE) {
+                // El listener sigue listo mientras falten descriptores, se deja de escuchar un rato para no girar
+                logError("Error accepting client connection: {}", strerror(errno));
+                Reactor& reactor = Worker::current().reactor();
+                reactor.modify(serverSocket, 0);
+                reactor.timers().schedule(AcceptBackoff, [serverSocket] {
+                    Worker::current().reactor().modify(serverSocket, EPOLLIN);
+                });
+            } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                logError("Error accepting client connection: {}", strerror(errno));
+            }
+            return;
+        }
+        addClient(clientSocket, clientAddress);
+    }
+}
+
+#ifdef CHAT_IO_URING
+/**
+ * Acepta conexiones con un accept multishot del io_uring del worker actual
+ *
+ * @param serverSocket Socket del servidor
+ */
+void acceptClientsWithUring(int serverSocket) {
+    Worker::current().reactor().uring()->acceptMultishot(serverSocket, [serverSocket](uint64_t operation, int result, uint32_t flags) {
+        // Sin descriptores el accept fallaria en cada vuelta, se vuelve a iniciar despues de una espera
+        bool exhausted = result == -EMFILE || result == -ENFILE;
+        if (result >= 0) {
+            // El accept multishot no entrega la direccion, se pide aparte
+            sockaddr_in clientAddress{};
+            socklen_t clientAddressLength = sizeof(clientAddress);
+            getpeername(result, (struct sockaddr*)&clientAddress, &clientAddressLength);
+            addClient(result, clientAddress);
+        } else if (result != -ECANCELED) {
+            logError("Error accepting client connection: {}", strerror(-result));
+        }
+        if (exhausted && Uring::hasMore(flags)) {
+            // Su ultima completion llega con -ECANCELED y reprograma el accept
+            Worker::current().reactor().uring()->cancel(operation);
+            return;
+        }
+        // Si el accept multishot termino se vuelve a iniciar
+        if (!Uring::hasMore(flags)) {
+            if (exhausted || result == -ECANCELED) {
+                Worker::current().reactor().timers().schedule(AcceptBackoff, [serverSocket] { acceptClientsWithUring(serverSocket); });
+            } else {
+                acceptClientsWithUring(serverSocket);
+            }
+        }
+    });
+}
+#endif
+
+/**
+ * Crea un socket que escucha en la IP y puerto del servidor. Cada worker tiene
+ * el suyo con SO_REUSEPORT y el kernel reparte las conexiones entre ellos.
+ *
+ * @return El socket o -1 si hubo un error
+ */
+int createListener() {
+    int serverSocket = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
     if (serverSocket < 0) {
-        std::cerr << "Error creating socket: " << strerror(errno) << "\n";
-        return 1;
+        logError("Error creating socket: {}", strerror(errno));
+        return -1;
+    }
+
+    // Se permite reutilizar el puerto aunque queden conexiones en TIME_WAIT,
+    // y que varios sockets escuchen en el mismo puerto
+    int reuse = 1;
+    setsockopt(serverSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (setsockopt(serverSocket, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) < 0) {
+        logError("Error enabling SO_REUSEPORT: {}", strerror(errno));
+        close(serverSocket);
+        return -1;
     }
 
-    // Se configura el socket del servidor con el puerto 8080
     sockaddr_in serverAddress{};
     serverAddress.sin_family = AF_INET;
-    serverAddress.sin_addr.s_addr = inet_addr(serverIP.c_str());
-    serverAddress.sin_port = htons(8080);
+    serverAddress.sin_addr.s_addr = inet_addr(config.ip.c_str());
+    serverAddress.sin_port = htons(config.port);
 
     // Se enlaza el socket del servidor con la dirección y el puerto
     if (bind(serverSocket, (struct sockaddr*)&serverAddress, sizeof(serverAddress)) < 0) {
-        std::cerr << "Error binding socket: " << strerror(errno) << "\n";
+        logError("Error binding socket: {}", strerror(errno));
         close(serverSocket);
-        return 1;
+        return -1;
     }
 
-    // Se pone el servidor a escuchar en el puerto 8080
-    if (listen(serverSocket, 10) < 0) {
-        std::cerr << "Error listening on socket: " << strerror(errno) << "\n";
+    // Se pone el socket a escuchar
+    if (listen(serverSocket, SOMAXCONN) < 0) {
+        logError("Error listening on socket: {}", strerror(errno));
         close(serverSocket);
+        return -1;
+    }
+    return serverSocket;
+}
+
+/**
+ * Funcion principal del servidor
+ *
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos
+ */
+int main(int argc, char* argv[]) {
+    // Se verifica que se haya ingresado la IP del servidor y que las opciones sean validas
+    if (!parseServerConfig(argc, argv, config)) {
+        printServerUsage();
         return 1;
     }
+    // Desde aqui los mensajes pasan por el hilo del log, lo pendiente se escribe al salir
+    startLogging(config.log);
 
-    std::cout << "Server started. Listening on port 8080...\n";
+    // Por defecto se usa un worker por nucleo
+    size_t workerCount = config.workers;
+    if (workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
 
-    // Se crea un hilo para recibir los mensajes del servidor
-    std::thread statusWatcher(userScanner);
-    statusWatcher.detach();
-    // Se crea un loop infinito para aceptar conexiones de clientes
-    while (true) {
-        // Se acepta la conexión de un cliente
-        sockaddr_in clientAddress{};
-        socklen_t clientAddressLength = sizeof(clientAddress);
-        // Se obtiene la IP del cliente
-        // std::string ipAddress = inet_ntoa(clientAddress.sin_addr);
-        // std::cout << "Client IP: " << ipAddress << "\n";
-        // Se crea un socket para el cliente
-        int clientSocket = accept(serverSocket, (struct sockaddr*)&clientAddress, &clientAddressLength);
-        // Se verifica si se aceptó la conexión correctamente
-        if (clientSocket < 0) {
-            std::cerr << "Error accepting client connection: " << strerror(errno) << "\n";
-            continue;
+#ifndef CHAT_IO_URING
+    if (config.io == IoBackend::Uring) {
+        logWarn("Server built without io_uring support, using epoll");
+    }
+#endif
+
+    // El historial se recupera antes de aceptar clientes para seguir con los offsets donde quedaron
+    if (!config.historyDir.empty()) {
+        std::string error;
+        if (!history.open(config.historyDir, config.historySegmentSize, config.historySync, error)) {
+            logError("Error opening history: {}", error);
+            return 1;
         }
+    }
 
-        char clientIP[INET_ADDRSTRLEN];
-        inet_ntop(AF_INET, &(clientAddress.sin_addr), clientIP, INET_ADDRSTRLEN);
-        std::cout << "Client IP: " << clientIP << "\n";
+    recentBroadcasts.setLimits(config.broadcastRing, config.broadcastRingBytes);
+    presence.setCapacity(config.presenceBacklog);
 
-        // Convert const char* to std::string
-        std::string clientIpStr = clientIP;
+    // Cada worker escribe solo en sus metricas, se crean antes de arrancar los hilos
+    metrics.init(workerCount);
+    if (config.metricsPort > 0) {
+        std::string error;
+        if (!startMetricsServer(config.metricsPort, [] { return buildMetricsReport().prometheus(); }, error)) {
+            logError("Error starting metrics listener: {}", error);
+            return 1;
+        }
+    }
+
+    // Cada worker tiene su propio socket de escucha, su reactor y sus timers
+    std::vector<int> listeners;
+    size_t uringWorkers = 0;
+    for (size_t i = 0; i < workerCount; i++) {
+        int serverSocket = createListener();
+        if (serverSocket < 0) {
+            for (int listener : listeners) {
+                close(listener);
+            }
+            return 1;
+        }
+        listeners.push_back(serverSocket);
 
-        // Se crea un thread para manejar las request del cliente
-        clientThreads.emplace_back(std::thread(handleClient, clientSocket, clientIpStr));
+        auto worker = std::make_unique<Worker>(i);
+        worker->setFlushHandler(flushScheduled);
+        // Lo primero que hace el hilo del worker es asociarse a sus metricas, asi el registro tambien las usa
+        worker->post([i] { WorkerMetrics::bind(&metrics.worker(i)); });
+        bool acceptingWithUring = false;
+#ifdef CHAT_IO_URING
+        std::string error;
+        if (config.io == IoBackend::Uring) {
+            if (worker->reactor().enableUring(RingEntries, error)) {
+                // El accept se inicia desde el hilo del worker, que es el unico que usa su ring
+                worker->post([serverSocket] { acceptClientsWithUring(serverSocket); });
+                acceptingWithUring = true;
+                uringWorkers++;
+            } else {
+                logWarn("io_uring unavailable ({}), worker {} uses epoll", error, i);
+            }
+        }
+#endif
+        if (!acceptingWithUring) {
+            worker->reactor().add(serverSocket, EPOLLIN, [serverSocket](uint32_t) { acceptClients(serverSocket); });
+        }
+        // La inactividad de cada usuario se revisa con su propio timer
+        worker->reactor().setTimerResolution(config.timerResolution);
+        workers.push_back(std::move(worker));
     }
 
-    // Se espera que el hilo de recepcion de mensajes termine
-    if (statusWatcher.joinable())
-    {
-        statusWatcher.join();
+    if (uringWorkers > 0) {
+        logInfo("Server started. Listening on port {} with {} workers ({} using io_uring)...", config.port, workerCount,
+                uringWorkers);
+    } else {
+        logInfo("Server started. Listening on port {} with {} workers...", config.port, workerCount);
     }
 
-    // Cuando se cierra, se espera que todos los threads terminen
-    for (auto& thread : clientThreads) {
-        if (thread.joinable()) {
-            thread.join();
-        }
+    // Los contadores de las colas se revisan cada segundo desde el primer worker
+    workers[0]->post(scheduleCounterReport);
+
+    // El primer worker usa el hilo principal, el resto tiene su propio hilo
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < workers.size(); i++) {
+        threads.emplace_back([i] { workers[i]->run(); });
+    }
+    workers[0]->run();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    // Se cierran los sockets del servidor
+    for (int listener : listeners) {
+        close(listener);
     }
-    
-    // Se cierra el socket del servidor
-    close(serverSocket);
     return 0;
 }
@@ -0,0 +1,80 @@
+// broadcast_ring.cpp
+#include "./broadcast_ring.h"
+
+#include <algorithm>
+
+void BroadcastRing::setLimits(size_t capacity, size_t limit) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Los lugares se reservan una sola vez, agregar mensajes nunca vuelve a pedir memoria para el ring
+    slots.assign(std::max<size_t>(capacity, 1), Item{});
+    head = 0;
+    count = 0;
+    bytes = 0;
+    maxBytes = limit;
+}
+
+void BroadcastRing::evictOldest() {
+    Item& oldest = at(0);
+    evictedOffset = std::max(evictedOffset, oldest.offset);
+    bytes -= oldest.frame->size();
+    oldest.frame.reset();
+    head = (head + 1) % slots.size();
+    count--;
+}
+
+void BroadcastRing::push(uint64_t offset, const SharedFrame& frame) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (slots.empty()) {
+        return;
+    }
+    // Un mensaje que no entra en el ring, o que llega despues de que se descartaron
+    // otros mas nuevos, cuenta como descartado
+    if (frame->size() > maxBytes || offset <= evictedOffset) {
+        evictedOffset = std::max(evictedOffset, offset);
+        return;
+    }
+    while (count == slots.size() || bytes + frame->size() > maxBytes) {
+        evictOldest();
+    }
+
+    // Casi siempre el mensaje es el mas nuevo, si no se corren los que tienen un offset mayor
+    size_t position = count;
+    while (position > 0 && at(position - 1).offset > offset) {
+        at(position) = std::move(at(position - 1));
+        position--;
+    }
+    at(position) = Item{offset, frame};
+    count++;
+    bytes += frame->size();
+}
+
+BroadcastRing::Slice BroadcastRing::since(uint64_t afterOffset, size_t limit) const {
+    Slice slice;
+    slice.lastOffset = afterOffset;
+    std::lock_guard<std::mutex> lock(mutex);
+    slice.gap = afterOffset < evictedOffset;
+
+    // Busqueda binaria del primer mensaje despues del cursor
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        size_t middle = (low + high) / 2;
+        if (at(middle).offset <= afterOffset) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    size_t total = 0;
+    for (size_t i = low; i < count; i++) {
+        const Item& item = at(i);
+        if (total + item.frame->size() > limit) {
+            break;
+        }
+        total += item.frame->size();
+        slice.frames.push_back(item.frame);
+        slice.lastOffset = item.offset;
+    }
+    return slice;
+}
@@ -0,0 +1,72 @@
+// broadcast_ring.h
+#ifndef BROADCAST_RING_H
+#define BROADCAST_RING_H
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "protocol/message.h"
+
+/**
+ * Ultimos broadcasts del servidor guardados en memoria como frames ya
+ * serializados. El ring tiene una cantidad fija de lugares y un limite de
+ * bytes: al pasar cualquiera de los dos se descartan los mensajes mas viejos,
+ * asi la memoria no crece sin importar cuantos mensajes se envien. Los
+ * clientes que se reconectan con el offset del ultimo mensaje que vieron
+ * reciben lo que les falto directo de aqui, sin leer el historial en disco.
+ */
+class BroadcastRing {
+public:
+    // Mensajes que le faltan a un cliente
+    struct Slice {
+        std::vector<SharedFrame> frames;  // Frames en orden de offset
+        uint64_t lastOffset = 0;          // Offset del ultimo frame, o el cursor si no hay ninguno
+        bool gap = false;                 // Se descartaron mensajes posteriores al cursor
+    };
+
+    /**
+     * Define el tamaño del ring, se debe llamar antes de usarlo
+     *
+     * @param capacity Cantidad maxima de mensajes
+     * @param maxBytes Suma maxima del tamaño de los frames
+     */
+    void setLimits(size_t capacity, size_t maxBytes);
+
+    /**
+     * Agrega un broadcast. Los workers pueden agregar mensajes en un orden
+     * un poco distinto al de sus offsets, el ring los deja ordenados.
+     *
+     * @param offset Offset del mensaje en el historial
+     * @param frame Frame del mensaje
+     */
+    void push(uint64_t offset, const SharedFrame& frame);
+
+    /**
+     * Busca los mensajes posteriores a un cursor
+     *
+     * @param afterOffset Offset del ultimo mensaje que vio el cliente
+     * @param maxBytes Tamaño maximo de los frames devueltos
+     */
+    Slice since(uint64_t afterOffset, size_t maxBytes) const;
+
+private:
+    struct Item {
+        uint64_t offset = 0;
+        SharedFrame frame;
+    };
+
+    // Item en la posicion logica i, 0 es el mas viejo
+    Item& at(size_t i) { return slots[(head + i) % slots.size()]; }
+    const Item& at(size_t i) const { return slots[(head + i) % slots.size()]; }
+    void evictOldest();
+
+    mutable std::mutex mutex;
+    std::vector<Item> slots;
+    size_t head = 0;
+    size_t count = 0;
+    size_t bytes = 0;
+    size_t maxBytes = 0;
+    uint64_t evictedOffset = 0;  // Mayor offset descartado
+};
+
+#endif
@@ -0,0 +1,107 @@
+// channel_index.cpp
+#include "./channel_index.h"
+
+#include <algorithm>
+
+/**
+ * Busca la suscripcion de una conexion a un canal
+ */
+static ChannelMembership* membershipOf(Connection& connection, std::string_view channel) {
+    for (ChannelMembership& membership : connection.channels) {
+        if (membership.channel == channel) {
+            return &membership;
+        }
+    }
+    return nullptr;
+}
+
+bool ChannelIndex::isMember(const Connection& connection, std::string_view channel) {
+    return std::any_of(connection.channels.begin(), connection.channels.end(),
+                       [channel](const ChannelMembership& membership) { return membership.channel == channel; });
+}
+
+bool ChannelIndex::join(const std::string& channel, Connection& connection) {
+    std::vector<Connection*>& list = channels[channel];
+    connection.channels.push_back({channel, list.size()});
+    list.push_back(&connection);
+    return list.size() == 1;
+}
+
+bool ChannelIndex::leave(const std::string& channel, Connection& connection) {
+    ChannelMembership* membership = membershipOf(connection, channel);
+    auto it = channels.find(channel);
+    if (membership == nullptr || it == channels.end()) {
+        return false;
+    }
+    // Se mueve el ultimo suscriptor al hueco y se actualiza su posicion en el canal
+    std::vector<Connection*>& list = it->second;
+    Connection* last = list.back();
+    list[membership->position] = last;
+    membershipOf(*last, channel)->position = membership->position;
+    list.pop_back();
+
+    if (membership != &connection.channels.back()) {
+        *membership = std::move(connection.channels.back());
+    }
+    connection.channels.pop_back();
+
+    if (!list.empty()) {
+        return false;
+    }
+    channels.erase(it);
+    return true;
+}
+
+void ChannelIndex::leaveAll(Connection& connection, const std::function<void(const std::string&)>& emptied) {
+    while (!connection.channels.empty()) {
+        std::string channel = connection.channels.back().channel;
+        if (leave(channel, connection)) {
+            emptied(channel);
+        }
+    }
+}
+
+const std::vector<Connection*>* ChannelIndex::subscribers(const std::string& channel) const {
+    auto it = channels.find(channel);
+    return it == channels.end() ? nullptr : &it->second;
+}
+
+ChannelDirectory::ChannelDirectory(size_t shardCount) : shards(new Shard[shardCount]), shardCount(shardCount) {}
+
+ChannelDirectory::Shard& ChannelDirectory::shardFor(const std::string& channel) const {
+    return shards[std::hash<std::string>{}(channel) % shardCount];
+}
+
+void ChannelDirectory::add(const std::string& channel, size_t worker) {
+    Shard& shard = shardFor(channel);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    WorkerList& current = shard.channels[channel];
+    auto updated = current ? std::make_shared<std::vector<size_t>>(*current) : std::make_shared<std::vector<size_t>>();
+    if (std::find(updated->begin(), updated->end(), worker) == updated->end()) {
+        updated->push_back(worker);
+    }
+    current = std::move(updated);
+}
+
+void ChannelDirectory::remove(const std::string& channel, size_t worker) {
+    Shard& shard = shardFor(channel);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.channels.find(channel);
+    if (it == shard.channels.end()) {
+        return;
+    }
+    auto updated = std::make_shared<std::vector<size_t>>(*it->second);
+    updated->erase(std::remove(updated->begin(), updated->end(), worker), updated->end());
+    if (updated->empty()) {
+        shard.channels.erase(it);
+    } else {
+        it->second = std::move(updated);
+    }
+}
+
+ChannelDirectory::WorkerList ChannelDirectory::workers(const std::string& channel) const {
+    Shard& shard = shardFor(channel);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.channels.find(channel);
+    return it == shard.channels.end() ? nullptr : it->second;
+}
@@ -0,0 +1,106 @@
+// channel_index.h
+#ifndef CHANNEL_INDEX_H
+#define CHANNEL_INDEX_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "server/connection.h"
+
+/**
+ * Suscriptores de los canales dentro de un worker. Cada canal tiene un vector
+ * compacto con las conexiones suscritas de este worker, asi un mensaje de
+ * canal se reparte recorriendo solo a sus suscriptores. Cada conexion guarda
+ * su posicion en cada canal, quitarla es O(1) como con los miembros del worker.
+ * Solo se usa desde el hilo de su worker.
+ */
+class ChannelIndex {
+public:
+    /**
+     * Suscribe una conexion a un canal, no debe estar suscrita ya
+     *
+     * @param channel Canal
+     * @param connection Conexion a suscribir
+     * @return true si es el primer suscriptor del canal en este worker
+     */
+    bool join(const std::string& channel, Connection& connection);
+
+    /**
+     * Quita la suscripcion de una conexion a un canal
+     *
+     * @param channel Canal
+     * @param connection Conexion suscrita
+     * @return true si el canal quedo sin suscriptores en este worker
+     */
+    bool leave(const std::string& channel, Connection& connection);
+
+    /**
+     * Quita todas las suscripciones de una conexion
+     *
+     * @param connection Conexion que se cierra o se desregistra
+     * @param emptied Se llama con cada canal que quedo sin suscriptores en este worker
+     */
+    void leaveAll(Connection& connection, const std::function<void(const std::string&)>& emptied);
+
+    /**
+     * Suscriptores de un canal en este worker
+     *
+     * @return La lista o nullptr si el canal no tiene suscriptores aqui
+     */
+    const std::vector<Connection*>* subscribers(const std::string& channel) const;
+
+    // Si una conexion esta suscrita a un canal
+    static bool isMember(const Connection& connection, std::string_view channel);
+
+private:
+    std::unordered_map<std::string, std::vector<Connection*>> channels;
+};
+
+/**
+ * Workers que tienen suscriptores de cada canal, compartido entre todos. Un
+ * mensaje de canal solo se le manda a esos workers en lugar de a todos. La
+ * lista de cada canal es inmutable y se reemplaza al cambiar, leerla solo
+ * copia un shared_ptr con el shard bloqueado. Los canales se reparten en
+ * shards por hash como el registro de sesiones.
+ */
+class ChannelDirectory {
+public:
+    using WorkerList = std::shared_ptr<const std::vector<size_t>>;
+
+    explicit ChannelDirectory(size_t shardCount = 64);
+
+    /**
+     * Registra que un worker tiene suscriptores de un canal
+     */
+    void add(const std::string& channel, size_t worker);
+
+    /**
+     * Registra que un worker ya no tiene suscriptores de un canal
+     */
+    void remove(const std::string& channel, size_t worker);
+
+    /**
+     * Workers con suscriptores de un canal
+     *
+     * @return La lista o nullptr si nadie esta suscrito
+     */
+    WorkerList workers(const std::string& channel) const;
+
+private:
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, WorkerList> channels;
+    };
+
+    Shard& shardFor(const std::string& channel) const;
+
+    std::unique_ptr<Shard[]> shards;
+    size_t shardCount;
+};
+
+#endif
@@ -0,0 +1,183 @@
+// config.cpp
+#include "./config.h"
+
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * Convierte el valor de una opcion a size_t
+ */
+static bool parseSize(const std::string& value, size_t& out) {
+    try {
+        size_t used = 0;
+        unsigned long long parsed = std::stoull(value, &used);
+        if (used != value.size()) {
+            return false;
+        }
+        out = parsed;
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+/**
+ * Convierte un valor en segundos (acepta decimales, por ejemplo 0.5) a milisegundos
+ */
+static bool parseSeconds(const std::string& value, std::chrono::milliseconds& out) {
+    try {
+        size_t used = 0;
+        double seconds = std::stod(value, &used);
+        if (used != value.size() || seconds <= 0) {
+            return false;
+        }
+        out = std::chrono::milliseconds(static_cast<int64_t>(seconds * 1000));
+        return out.count() > 0;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool parseServerConfig(int argc, char* argv[], ServerConfig& config) {
+    if (argc < 2) {
+        return false;
+    }
+    config.ip = argv[1];
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        size_t equals = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || equals == std::string::npos) {
+            std::cerr << "Invalid option: " << arg << "\n";
+            return false;
+        }
+        std::string name = arg.substr(2, equals - 2);
+        std::string value = arg.substr(equals + 1);
+
+        bool ok = true;
+        if (name == "high-watermark") {
+            ok = parseSize(value, config.outbound.highWatermark);
+        } else if (name == "low-watermark") {
+            ok = parseSize(value, config.outbound.lowWatermark);
+        } else if (name == "max-queue") {
+            ok = parseSize(value, config.outbound.maxQueueBytes);
+        } else if (name == "port") {
+            size_t port = 0;
+            ok = parseSize(value, port) && port > 0 && port <= 65535;
+            config.port = static_cast<uint16_t>(port);
+        } else if (name == "workers") {
+            ok = parseSize(value, config.workers);
+        } else if (name == "idle-timeout") {
+            ok = parseSeconds(value, config.idleTimeout);
+        } else if (name == "timer-resolution") {
+            size_t milliseconds = 0;
+            ok = parseSize(value, milliseconds) && milliseconds > 0;
+            config.timerResolution = std::chrono::milliseconds(milliseconds);
+        } else if (name == "history-dir") {
+            config.historyDir = value;
+        } else if (name == "history-segment-size") {
+            // El segmento tiene que poder guardar al menos un frame de tamaño maximo
+            ok = parseSize(value, config.historySegmentSize) && config.historySegmentSize >= 1024 * 1024;
+        } else if (name == "history-sync") {
+            size_t milliseconds = 0;
+            ok = parseSize(value, milliseconds) && milliseconds > 0;
+            config.historySync = std::chrono::milliseconds(milliseconds);
+        } else if (name == "broadcast-ring") {
+            ok = parseSize(value, config.broadcastRing) && config.broadcastRing > 0;
+        } else if (name == "broadcast-ring-bytes") {
+            ok = parseSize(value, config.broadcastRingBytes);
+        } else if (name == "compression-threshold") {
+            ok = parseSize(value, config.compressionThreshold);
+        } else if (name == "presence-interval") {
+            size_t milliseconds = 0;
+            ok = parseSize(value, milliseconds) && milliseconds > 0;
+            config.presenceInterval = std::chrono::milliseconds(milliseconds);
+        } else if (name == "presence-backlog") {
+            ok = parseSize(value, config.presenceBacklog) && config.presenceBacklog > 0;
+        } else if (name == "metrics-port") {
+            size_t port = 0;
+            ok = parseSize(value, port) && port <= 65535;
+            config.metricsPort = static_cast<uint16_t>(port);
+        } else if (name == "log-level") {
+            if (value == "debug") {
+                config.log.level = LogLevel::Debug;
+            } else if (value == "info") {
+                config.log.level = LogLevel::Info;
+            } else if (value == "warn") {
+                config.log.level = LogLevel::Warn;
+            } else if (value == "error") {
+                config.log.level = LogLevel::Error;
+            } else {
+                ok = false;
+            }
+        } else if (name == "log-rate") {
+            ok = parseSize(value, config.log.rateLimit);
+        } else if (name == "log-content") {
+            if (value == "on") {
+                config.log.content = true;
+            } else if (value == "off") {
+                config.log.content = false;
+            } else {
+                ok = false;
+            }
+        } else if (name == "io") {
+            if (value == "epoll") {
+                config.io = IoBackend::Epoll;
+            } else if (value == "uring") {
+                config.io = IoBackend::Uring;
+            } else {
+                ok = false;
+            }
+        } else if (name == "slow-consumer") {
+            if (value == "drop") {
+                config.outbound.policy = SlowConsumerPolicy::DropBroadcasts;
+            } else if (value == "disconnect") {
+                config.outbound.policy = SlowConsumerPolicy::Disconnect;
+            } else {
+                ok = false;
+            }
+        } else {
+            std::cerr << "Unknown option: --" << name << "\n";
+            return false;
+        }
+
+        if (!ok) {
+            std::cerr << "Invalid value for --" << name << ": " << value << "\n";
+            return false;
+        }
+    }
+
+    if (config.outbound.lowWatermark > config.outbound.highWatermark ||
+        config.outbound.highWatermark > config.outbound.maxQueueBytes) {
+        std::cerr << "Watermarks must satisfy low-watermark <= high-watermark <= max-queue\n";
+        return false;
+    }
+    return true;
+}
+
+void printServerUsage() {
+    std::cerr << "Usage: server <server_ip> [options]\n"
+              << "  --port=<port>             TCP port to listen on (default 8080)\n"
+              << "  --workers=<count>         Event loop threads, 0 for one per core (default 0)\n"
+              << "  --io=<backend>            epoll (default) or uring, uring falls back to epoll if unavailable\n"
+              << "  --high-watermark=<bytes>  Pause reading a client whose outbound queue reaches this size\n"
+              << "  --low-watermark=<bytes>   Resume reading once the queue drains below this size\n"
+              << "  --max-queue=<bytes>       Disconnect a client whose outbound queue exceeds this size\n"
+              << "  --slow-consumer=<policy>  drop: drop broadcasts above the high watermark (default)\n"
+              << "                            disconnect: never drop, only disconnect at max-queue\n"
+              << "  --idle-timeout=<seconds>  Inactivity before a user is set OFFLINE, decimals allowed (default 60)\n"
+              << "  --timer-resolution=<ms>   Tick length of the idle timers (default 100)\n"
+              << "  --history-dir=<path>      Directory of the message history log, disabled when empty (default empty)\n"
+              << "  --history-segment-size=<bytes>  Size of each history segment file, at least 1 MiB (default 64 MiB)\n"
+              << "  --history-sync=<ms>       Interval between flushes of the history to disk (default 200)\n"
+              << "  --broadcast-ring=<count>  Recent broadcasts kept in memory for reconnecting clients (default 1024)\n"
+              << "  --broadcast-ring-bytes=<bytes>  Memory cap of the recent broadcasts (default 1 MiB)\n"
+              << "  --compression-threshold=<bytes>  Compress frames from this payload size for clients that\n"
+              << "                            negotiate zlib, 0 to disable compression (default 1024)\n"
+              << "  --presence-interval=<ms>  Window over which presence changes are coalesced before being pushed (default 100)\n"
+              << "  --presence-backlog=<count>  Recent presence changes kept for subscribers catching up (default 4096)\n"
+              << "  --metrics-port=<port>     Serve Prometheus metrics over HTTP on 127.0.0.1, 0 to disable (default 0)\n"
+              << "  --log-level=<level>       debug, info (default), warn or error; messages are only logged at debug\n"
+              << "  --log-rate=<count>        Times per second each thread logs the same warning or error, 0 for no limit (default 10)\n"
+              << "  --log-content=<on|off>    Log the content of user messages instead of only their size (default off)\n";
+}
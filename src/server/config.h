@@ -0,0 +1,69 @@
+// config.h
+#ifndef SERVER_CONFIG_H
+#define SERVER_CONFIG_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "server/logger.h"
+
+// Que hacer con un cliente que no lee sus mensajes tan rapido como se le envian
+enum class SlowConsumerPolicy {
+    DropBroadcasts, // Sobre el high watermark se descartan los broadcasts hacia ese cliente
+    Disconnect      // No se descarta nada, el cliente se desconecta al pasar el limite
+};
+
+// Mecanismo con el que el servidor hace el I/O de los sockets
+enum class IoBackend {
+    Epoll, // Readiness con epoll y recv/sendmsg por socket
+    Uring  // Operaciones en lote con io_uring, si no esta disponible se usa epoll
+};
+
+// Limites de la cola de salida de cada conexion, en bytes
+struct OutboundLimits {
+    size_t highWatermark = 256 * 1024;   // Se deja de leer al cliente (y se descartan broadcasts con DropBroadcasts)
+    size_t lowWatermark = 64 * 1024;     // Se vuelve a leer al cliente cuando la cola baja de aqui
+    size_t maxQueueBytes = 4 * 1024 * 1024; // Si la cola pasa de aqui el cliente se desconecta
+    SlowConsumerPolicy policy = SlowConsumerPolicy::DropBroadcasts;
+};
+
+// Configuracion del servidor, se llena desde la linea de comandos
+struct ServerConfig {
+    std::string ip;
+    uint16_t port = 8080;
+    size_t workers = 0;  // Hilos con su propio ciclo de eventos, 0 para usar uno por nucleo
+    IoBackend io = IoBackend::Epoll;
+    OutboundLimits outbound;
+    std::chrono::milliseconds idleTimeout{60000};   // Tiempo sin enviar mensajes para pasar a OFFLINE
+    std::chrono::milliseconds timerResolution{100}; // Duracion de un tick de los timers
+    std::string historyDir;                          // Directorio del historial, vacio para no guardarlo
+    size_t historySegmentSize = 64 * 1024 * 1024;    // Tamaño de cada segmento del historial
+    std::chrono::milliseconds historySync{200};      // Cada cuanto se sincroniza el historial a disco
+    size_t broadcastRing = 1024;                     // Broadcasts recientes que se guardan en memoria
+    size_t broadcastRingBytes = 1024 * 1024;         // Limite de memoria de esos broadcasts
+    size_t compressionThreshold = 1024;              // Payloads desde este tamaño se comprimen, 0 para no negociar compresion
+    std::chrono::milliseconds presenceInterval{100}; // Ventana en la que se juntan los cambios de presencia antes de enviarlos
+    size_t presenceBacklog = 4096;                   // Cambios de presencia recientes guardados para ponerse al dia
+    uint16_t metricsPort = 0;                        // Puerto en localhost con las metricas para Prometheus, 0 para no abrirlo
+    LogOptions log;
+};
+
+/**
+ * Lee la configuracion del servidor de los argumentos
+ *
+ * Uso: server <server_ip> [--opcion=valor ...]
+ *
+ * @param argc Cantidad de argumentos
+ * @param argv Argumentos
+ * @param config Configuracion a llenar
+ * @return false si algun argumento no es valido
+ */
+bool parseServerConfig(int argc, char* argv[], ServerConfig& config);
+
+/**
+ * Imprime el uso del servidor y sus opciones
+ */
+void printServerUsage();
+
+#endif
@@ -0,0 +1,105 @@
+// connection.cpp
+#include "./connection.h"
+
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include "server/metrics.h"
+#include "server/logger.h"
+
+OutboundCounters outboundCounters;
+
+QueueResult queueFrame(Connection& connection, SharedFrame frame, const OutboundLimits& limits, bool droppable) {
+    // Con la cola congestionada los broadcasts se descartan si la politica lo permite
+    if (droppable && connection.congested && limits.policy == SlowConsumerPolicy::DropBroadcasts) {
+        outboundCounters.droppedBroadcasts++;
+        return QueueResult::Dropped;
+    }
+    if (connection.outBytes + frame->size() > limits.maxQueueBytes) {
+        outboundCounters.slowConsumerDisconnects++;
+        return QueueResult::Overflow;
+    }
+
+    connection.outBytes += frame->size();
+    connection.outQueue.push_back(std::move(frame));
+    if (!connection.congested && connection.outBytes >= limits.highWatermark) {
+        connection.congested = true;
+        outboundCounters.readPauses++;
+    }
+    return QueueResult::Queued;
+}
+
+uint32_t wantedEvents(const Connection& connection) {
+    uint32_t events = 0;
+    // No se leen mas requests mientras el cliente no lea sus respuestas o si se va a cerrar
+    if (!connection.congested && !connection.closeAfterFlush) {
+        events |= EPOLLIN;
+    }
+    if (!connection.outQueue.empty() || connection.closeAfterFlush) {
+        events |= EPOLLOUT;
+    }
+    return events;
+}
+
+size_t collectPending(const Connection& connection, iovec* iov, size_t maxIovecs) {
+    size_t count = 0;
+    for (const SharedFrame& frame : connection.outQueue) {
+        if (count == maxIovecs) {
+            break;
+        }
+        size_t skip = count == 0 ? connection.outOffset : 0;
+        iov[count].iov_base = const_cast<char*>(frame->data()) + skip;
+        iov[count].iov_len = frame->size() - skip;
+        count++;
+    }
+    return count;
+}
+
+void consumeSent(Connection& connection, size_t bytes, const OutboundLimits& limits) {
+    if (WorkerMetrics* metrics = WorkerMetrics::local()) {
+        metrics->bytesOut.add(bytes);
+    }
+    // Soltamos las referencias de los frames que se enviaron completos
+    while (bytes > 0 && !connection.outQueue.empty()) {
+        size_t remaining = connection.outQueue.front()->size() - connection.outOffset;
+        if (bytes < remaining) {
+            connection.outOffset += bytes;
+            break;
+        }
+        bytes -= remaining;
+        connection.outBytes -= connection.outQueue.front()->size();
+        connection.outQueue.pop_front();
+        connection.outOffset = 0;
+    }
+
+    // La conexion deja de estar congestionada al bajar del low watermark
+    if (connection.congested && connection.outBytes <= limits.lowWatermark) {
+        connection.congested = false;
+    }
+}
+
+bool flushConnection(Connection& connection, const OutboundLimits& limits) {
+    iovec iov[MaxIovecs];
+    while (!connection.outQueue.empty()) {
+        // Juntamos varios frames pendientes en una sola llamada
+        msghdr header{};
+        header.msg_iov = iov;
+        header.msg_iovlen = collectPending(connection, iov, MaxIovecs);
+        // Si quedan frames para otra llamada el kernel espera a juntarlos en segmentos completos
+        int flags = MSG_NOSIGNAL | (header.msg_iovlen < connection.outQueue.size() ? MSG_MORE : 0);
+        ssize_t bytes = sendmsg(connection.fd, &header, flags);
+        if (bytes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            }
+            logError("Error al enviar el mensaje");
+            return false;
+        }
+        consumeSent(connection, bytes, limits);
+    }
+    return true;
+}
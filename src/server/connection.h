@@ -0,0 +1,152 @@
+// connection.h
+#ifndef CONNECTION_H
+#define CONNECTION_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sys/uio.h>
+#include <google/protobuf/message.h>
+#include "protocol/message.h"
+#include "server/config.h"
+#include "server/session_registry.h"
+#include "server/timer_wheel.h"
+
+// Canal al que esta suscrita una conexion y su posicion en los suscriptores del canal en su worker
+struct ChannelMembership {
+    std::string channel;
+    size_t position = 0;
+};
+
+/**
+ * Estado de una conexion de cliente dentro del reactor. Los sockets son
+ * no bloqueantes, los frames que no se pudieron enviar se quedan en outQueue
+ * hasta que el socket vuelva a estar listo para escritura.
+ */
+struct Connection {
+    int fd = -1;
+    std::string ip;                 // IP del cliente
+    SessionPtr session;             // Sesion registrada por esta conexion, nullptr si aun no se registra
+    FrameBuffer inBuffer;           // Buffer reutilizable donde se arman los frames recibidos
+    std::chrono::steady_clock::time_point receivedAt; // Cuando se leyo lo ultimo de inBuffer, desde ahi se mide cada request
+    std::deque<SharedFrame> outQueue; // Frames pendientes de enviar, compartidos con otras conexiones
+    size_t outOffset = 0;           // Bytes ya enviados del primer frame de outQueue
+    size_t outBytes = 0;            // Bytes pendientes en outQueue
+    bool congested = false;         // La cola paso el high watermark y no ha bajado del low watermark
+    bool closeAfterFlush = false;   // Cerrar cuando se termine de enviar outQueue
+    uint32_t events = 0;            // Eventos registrados actualmente en el epoll
+    TimerWheel::TimerId idleTimer = 0; // Timer de inactividad de la sesion, 0 si no hay
+    int memberIndex = -1;           // Posicion en los miembros de su worker, -1 si no recibe broadcasts
+    int presenceIndex = -1;         // Posicion en los suscriptores de presencia de su worker, -1 si no esta suscrita
+    std::vector<ChannelMembership> channels; // Canales a los que esta suscrita
+    uint64_t serial = 0;            // Identifica la conexion aunque su socket se reutilice
+    uint64_t recvOperation = 0;     // Recepcion multishot activa con io_uring, 0 si no se esta leyendo
+    bool sending = false;           // Hay un envio de io_uring en curso
+    bool flushScheduled = false;    // Su cola se envia al final de la vuelta actual del ciclo de eventos
+    bool compression = false;       // El cliente negocio compresion, sus frames grandes van comprimidos
+};
+
+/**
+ * Tabla de conexiones indexada directamente por el numero de socket. Los
+ * sockets son enteros pequeños y se reutilizan, asi que un vector es mas
+ * rapido que un mapa y buscar la conexion (y su sesion) de un socket es O(1).
+ */
+class ConnectionTable {
+public:
+    // Busca la conexion de un socket, nullptr si no existe
+    Connection* find(int fd) const {
+        if (fd < 0 || static_cast<size_t>(fd) >= slots.size()) {
+            return nullptr;
+        }
+        return slots[fd].get();
+    }
+
+    // Agrega una conexion en la posicion de su socket
+    void insert(std::unique_ptr<Connection> connection) {
+        size_t fd = connection->fd;
+        if (fd >= slots.size()) {
+            slots.resize(fd + 1);
+        }
+        slots[fd] = std::move(connection);
+    }
+
+    // Saca la conexion de un socket de la tabla y la devuelve
+    std::unique_ptr<Connection> release(int fd) {
+        if (find(fd) == nullptr) {
+            return nullptr;
+        }
+        return std::move(slots[fd]);
+    }
+
+private:
+    std::vector<std::unique_ptr<Connection>> slots;
+};
+
+// Resultado de intentar encolar un frame
+enum class QueueResult {
+    Queued,   // El frame se agrego a la cola
+    Dropped,  // Se descarto por la politica de clientes lentos
+    Overflow  // La cola paso el limite, hay que desconectar al cliente
+};
+
+// Contadores de cuantas veces se aplica cada politica de la cola de salida
+struct OutboundCounters {
+    std::atomic<uint64_t> droppedBroadcasts{0};       // Broadcasts descartados por cola llena
+    std::atomic<uint64_t> slowConsumerDisconnects{0}; // Clientes desconectados por pasar el limite
+    std::atomic<uint64_t> readPauses{0};              // Veces que se dejo de leer a un cliente por backpressure
+};
+
+extern OutboundCounters outboundCounters;
+
+/**
+ * Agrega un frame ya serializado a los pendientes de la conexion respetando
+ * los limites de la cola. Solo se guarda una referencia, el frame no se copia.
+ *
+ * @param connection Conexion destino
+ * @param frame Frame a enviar
+ * @param limits Limites de la cola de salida
+ * @param droppable Si el frame se puede descartar cuando el cliente va atrasado (broadcasts)
+ */
+QueueResult queueFrame(Connection& connection, SharedFrame frame, const OutboundLimits& limits, bool droppable = false);
+
+// Cantidad maxima de frames que se envian en una sola llamada a sendmsg
+constexpr size_t MaxIovecs = 64;
+
+/**
+ * Arma los iovec con los frames pendientes de la conexion, sin copiarlos
+ *
+ * @param connection Conexion con frames pendientes
+ * @param iov Arreglo donde se escriben los iovec
+ * @param maxIovecs Tamaño del arreglo
+ * @return Cantidad de iovec escritos
+ */
+size_t collectPending(const Connection& connection, iovec* iov, size_t maxIovecs);
+
+/**
+ * Quita de outQueue los bytes que ya se enviaron y actualiza la congestion
+ *
+ * @param connection Conexion que envio
+ * @param bytes Bytes enviados
+ * @param limits Limites de la cola de salida
+ */
+void consumeSent(Connection& connection, size_t bytes, const OutboundLimits& limits);
+
+/**
+ * Envia todo lo posible de outQueue sin bloquear
+ *
+ * @param connection Conexion a vaciar
+ * @param limits Limites de la cola de salida, para saber cuando deja de estar congestionada
+ * @return false si ocurrio un error en el socket
+ */
+bool flushConnection(Connection& connection, const OutboundLimits& limits);
+
+/**
+ * Calcula los eventos de epoll que le interesan a la conexion segun su estado
+ */
+uint32_t wantedEvents(const Connection& connection);
+
+#endif
@@ -0,0 +1,462 @@
+// history_log.cpp
+#include "./history_log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "server/logger.h"
+
+namespace {
+
+// Header de cada registro dentro de un segmento, seguido por el remitente,
+// el destinatario y el frame del mensaje
+struct RecordHeader {
+    uint32_t length;          // Bytes despues del header, 0 marca el final del segmento
+    uint32_t checksum;        // FNV-1a de esos bytes, detecta registros a medio escribir
+    uint64_t offset;
+    uint16_t senderLength;
+    uint16_t recipientLength;
+    uint8_t kind;             // HistoryLog::Kind del mensaje
+    uint8_t reserved[3];
+};
+
+constexpr size_t RecordAlignment = 8;
+
+size_t recordSize(uint32_t length) {
+    return (sizeof(RecordHeader) + length + RecordAlignment - 1) & ~(RecordAlignment - 1);
+}
+
+uint32_t checksum(const char* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 16777619u;
+    }
+    return hash;
+}
+
+// Segmento como lo ve una lectura, solo con los bytes que estaban publicados al empezar
+struct SegmentView {
+    const char* data;
+    size_t used;
+};
+
+// Mensaje visible para quien lee, apunta al frame dentro del mapeo
+struct VisibleRecord {
+    uint64_t offset;
+    const char* frame;
+    size_t size;
+};
+
+std::string segmentName(const std::string& directory, uint64_t baseOffset) {
+    char name[32];
+    snprintf(name, sizeof(name), "%020llu.log", static_cast<unsigned long long>(baseOffset));
+    return directory + "/" + name;
+}
+
+}
+
+HistoryLog::~HistoryLog() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    logWake.notify_all();
+    if (logThread.joinable()) {
+        logThread.join();
+    }
+    for (auto& segment : segments) {
+        msync(segment->data, segment->size, MS_SYNC);
+        munmap(segment->data, segment->size);
+        close(segment->fd);
+    }
+}
+
+bool HistoryLog::open(const std::string& path, size_t size, std::chrono::milliseconds interval, std::string& error) {
+    directory = path;
+    segmentSize = size;
+    syncInterval = interval;
+    if (mkdir(directory.c_str(), 0755) < 0 && errno != EEXIST) {
+        error = "mkdir " + directory + ": " + strerror(errno);
+        return false;
+    }
+
+    // Los segmentos se llaman como su primer offset, ordenarlos por nombre es ordenarlos por offset
+    std::vector<uint64_t> bases;
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+        error = "opendir " + directory + ": " + strerror(errno);
+        return false;
+    }
+    while (dirent* item = readdir(dir)) {
+        std::string name = item->d_name;
+        if (name.size() == 24 && name.compare(20, 4, ".log") == 0) {
+            bases.push_back(std::stoull(name.substr(0, 20)));
+        }
+    }
+    closedir(dir);
+    std::sort(bases.begin(), bases.end());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (uint64_t base : bases) {
+        std::unique_ptr<Segment> segment = openSegment(base, false, error);
+        if (!segment) {
+            return false;
+        }
+        recover(*segment);
+        segments.push_back(std::move(segment));
+    }
+    if (segments.empty()) {
+        std::unique_ptr<Segment> segment = openSegment(nextOffset, true, error);
+        if (!segment) {
+            return false;
+        }
+        segments.push_back(std::move(segment));
+    }
+    publishedOffset = nextOffset;
+    logThread = std::thread([this] { writeLoop(); });
+    return true;
+}
+
+std::unique_ptr<HistoryLog::Segment> HistoryLog::openSegment(uint64_t baseOffset, bool create, std::string& error) {
+    std::string name = segmentName(directory, baseOffset);
+    int fd = ::open(name.c_str(), O_RDWR | O_CLOEXEC | (create ? O_CREAT | O_EXCL : 0), 0644);
+    if (fd < 0) {
+        error = "open " + name + ": " + strerror(errno);
+        return nullptr;
+    }
+    struct stat info{};
+    fstat(fd, &info);
+    size_t size = static_cast<size_t>(info.st_size);
+    // Los segmentos nuevos se crean con su tamaño final, los mensajes se escriben en el mapeo
+    if (create || size == 0) {
+        size = segmentSize;
+        if (ftruncate(fd, static_cast<off_t>(size)) < 0) {
+            error = "ftruncate " + name + ": " + strerror(errno);
+            close(fd);
+            return nullptr;
+        }
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        error = "mmap " + name + ": " + strerror(errno);
+        close(fd);
+        return nullptr;
+    }
+
+    auto segment = std::make_unique<Segment>();
+    segment->baseOffset = baseOffset;
+    segment->fd = fd;
+    segment->data = static_cast<char*>(data);
+    segment->size = size;
+    return segment;
+}
+
+void HistoryLog::recover(Segment& segment) {
+    // Se recorren los registros hasta el final o hasta uno incompleto (por ejemplo
+    // si el servidor se cayo a medio escribir), lo que siga se sobreescribe. Los offsets
+    // son crecientes pero pueden saltarse, un mensaje que no se pudo guardar igual gasta el suyo
+    size_t position = 0;
+    uint64_t expected = segment.baseOffset;
+    while (position + sizeof(RecordHeader) <= segment.size) {
+        RecordHeader header;
+        memcpy(&header, segment.data + position, sizeof(header));
+        if (header.length == 0 || header.offset < expected || position + recordSize(header.length) > segment.size ||
+            checksum(segment.data + position + sizeof(header), header.length) != header.checksum) {
+            break;
+        }
+        addToIndex(segment, header.offset, position);
+        position += recordSize(header.length);
+        expected = header.offset + 1;
+    }
+    segment.used = segment.synced = position;
+    nextOffset = expected;
+}
+
+void HistoryLog::addToIndex(Segment& segment, uint64_t offset, size_t position) {
+    if (segment.index.empty() || position - segment.index.back().position >= IndexInterval) {
+        segment.index.push_back({offset, position});
+    }
+}
+
+SharedFrame HistoryLog::append(const Entry& entry, const std::function<SharedFrame(uint64_t offset)>& encode) {
+    uint64_t offset;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        offset = nextOffset++;
+    }
+    // El frame se arma sin el lock, el offset ya fija su lugar en el log
+    SharedFrame frame = encode(offset);
+    if (!isOpen()) {
+        return frame;
+    }
+
+    // El hilo del log ordena los mensajes por offset, el worker solo encola el suyo y sigue.
+    // Un mensaje que no se pudo serializar tambien se encola para que el log salte su offset
+    bool wake;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        wake = queued.empty();
+        queued.push_back({offset, entry.kind, entry.sender, entry.recipient, frame});
+    }
+    // Con la cola ya ocupada el hilo del log fue despertado y la va a vaciar completa
+    if (wake) {
+        logWake.notify_one();
+    }
+    return frame;
+}
+
+void HistoryLog::writeLoop() {
+    // Mensajes que llegaron antes que uno de offset menor, se escriben cuando llega ese
+    std::map<uint64_t, PendingRecord> waiting;
+    std::vector<PendingRecord> batch;
+    // Solo este hilo escribe en los segmentos, lo que pasa de used no lo ve nadie mas
+    Segment* segment;
+    uint64_t nextWrite;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        segment = segments.back().get();
+        nextWrite = publishedOffset;
+    }
+    size_t position = segment->used;
+    auto nextSync = std::chrono::steady_clock::now() + syncInterval;
+
+    while (true) {
+        bool stop;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            logWake.wait_until(lock, nextSync, [this] { return stopping || !queued.empty(); });
+            batch.swap(queued);
+            stop = stopping;
+        }
+        for (PendingRecord& record : batch) {
+            waiting.emplace(record.offset, std::move(record));
+        }
+        batch.clear();
+
+        // Se copian sin el lock los registros que ya tienen escritos todos los anteriores
+        struct Written {
+            Segment* segment;
+            uint64_t offset;
+            size_t position;
+            size_t end;            // Fin del registro, hasta ahi queda used al publicarlo
+        };
+        std::vector<Written> written;
+        while (!waiting.empty() && waiting.begin()->first == nextWrite) {
+            PendingRecord record = std::move(waiting.begin()->second);
+            waiting.erase(waiting.begin());
+            nextWrite++;
+            if (!record.frame) {
+                continue;
+            }
+
+            uint32_t length = static_cast<uint32_t>(record.sender.size() + record.recipient.size() + record.frame->size());
+            size_t size = recordSize(length);
+            if (position + size > segment->size) {
+                // El segmento se llena, se sigue en uno nuevo que empieza en este offset
+                std::string error;
+                std::unique_ptr<Segment> next = size > segmentSize ? nullptr : openSegment(record.offset, true, error);
+                if (!next) {
+                    logError("Could not store message {} in the history: {}", record.offset, error);
+                    continue;
+                }
+                segment = next.get();
+                position = 0;
+                std::lock_guard<std::mutex> lock(mutex);
+                segments.push_back(std::move(next));
+            }
+
+            char* out = segment->data + position;
+            RecordHeader header{};
+            header.length = length;
+            header.offset = record.offset;
+            header.senderLength = static_cast<uint16_t>(record.sender.size());
+            header.recipientLength = static_cast<uint16_t>(record.recipient.size());
+            header.kind = static_cast<uint8_t>(record.kind);
+            char* content = out + sizeof(header);
+            memcpy(content, record.sender.data(), record.sender.size());
+            memcpy(content + record.sender.size(), record.recipient.data(), record.recipient.size());
+            memcpy(content + record.sender.size() + record.recipient.size(), record.frame->data(), record.frame->size());
+            header.checksum = checksum(content, length);
+            memcpy(out, &header, sizeof(header));
+            written.push_back({segment, record.offset, position, position + size});
+            position += size;
+        }
+
+        // Se publica todo lo copiado de una vez, las lecturas no pasan de used
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const Written& item : written) {
+                addToIndex(*item.segment, item.offset, item.position);
+                item.segment->used = item.end;
+            }
+            publishedOffset = nextWrite;
+        }
+
+        if (stop || std::chrono::steady_clock::now() >= nextSync) {
+            syncWritten();
+            nextSync = std::chrono::steady_clock::now() + syncInterval;
+        }
+        if (stop) {
+            return;
+        }
+    }
+}
+
+void HistoryLog::syncWritten() {
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    // Solo este hilo cambia used, synced y la lista de segmentos, se leen sin el lock
+    for (auto& segment : segments) {
+        if (segment->synced >= segment->used) {
+            continue;
+        }
+        size_t from = segment->synced & ~(pageSize - 1);
+        if (msync(segment->data + from, segment->used - from, MS_SYNC) < 0) {
+            logError("Error syncing the history: {}", strerror(errno));
+        }
+        segment->synced = segment->used;
+    }
+}
+
+HistoryLog::Location HistoryLog::locate(uint64_t offset) const {
+    // Ultimo segmento cuyo primer offset no es mayor al buscado
+    auto it = std::upper_bound(segments.begin(), segments.end(), offset,
+                               [](uint64_t value, const std::unique_ptr<Segment>& segment) { return value < segment->baseOffset; });
+    size_t index = it == segments.begin() ? 0 : static_cast<size_t>(it - segments.begin()) - 1;
+    // El indice disperso da la posicion del registro mas cercano antes del offset buscado
+    const Segment& segment = *segments[index];
+    auto entry = std::upper_bound(segment.index.begin(), segment.index.end(), offset,
+                                  [](uint64_t value, const IndexEntry& item) { return value < item.offset; });
+    return {index, entry == segment.index.begin() ? 0 : (entry - 1)->position};
+}
+
+HistoryLog::ReadResult HistoryLog::read(const std::string& username, const std::function<bool(std::string_view channel)>& inChannel,
+                                        const uint64_t* afterOffset, size_t limit, size_t maxBytes) const {
+    ReadResult result;
+    if (limit == 0) {
+        return result;
+    }
+
+    // Con el lock solo se toma lo publicado y desde donde empezar a recorrer. Los registros hasta
+    // used ya no cambian y los mapeos no se liberan mientras el log esta abierto, se leen sin el lock
+    std::vector<SegmentView> views;
+    std::vector<std::pair<uint64_t, Location>> starts;
+    uint64_t end;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (segments.empty()) {
+            return result;
+        }
+        views.reserve(segments.size());
+        for (const auto& segment : segments) {
+            views.push_back({segment->data, segment->used});
+        }
+        uint64_t first = segments.front()->baseOffset;
+        end = publishedOffset;
+        if (afterOffset != nullptr) {
+            uint64_t start = std::max(*afterOffset + 1, first);
+            starts.push_back({start, locate(start)});
+        } else {
+            // Para los ultimos mensajes se prueba con ventanas cada vez mas grandes hacia atras
+            // hasta juntar limit visibles, cada una recorre solo lo que la anterior no cubrio
+            for (uint64_t span = limit;; span *= 2) {
+                uint64_t start = end > first + span ? end - span : first;
+                starts.push_back({start, locate(start)});
+                if (start == first || span >= MaxScannedRecords) {
+                    break;
+                }
+            }
+        }
+    }
+
+    // Los mensajes directos solo se le devuelven a quien los envio o recibio,
+    // y los de un canal a quien esta suscrito
+    size_t scanned = 0;
+    auto scan = [&](uint64_t from, Location location, uint64_t to, const std::function<bool(const VisibleRecord&)>& visit) {
+        for (size_t index = location.segment; index < views.size(); index++) {
+            const SegmentView& view = views[index];
+            size_t position = index == location.segment ? location.position : 0;
+            while (position < view.used) {
+                RecordHeader header;
+                memcpy(&header, view.data + position, sizeof(header));
+                if (header.offset >= to || scanned >= MaxScannedRecords) {
+                    return;
+                }
+                const char* content = view.data + position + sizeof(header);
+                position += recordSize(header.length);
+                if (header.offset < from) {
+                    continue;
+                }
+                scanned++;
+                std::string_view sender(content, header.senderLength);
+                std::string_view recipient(content + header.senderLength, header.recipientLength);
+                Kind kind = static_cast<Kind>(header.kind);
+                bool visible = kind == Kind::Broadcast ||
+                               (kind == Kind::Direct && (sender == username || recipient == username)) ||
+                               (kind == Kind::Channel && inChannel(recipient));
+                VisibleRecord record{header.offset, nullptr, 0};
+                if (visible) {
+                    record.frame = content + header.senderLength + header.recipientLength;
+                    record.size = header.length - header.senderLength - header.recipientLength;
+                }
+                if (!visit(record)) {
+                    return;
+                }
+            }
+        }
+    };
+
+    if (afterOffset != nullptr) {
+        // Hacia adelante se cortan en limit mensajes visibles o en maxBytes, lastOffset queda en el ultimo revisado
+        result.lastOffset = starts.front().first - 1;
+        scan(starts.front().first, starts.front().second, end, [&](const VisibleRecord& record) {
+            if (record.frame != nullptr) {
+                if (result.frames.size() + record.size > maxBytes) {
+                    return false;
+                }
+                result.frames.append(record.frame, record.size);
+                result.count++;
+            }
+            result.lastOffset = record.offset;
+            return result.count < limit;
+        });
+        return result;
+    }
+
+    // Los visibles de cada ventana se agregan antes que los de la ventana mas nueva
+    std::vector<VisibleRecord> found;
+    uint64_t to = end;
+    for (const auto& [start, location] : starts) {
+        std::vector<VisibleRecord> window;
+        scan(start, location, to, [&window](const VisibleRecord& record) {
+            if (record.frame != nullptr) {
+                window.push_back(record);
+            }
+            return true;
+        });
+        found.insert(found.begin(), window.begin(), window.end());
+        to = start;
+        if (found.size() >= limit || scanned >= MaxScannedRecords) {
+            break;
+        }
+    }
+    // Se devuelven los mas nuevos que entran en limit y en maxBytes, del mas viejo al mas nuevo
+    size_t begin = found.size();
+    size_t bytes = 0;
+    while (begin > 0 && found.size() - begin < limit && bytes + found[begin - 1].size <= maxBytes) {
+        begin--;
+        bytes += found[begin].size;
+    }
+    result.frames.reserve(bytes);
+    for (size_t i = begin; i < found.size(); i++) {
+        result.frames.append(found[i].frame, found[i].size);
+    }
+    result.count = static_cast<uint32_t>(found.size() - begin);
+    result.lastOffset = end - 1;
+    return result;
+}
@@ -0,0 +1,149 @@
+// history_log.h
+#ifndef HISTORY_LOG_H
+#define HISTORY_LOG_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "protocol/message.h"
+
+/**
+ * Log de mensajes de solo agregar, dividido en segmentos mapeados en memoria.
+ * Cada mensaje recibe un offset consecutivo y se guarda con el frame ya
+ * serializado, asi leer el historial es copiar bytes de las paginas mapeadas
+ * sin volver a parsear nada. Un indice disperso por segmento permite llegar
+ * a un offset sin recorrer todo el segmento. Los workers solo encolan sus
+ * mensajes: un hilo del log los escribe en orden de offset, los publica y
+ * hace msync de lo escrito cada cierto tiempo en lugar de en cada mensaje.
+ */
+class HistoryLog {
+public:
+    // Tipo de un mensaje del log, define quien lo puede ver
+    enum class Kind : uint8_t {
+        Broadcast = 0, // Lo ven todos
+        Direct = 1,    // Solo lo ven su remitente y su destinatario
+        Channel = 2    // Lo ven los suscriptores del canal, guardado como destinatario
+    };
+
+    // Quien puede ver un mensaje del log
+    struct Entry {
+        Kind kind = Kind::Broadcast;
+        std::string sender;
+        std::string recipient;  // Usuario de un mensaje directo o canal de un mensaje de canal
+    };
+
+    // Resultado de una lectura del historial
+    struct ReadResult {
+        std::string frames;       // Frames de los mensajes encontrados, uno detras de otro
+        uint32_t count = 0;       // Cantidad de mensajes en frames
+        uint64_t lastOffset = 0;  // Ultimo offset revisado, para continuar desde ahi
+    };
+
+    HistoryLog() = default;
+    ~HistoryLog();
+
+    HistoryLog(const HistoryLog&) = delete;
+    HistoryLog& operator=(const HistoryLog&) = delete;
+
+    /**
+     * Abre el log en un directorio, recupera los segmentos existentes y
+     * arranca el hilo de sincronizacion. Sin abrir, el log solo asigna offsets.
+     *
+     * @param directory Directorio de los segmentos, se crea si no existe
+     * @param segmentSize Tamaño de cada segmento en bytes
+     * @param syncInterval Cada cuanto se sincronizan a disco los mensajes nuevos
+     * @param error Descripcion del error si no se pudo abrir
+     */
+    bool open(const std::string& directory, size_t segmentSize, std::chrono::milliseconds syncInterval, std::string& error);
+
+    /**
+     * Agrega un mensaje al log. El lock solo se toma para asignar el offset y
+     * para encolar el frame, nunca se espera a otro worker; el mensaje se puede
+     * leer cuando el hilo del log lo escribe
+     *
+     * @param entry Remitente y destinatario del mensaje
+     * @param encode Recibe el offset asignado y devuelve el frame del mensaje
+     * @return El frame que devolvio encode, nullptr si no se pudo serializar
+     */
+    SharedFrame append(const Entry& entry, const std::function<SharedFrame(uint64_t offset)>& encode);
+
+    /**
+     * Lee mensajes que puede ver un usuario
+     *
+     * @param username Usuario que pide el historial
+     * @param inChannel Dice si el usuario esta suscrito a un canal, se llama sin el lock del log
+     * @param afterOffset Se leen los mensajes despues de este offset, o los ultimos si es nullptr
+     * @param limit Cantidad maxima de mensajes visibles para el usuario a devolver
+     * @param maxBytes Tamaño maximo de los frames devueltos
+     */
+    ReadResult read(const std::string& username, const std::function<bool(std::string_view channel)>& inChannel,
+                    const uint64_t* afterOffset, size_t limit, size_t maxBytes) const;
+
+    bool isOpen() const { return logThread.joinable(); }
+
+private:
+    // Cada cuantos bytes de un segmento se agrega una entrada al indice disperso
+    static constexpr size_t IndexInterval = 4096;
+    // Registros que revisa como maximo una lectura, acota el costo de buscar los visibles para un usuario
+    static constexpr size_t MaxScannedRecords = 1 << 20;
+
+    struct IndexEntry {
+        uint64_t offset;
+        size_t position;
+    };
+
+    struct Segment {
+        uint64_t baseOffset = 0;   // Offset del primer mensaje del segmento
+        int fd = -1;
+        char* data = nullptr;      // Segmento mapeado en memoria
+        size_t size = 0;           // Tamaño del archivo y del mapeo
+        size_t used = 0;           // Bytes con mensajes publicados, los que ven las lecturas
+        size_t synced = 0;         // Bytes ya sincronizados a disco
+        std::vector<IndexEntry> index;
+    };
+
+    // Mensaje encolado por un worker que el hilo del log todavia no escribe
+    struct PendingRecord {
+        uint64_t offset;
+        Kind kind;
+        std::string sender;
+        std::string recipient;
+        SharedFrame frame;         // nullptr si no se pudo serializar, su offset se salta
+    };
+
+    // Segmento y posicion dentro de el desde donde empieza a recorrer una lectura
+    struct Location {
+        size_t segment;
+        size_t position;
+    };
+
+    std::unique_ptr<Segment> openSegment(uint64_t baseOffset, bool create, std::string& error);
+    void recover(Segment& segment);
+    void addToIndex(Segment& segment, uint64_t offset, size_t position);
+    Location locate(uint64_t offset) const;
+    void writeLoop();
+    void syncWritten();
+
+    std::string directory;
+    size_t segmentSize = 0;
+    std::chrono::milliseconds syncInterval{0};
+
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Segment>> segments; // Solo el hilo del log agrega segmentos
+    uint64_t nextOffset = 1;         // Siguiente offset a asignar
+    uint64_t publishedOffset = 1;    // Los offsets menores ya se pueden leer
+    std::vector<PendingRecord> queued; // Mensajes de los workers en el orden en que llegaron
+
+    std::thread logThread;
+    std::condition_variable logWake;
+    bool stopping = false;
+};
+
+#endif
@@ -0,0 +1,267 @@
+// logger.cpp
+#include "./logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+LogOptions logOptions;
+
+// Registros que caben en el ring de cada hilo, potencia de 2
+constexpr size_t RingRecords = 1024;
+// Cada cuanto revisa los rings el hilo del log cuando no encontro nada
+constexpr std::chrono::milliseconds IdleInterval{20};
+
+/**
+ * Ring de un solo productor (el hilo que lo creo) y un solo consumidor (el
+ * hilo del log). El productor nunca espera: con el ring lleno el registro se
+ * descarta y se cuenta.
+ */
+struct LogRing {
+    // Veces que se escribio un mismo mensaje en la ventana actual, solo lo usa el productor
+    struct RateWindow {
+        int64_t start = 0;
+        size_t count = 0;
+        uint64_t suppressed = 0;
+    };
+
+    LogRecord records[RingRecords];
+    alignas(64) std::atomic<uint64_t> tail{0}; // Siguiente posicion que escribe el productor
+    std::atomic<uint64_t> dropped{0};
+    std::unordered_map<const char*, RateWindow> windows;
+    alignas(64) std::atomic<uint64_t> head{0}; // Siguiente posicion que lee el consumidor
+    uint64_t reportedDrops = 0;
+};
+
+static std::mutex ringsMutex; // Protege la lista de rings, solo se toma al crear uno o al revisarlos
+static std::vector<std::unique_ptr<LogRing>> rings;
+static thread_local LogRing* localRing = nullptr;
+
+static std::thread writerThread;
+static std::mutex writerMutex;
+static std::condition_variable writerWake;
+static bool writerRunning = false;
+
+void LogRecord::add(std::string_view value) {
+    Arg& arg = args[argCount++];
+    size_t length = std::min(value.size(), TextCapacity - textLength);
+    arg.type = ArgType::Text;
+    arg.truncated = length < value.size();
+    arg.offset = textLength;
+    arg.length = static_cast<uint16_t>(length);
+    value.copy(text + textLength, length);
+    textLength += static_cast<uint16_t>(length);
+}
+
+void LogRecord::add(LogContent value) {
+    if (logOptions.content) {
+        add(value.text);
+        return;
+    }
+    Arg& arg = args[argCount++];
+    arg.type = ArgType::ContentSize;
+    arg.value = value.text.size();
+}
+
+/**
+ * Ring del hilo actual, se crea la primera vez que el hilo escribe al log
+ */
+static LogRing& threadRing() {
+    if (localRing == nullptr) {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        rings.push_back(std::make_unique<LogRing>());
+        localRing = rings.back().get();
+    }
+    return *localRing;
+}
+
+LogRecord* beginLogRecord(LogLevel level, const char* format) {
+    LogRing& ring = threadRing();
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::system_clock::now().time_since_epoch())
+                      .count();
+
+    // Los warnings y errores que se repiten se limitan por segundo, los descartados se cuentan en el siguiente
+    uint64_t suppressed = 0;
+    if (level >= LogLevel::Warn && logOptions.rateLimit > 0) {
+        LogRing::RateWindow& window = ring.windows[format];
+        if (now - window.start >= 1000000000) {
+            window.start = now;
+            window.count = 0;
+        }
+        if (window.count >= logOptions.rateLimit) {
+            window.suppressed++;
+            return nullptr;
+        }
+        window.count++;
+        suppressed = window.suppressed;
+        window.suppressed = 0;
+    }
+
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (tail - ring.head.load(std::memory_order_acquire) == RingRecords) {
+        ring.dropped.store(ring.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    LogRecord& record = ring.records[tail % RingRecords];
+    record.time = now;
+    record.format = format;
+    record.suppressed = suppressed;
+    record.level = level;
+    record.argCount = 0;
+    record.textLength = 0;
+    return &record;
+}
+
+void commitLogRecord() {
+    localRing->tail.store(localRing->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/**
+ * Da formato a un registro y lo agrega al final de out
+ */
+static void formatRecord(const LogRecord& record, std::string& out) {
+    static constexpr const char* LevelNames[] = {"DEBUG", "INFO ", "WARN ", "ERROR"};
+
+    time_t seconds = static_cast<time_t>(record.time / 1000000000);
+    tm local{};
+    localtime_r(&seconds, &local);
+    char prefix[48];
+    size_t used = strftime(prefix, sizeof(prefix), "%Y-%m-%d %H:%M:%S", &local);
+    snprintf(prefix + used, sizeof(prefix) - used, ".%03d %s ",
+             static_cast<int>(record.time / 1000000 % 1000), LevelNames[static_cast<size_t>(record.level)]);
+    out += prefix;
+
+    // Cada {} del formato se reemplaza por el siguiente argumento
+    size_t next = 0;
+    for (const char* c = record.format; *c != '\0'; c++) {
+        if (c[0] != '{' || c[1] != '}' || next >= record.argCount) {
+            out += *c;
+            continue;
+        }
+        const LogRecord::Arg& arg = record.args[next++];
+        switch (arg.type) {
+        case LogRecord::ArgType::Signed:
+            out += std::to_string(static_cast<int64_t>(arg.value));
+            break;
+        case LogRecord::ArgType::Unsigned:
+            out += std::to_string(arg.value);
+            break;
+        case LogRecord::ArgType::Text:
+            out.append(record.text + arg.offset, arg.length);
+            if (arg.truncated) {
+                out += "...";
+            }
+            break;
+        case LogRecord::ArgType::ContentSize:
+            out += "<" + std::to_string(arg.value) + " bytes>";
+            break;
+        }
+        c++;
+    }
+    if (record.suppressed > 0) {
+        out += " (" + std::to_string(record.suppressed) + " similar messages suppressed)";
+    }
+    out += '\n';
+}
+
+/**
+ * Vacia los rings de todos los hilos. Los warnings y errores van a stderr y el
+ * resto a stdout, cada uno con una sola escritura.
+ *
+ * @return Cantidad de registros escritos
+ */
+static size_t drainRings() {
+    std::vector<LogRing*> current;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        for (const auto& ring : rings) {
+            current.push_back(ring.get());
+        }
+    }
+
+    // Se toman los registros publicados de cada ring y se ordenan por hora entre todos los hilos
+    std::vector<const LogRecord*> pending;
+    std::vector<uint64_t> tails(current.size());
+    for (size_t i = 0; i < current.size(); i++) {
+        LogRing* ring = current[i];
+        tails[i] = ring->tail.load(std::memory_order_acquire);
+        for (uint64_t head = ring->head.load(std::memory_order_relaxed); head != tails[i]; head++) {
+            pending.push_back(&ring->records[head % RingRecords]);
+        }
+    }
+    std::stable_sort(pending.begin(), pending.end(),
+                     [](const LogRecord* a, const LogRecord* b) { return a->time < b->time; });
+
+    std::string out;
+    std::string err;
+    for (const LogRecord* record : pending) {
+        formatRecord(*record, record->level >= LogLevel::Warn ? err : out);
+    }
+    // Los slots se liberan hasta despues de darles formato
+    for (size_t i = 0; i < current.size(); i++) {
+        LogRing* ring = current[i];
+        ring->head.store(tails[i], std::memory_order_release);
+        uint64_t dropped = ring->dropped.load(std::memory_order_relaxed);
+        if (dropped != ring->reportedDrops) {
+            err += "Log ring full, dropped " + std::to_string(dropped - ring->reportedDrops) + " records\n";
+            ring->reportedDrops = dropped;
+        }
+    }
+    if (!out.empty()) {
+        fwrite(out.data(), 1, out.size(), stdout);
+        fflush(stdout);
+    }
+    if (!err.empty()) {
+        fwrite(err.data(), 1, err.size(), stderr);
+        fflush(stderr);
+    }
+    return pending.size();
+}
+
+void startLogging(const LogOptions& options) {
+    logOptions = options;
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        if (writerRunning) {
+            return;
+        }
+        writerRunning = true;
+    }
+    writerThread = std::thread([] {
+        std::unique_lock<std::mutex> lock(writerMutex);
+        while (writerRunning) {
+            lock.unlock();
+            size_t written = drainRings();
+            lock.lock();
+            // Los productores no despiertan al hilo del log, solo se espera si no habia nada
+            if (written == 0) {
+                writerWake.wait_for(lock, IdleInterval, [] { return !writerRunning; });
+            }
+        }
+    });
+    std::atexit(stopLogging);
+}
+
+void stopLogging() {
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        if (!writerRunning) {
+            return;
+        }
+        writerRunning = false;
+    }
+    writerWake.notify_one();
+    writerThread.join();
+    drainRings();
+}
@@ -0,0 +1,148 @@
+// logger.h
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Importancia de un mensaje del log, los menores al nivel configurado se descartan
+enum class LogLevel : uint8_t {
+    Debug,
+    Info,
+    Warn,
+    Error
+};
+
+// Opciones del log, se llenan desde la linea de comandos
+struct LogOptions {
+    LogLevel level = LogLevel::Info;
+    size_t rateLimit = 10; // Veces por segundo que cada hilo escribe un mismo warning o error, 0 sin limite
+    bool content = false;  // Si se escribe el contenido de los mensajes de los usuarios o solo su tamaño
+};
+
+// Contenido de un mensaje de un usuario, solo se escribe con LogOptions::content
+struct LogContent {
+    std::string_view text;
+};
+
+/**
+ * Registro binario del log. Se copia tal cual al ring del hilo que lo genera
+ * y el hilo del log le da formato despues: el formato es un literal con {}
+ * donde van los argumentos, que se guardan como enteros o texto.
+ */
+struct LogRecord {
+    static constexpr size_t MaxArgs = 6;
+    static constexpr size_t TextCapacity = 384;
+
+    enum class ArgType : uint8_t {
+        Signed,
+        Unsigned,
+        Text,
+        ContentSize // Contenido omitido, value tiene su tamaño
+    };
+
+    struct Arg {
+        ArgType type;
+        bool truncated; // El texto no cabia completo
+        uint16_t offset; // Inicio del texto en LogRecord::text
+        uint16_t length;
+        uint64_t value;
+    };
+
+    int64_t time = 0;          // Nanosegundos desde epoch
+    const char* format = nullptr;
+    uint64_t suppressed = 0;   // Mensajes iguales que el limite descarto antes de este
+    LogLevel level = LogLevel::Info;
+    uint8_t argCount = 0;
+    uint16_t textLength = 0;
+    Arg args[MaxArgs];
+    char text[TextCapacity];
+
+    void add(std::integral auto value) {
+        Arg& arg = args[argCount++];
+        if constexpr (std::signed_integral<decltype(value)>) {
+            arg.type = ArgType::Signed;
+            arg.value = static_cast<uint64_t>(static_cast<int64_t>(value));
+        } else {
+            arg.type = ArgType::Unsigned;
+            arg.value = static_cast<uint64_t>(value);
+        }
+    }
+
+    void add(std::string_view value);
+    void add(LogContent value);
+};
+
+extern LogOptions logOptions; // Opciones activas, se fijan con startLogging antes de arrancar los workers
+
+/**
+ * Arranca el hilo que da formato y escribe los registros. Lo pendiente se
+ * escribe al salir del programa.
+ */
+void startLogging(const LogOptions& options);
+
+/**
+ * Detiene el hilo del log despues de escribir todo lo pendiente
+ */
+void stopLogging();
+
+inline bool logEnabled(LogLevel level) {
+    return level >= logOptions.level;
+}
+
+/**
+ * Reserva un registro en el ring del hilo actual
+ *
+ * @return nullptr si el ring esta lleno o el limite de repeticiones descarto el mensaje
+ */
+LogRecord* beginLogRecord(LogLevel level, const char* format);
+
+/**
+ * Publica el registro reservado para el hilo del log
+ */
+void commitLogRecord();
+
+/**
+ * Agrega un mensaje al log sin bloquear ni darle formato en el hilo actual
+ *
+ * @param level Nivel del mensaje
+ * @param format Literal con {} en el lugar de cada argumento
+ * @param args Enteros, texto o LogContent
+ */
+template <typename... Args>
+void logMessage(LogLevel level, const char* format, const Args&... args) {
+    static_assert(sizeof...(Args) <= LogRecord::MaxArgs, "Too many log arguments");
+    if (!logEnabled(level)) {
+        return;
+    }
+    LogRecord* record = beginLogRecord(level, format);
+    if (record == nullptr) {
+        return;
+    }
+    (record->add(args), ...);
+    commitLogRecord();
+}
+
+template <typename... Args>
+void logDebug(const char* format, const Args&... args) {
+    logMessage(LogLevel::Debug, format, args...);
+}
+
+template <typename... Args>
+void logInfo(const char* format, const Args&... args) {
+    logMessage(LogLevel::Info, format, args...);
+}
+
+template <typename... Args>
+void logWarn(const char* format, const Args&... args) {
+    logMessage(LogLevel::Warn, format, args...);
+}
+
+template <typename... Args>
+void logError(const char* format, const Args&... args) {
+    logMessage(LogLevel::Error, format, args...);
+}
+
+#endif
@@ -0,0 +1,89 @@
+// mailbox.h
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+#include <atomic>
+#include <utility>
+
+/**
+ * Cola lock-free de multiples productores y un solo consumidor (algoritmo de
+ * Vyukov). Cualquier hilo puede hacer push sin bloquear; solo el hilo dueño
+ * del mailbox hace pop. Un pop puede no ver un push que esta a medio terminar,
+ * por eso quien hace push debe despertar al consumidor despues.
+ */
+template <typename T>
+class Mailbox {
+public:
+    Mailbox() : head(&stub), tail(&stub) {}
+
+    ~Mailbox() {
+        T discarded;
+        while (pop(discarded)) {
+        }
+    }
+
+    Mailbox(const Mailbox&) = delete;
+    Mailbox& operator=(const Mailbox&) = delete;
+
+    /**
+     * Agrega un elemento, se puede llamar desde cualquier hilo
+     */
+    void push(T value) {
+        Node* node = new Node{std::move(value), nullptr};
+        Node* previous = head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * Saca el elemento mas antiguo, solo desde el hilo consumidor
+     *
+     * @param value Donde se guarda el elemento
+     * @return false si no hay elementos (o el siguiente aun se esta agregando)
+     */
+    bool pop(T& value) {
+        Node* first = tail;
+        Node* next = first->next.load(std::memory_order_acquire);
+        if (first == &stub) {
+            if (next == nullptr) {
+                return false;
+            }
+            // Saltamos el nodo vacio
+            tail = next;
+            first = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next != nullptr) {
+            tail = next;
+            value = std::move(first->value);
+            delete first;
+            return true;
+        }
+        // first es el ultimo nodo, se vuelve a poner el stub detras para poder sacarlo
+        if (first != head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        stub.next.store(nullptr, std::memory_order_relaxed);
+        Node* previous = head.exchange(&stub, std::memory_order_acq_rel);
+        previous->next.store(&stub, std::memory_order_release);
+        next = first->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        tail = next;
+        value = std::move(first->value);
+        delete first;
+        return true;
+    }
+
+private:
+    struct Node {
+        T value;
+        std::atomic<Node*> next;
+    };
+
+    Node stub{};
+    alignas(64) std::atomic<Node*> head; // Donde agregan los productores
+    alignas(64) Node* tail;              // Donde saca el consumidor
+};
+
+#endif
@@ -0,0 +1,207 @@
+// metrics.cpp
+#include "./metrics.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "server/logger.h"
+
+thread_local WorkerMetrics* WorkerMetrics::current = nullptr;
+
+uint64_t HistogramData::upperBound(size_t bucket) {
+    if (bucket < SubBuckets) {
+        return bucket;
+    }
+    int exponent = static_cast<int>(bucket / SubBuckets) + SubBits - 1;
+    uint64_t sub = bucket % SubBuckets;
+    uint64_t base = (uint64_t(1) << exponent) | (sub << (exponent - SubBits));
+    return base + (uint64_t(1) << (exponent - SubBits)) - 1;
+}
+
+uint64_t HistogramData::percentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(count));
+    if (rank >= count) {
+        rank = count - 1;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < Buckets; i++) {
+        seen += buckets[i];
+        if (seen > rank) {
+            uint64_t upper = upperBound(i);
+            return upper < max ? upper : max;
+        }
+    }
+    return max;
+}
+
+void MetricsHistogram::record(uint64_t value) {
+    std::atomic<uint64_t>& bucket = buckets[HistogramData::bucketFor(value)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    count.add();
+    sum.add(value);
+    if (value > max.load(std::memory_order_relaxed)) {
+        max.store(value, std::memory_order_relaxed);
+    }
+}
+
+void MetricsHistogram::addTo(HistogramData& data) const {
+    // Se lee sin detener al worker, los totales pueden ir un par de valores adelantados a los buckets
+    for (size_t i = 0; i < HistogramData::Buckets; i++) {
+        data.buckets[i] += buckets[i].load(std::memory_order_relaxed);
+    }
+    data.count += count.load();
+    data.sum += sum.load();
+    data.max = std::max(data.max, max.load(std::memory_order_relaxed));
+}
+
+void Metrics::init(size_t workers) {
+    workerMetrics.clear();
+    for (size_t i = 0; i < workers; i++) {
+        workerMetrics.push_back(std::make_unique<WorkerMetrics>());
+    }
+}
+
+MetricsReport Metrics::collect(const std::function<std::string(size_t operation)>& operationName) const {
+    MetricsReport report;
+    for (size_t operation = 0; operation < WorkerMetrics::Operations; operation++) {
+        std::string name = operationName(operation);
+        if (name.empty()) {
+            continue;
+        }
+        uint64_t total = 0;
+        for (const auto& metrics : workerMetrics) {
+            total += metrics->requests[operation].load();
+        }
+        report.counters.emplace_back("chat_requests_total{operation=\"" + name + "\"}", total);
+    }
+
+    uint64_t bytesIn = 0;
+    uint64_t bytesOut = 0;
+    for (const auto& metrics : workerMetrics) {
+        bytesIn += metrics->bytesIn.load();
+        bytesOut += metrics->bytesOut.load();
+    }
+    report.counters.emplace_back("chat_received_bytes_total", bytesIn);
+    report.counters.emplace_back("chat_sent_bytes_total", bytesOut);
+
+    const std::pair<const char*, MetricsHistogram WorkerMetrics::*> histograms[] = {
+        {"chat_request_duration_nanoseconds", &WorkerMetrics::requestTime},
+        {"chat_fanout_recipients", &WorkerMetrics::fanout},
+        {"chat_outbound_queue_bytes", &WorkerMetrics::queueDepth},
+        {"chat_registry_lock_hold_nanoseconds", &WorkerMetrics::registryLock},
+    };
+    for (const auto& [name, member] : histograms) {
+        report.histograms.emplace_back(name, HistogramData{});
+        for (const auto& metrics : workerMetrics) {
+            ((*metrics).*member).addTo(report.histograms.back().second);
+        }
+    }
+    return report;
+}
+
+std::string MetricsReport::prometheus() const {
+    std::ostringstream out;
+    // Las series con labels comparten la linea TYPE de su nombre base
+    std::string lastBase;
+    auto writeSeries = [&out, &lastBase](const std::string& name, uint64_t value, const char* type) {
+        std::string base = name.substr(0, name.find('{'));
+        if (base != lastBase) {
+            out << "# TYPE " << base << " " << type << "\n";
+            lastBase = base;
+        }
+        out << name << " " << value << "\n";
+    };
+    for (const auto& [name, value] : counters) {
+        writeSeries(name, value, "counter");
+    }
+    for (const auto& [name, value] : gauges) {
+        writeSeries(name, value, "gauge");
+    }
+
+    for (const auto& [name, data] : histograms) {
+        out << "# TYPE " << name << " histogram\n";
+        // Un bucket por potencia de 2, desde el primero con valores hasta el que llega al total
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < HistogramData::Buckets && cumulative < data.count; i++) {
+            cumulative += data.buckets[i];
+            bool groupEnd = (i + 1) % HistogramData::SubBuckets == 0;
+            if (cumulative > 0 && (groupEnd || cumulative >= data.count)) {
+                size_t last = i | (HistogramData::SubBuckets - 1);
+                out << name << "_bucket{le=\"" << HistogramData::upperBound(last) << "\"} " << cumulative << "\n";
+            }
+        }
+        out << name << "_bucket{le=\"+Inf\"} " << data.count << "\n"
+            << name << "_sum " << data.sum << "\n"
+            << name << "_count " << data.count << "\n";
+    }
+    return out.str();
+}
+
+/**
+ * Atiende los pedidos del listener de metricas, uno a la vez
+ */
+static void serveMetrics(int listener, const std::function<std::string()>& render) {
+    while (true) {
+        int client = accept(listener, nullptr, nullptr);
+        if (client < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            logError("Error accepting metrics client: {}", strerror(errno));
+            return;
+        }
+        // Un cliente que no envia su pedido o no lee la respuesta no bloquea el listener
+        timeval timeout{1, 0};
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        // Cualquier pedido recibe las metricas, solo se consume la primera lectura
+        char request[1024];
+        if (recv(client, request, sizeof(request), 0) > 0) {
+            std::string body = render();
+            std::string response = "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: " +
+                                   std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+            size_t sent = 0;
+            while (sent < response.size()) {
+                ssize_t bytes = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if (bytes <= 0) {
+                    break;
+                }
+                sent += static_cast<size_t>(bytes);
+            }
+        }
+        close(client);
+    }
+}
+
+bool startMetricsServer(uint16_t port, std::function<std::string()> render, std::string& error) {
+    int listener = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listener < 0) {
+        error = strerror(errno);
+        return false;
+    }
+    int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    // Solo se escucha en localhost, las metricas no se exponen hacia afuera
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(listener, 16) < 0) {
+        error = strerror(errno);
+        close(listener);
+        return false;
+    }
+    std::thread([listener, render = std::move(render)] { serveMetrics(listener, render); }).detach();
+    return true;
+}
@@ -0,0 +1,179 @@
+// metrics.h
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Contador de un solo hilo. Solo su hilo lo incrementa, sin instrucciones con
+ * lock; cualquier hilo lo puede leer para exportarlo.
+ */
+class MetricsCounter {
+public:
+    void add(uint64_t amount = 1) { value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed); }
+    uint64_t load() const { return value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value{0};
+};
+
+/**
+ * Valores de un histograma ya leidos, se pueden sumar y calcular percentiles.
+ * Usa los mismos buckets que el histograma del benchmark: cada potencia de 2
+ * se divide en 16 sub-buckets, con error relativo menor al 6.25%.
+ */
+struct HistogramData {
+    static constexpr int SubBits = 4;
+    static constexpr size_t SubBuckets = size_t(1) << SubBits;
+    static constexpr size_t Buckets = 64 * SubBuckets;
+
+    std::array<uint64_t, Buckets> buckets{};
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+
+    // Los valores menores a 16 tienen un bucket cada uno, los demas se agrupan por potencia de 2
+    static size_t bucketFor(uint64_t value) {
+        if (value < SubBuckets) {
+            return static_cast<size_t>(value);
+        }
+        int exponent = std::bit_width(value) - 1;
+        uint64_t sub = (value >> (exponent - SubBits)) & (SubBuckets - 1);
+        return static_cast<size_t>(exponent - SubBits + 1) * SubBuckets + static_cast<size_t>(sub);
+    }
+
+    // Mayor valor que cae en un bucket
+    static uint64_t upperBound(size_t bucket);
+
+    /**
+     * Calcula un percentil
+     *
+     * @param percentile Percentil entre 0 y 100
+     * @return Limite superior del bucket del percentil
+     */
+    uint64_t percentile(double percentile) const;
+};
+
+/**
+ * Histograma de un solo hilo con memoria fija. Registrar un valor es O(1) y no
+ * bloquea; igual que MetricsCounter solo su hilo escribe y se lee desde otros.
+ */
+class MetricsHistogram {
+public:
+    void record(uint64_t value);
+
+    // Suma los valores del histograma a data
+    void addTo(HistogramData& data) const;
+
+private:
+    std::array<std::atomic<uint64_t>, HistogramData::Buckets> buckets{};
+    MetricsCounter count;
+    MetricsCounter sum;
+    std::atomic<uint64_t> max{0};
+};
+
+/**
+ * Metricas de un worker. Cada worker escribe solo en las suyas, asi medir no
+ * comparte lineas de cache entre hilos; al exportarlas se suman todas.
+ */
+struct WorkerMetrics {
+    static constexpr size_t Operations = 16;
+
+    std::array<MetricsCounter, Operations> requests; // Requests atendidos por operacion
+    MetricsCounter bytesIn;                          // Bytes leidos de los clientes
+    MetricsCounter bytesOut;                         // Bytes enviados a los clientes
+    MetricsHistogram requestTime;    // Nanosegundos desde que se lee un frame del socket hasta que se encola lo ultimo que genera en el worker
+    MetricsHistogram fanout;         // Destinatarios de cada entrega de un broadcast, canal o presencia en el worker
+    MetricsHistogram queueDepth;     // Bytes en la cola de salida de una conexion despues de encolarle frames
+    MetricsHistogram registryLock;   // Nanosegundos que se tiene bloqueado un shard del registro de sesiones
+
+    // Asocia las metricas al hilo actual
+    static void bind(WorkerMetrics* metrics) { current = metrics; }
+
+    // Metricas del hilo actual, nullptr fuera de los workers
+    static WorkerMetrics* local() { return current; }
+
+private:
+    static thread_local WorkerMetrics* current;
+};
+
+// Metricas de todos los workers sumadas, listas para exportar
+struct MetricsReport {
+    std::vector<std::pair<std::string, uint64_t>> counters;      // Nombre estilo Prometheus, con sus labels
+    std::vector<std::pair<std::string, uint64_t>> gauges;        // Valores que suben y bajan, como los usuarios conectados
+    std::vector<std::pair<std::string, HistogramData>> histograms;
+
+    /**
+     * Texto en el formato de exposicion de Prometheus
+     */
+    std::string prometheus() const;
+};
+
+/**
+ * Metricas del servidor, una por worker
+ */
+class Metrics {
+public:
+    /**
+     * Crea las metricas de los workers, antes de arrancar sus hilos
+     */
+    void init(size_t workers);
+
+    WorkerMetrics& worker(size_t index) { return *workerMetrics[index]; }
+
+    /**
+     * Suma las metricas de todos los workers. Se puede llamar desde cualquier hilo.
+     *
+     * @param operationName Nombre de cada operacion para el label de los requests
+     */
+    MetricsReport collect(const std::function<std::string(size_t operation)>& operationName) const;
+
+private:
+    std::vector<std::unique_ptr<WorkerMetrics>> workerMetrics;
+};
+
+/**
+ * Mide cuanto dura un bloque y lo registra al salir de el
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(MetricsHistogram* histogram)
+        : histogram(histogram), start(histogram ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()) {}
+
+    // Mide desde un momento anterior, por ejemplo desde que se leyo el request
+    ScopedTimer(MetricsHistogram* histogram, std::chrono::steady_clock::time_point start) : histogram(histogram), start(start) {}
+
+    ~ScopedTimer() {
+        if (histogram) {
+            histogram->record(static_cast<uint64_t>((std::chrono::steady_clock::now() - start).count()));
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    MetricsHistogram* histogram;
+    std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * Atiende pedidos HTTP en 127.0.0.1 con las metricas en formato Prometheus,
+ * desde un hilo propio para que un cliente lento no detenga a los workers
+ *
+ * @param port Puerto donde escuchar
+ * @param render Arma el texto de las metricas en cada pedido
+ * @param error Descripcion del error si no se pudo escuchar
+ */
+bool startMetricsServer(uint16_t port, std::function<std::string()> render, std::string& error);
+
+#endif
@@ -0,0 +1,107 @@
+// presence_feed.cpp
+#include "./presence_feed.h"
+
+#include <algorithm>
+#include <string_view>
+
+void PresenceFeed::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    slots.assign(std::max<size_t>(capacity, 1), Event{});
+    head = 0;
+    count = 0;
+}
+
+uint64_t PresenceFeed::record(chat::PresenceChange change, const std::string& username, chat::UserStatus status) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Event event{++currentVersion, change, status, username};
+
+    // El estado de cada usuario se guarda como su entrada, con la version de su ultimo cambio
+    if (change == chat::PresenceChange::USER_LEFT) {
+        users.erase(username);
+    } else if (change == chat::PresenceChange::USER_JOINED || users.count(username) > 0) {
+        Event& state = users[username];
+        state = event;
+        state.change = chat::PresenceChange::USER_JOINED;
+    }
+
+    // Con el ring lleno se descarta el cambio mas viejo
+    if (count == slots.size()) {
+        head = (head + 1) % slots.size();
+        count--;
+    }
+    slots[(head + count) % slots.size()] = std::move(event);
+    count++;
+    return currentVersion;
+}
+
+uint64_t PresenceFeed::version() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return currentVersion;
+}
+
+bool PresenceFeed::since(uint64_t afterVersion, std::vector<Event>& events, uint64_t& version) const {
+    events.clear();
+    std::lock_guard<std::mutex> lock(mutex);
+    version = currentVersion;
+    // El ring tiene las versiones consecutivas de oldest + 1 a currentVersion
+    uint64_t oldest = currentVersion - count;
+    if (afterVersion < oldest || afterVersion > currentVersion) {
+        return false;
+    }
+
+    // Se recorre del mas nuevo al mas viejo, lo primero que se ve de cada usuario es su ultimo
+    // cambio y lo ultimo es su primer cambio dentro del rango
+    struct Coalesced {
+        size_t position;
+        chat::PresenceChange first;
+    };
+    std::unordered_map<std::string_view, Coalesced> seen;
+    size_t begin = static_cast<size_t>(afterVersion - oldest);
+    for (size_t i = count; i > begin; i--) {
+        const Event& event = at(i - 1);
+        auto [it, inserted] = seen.try_emplace(event.username, Coalesced{events.size(), event.change});
+        if (inserted) {
+            events.push_back(event);
+        } else {
+            it->second.first = event.change;
+        }
+    }
+
+    // Si el usuario entro dentro del rango el suscriptor no lo conoce: si ya salio no hace falta
+    // mandarlo y si solo cambio de estado se manda como entrada
+    bool removed = false;
+    for (const auto& [username, item] : seen) {
+        Event& event = events[item.position];
+        if (item.first != chat::PresenceChange::USER_JOINED) {
+            continue;
+        }
+        if (event.change == chat::PresenceChange::USER_LEFT) {
+            event.version = 0;
+            removed = true;
+        } else {
+            event.change = chat::PresenceChange::USER_JOINED;
+        }
+    }
+    if (removed) {
+        events.erase(std::remove_if(events.begin(), events.end(), [](const Event& event) { return event.version == 0; }),
+                     events.end());
+    }
+    std::reverse(events.begin(), events.end());
+    return true;
+}
+
+uint64_t PresenceFeed::snapshot(std::vector<Event>& events) const {
+    events.clear();
+    uint64_t version = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        events.reserve(users.size());
+        for (const auto& [username, state] : users) {
+            events.push_back(state);
+        }
+        version = currentVersion;
+    }
+    // Se ordena fuera del lock, los demas workers no esperan por el snapshot
+    std::sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.version < b.version; });
+    return version;
+}
@@ -0,0 +1,82 @@
+// presence_feed.h
+#ifndef PRESENCE_FEED_H
+#define PRESENCE_FEED_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "protocol/chat.pb.h"
+
+/**
+ * Cambios de presencia de los usuarios (entro, salio, cambio de estado). Cada
+ * cambio recibe una version global que siempre aumenta. Los ultimos cambios se
+ * guardan en un ring de tamaño fijo para mandarle a los suscriptores solo lo
+ * que les falta; ademas se mantiene el ultimo estado de cada usuario para
+ * armar un snapshot completo cuando alguien se atrasa mas que el ring.
+ */
+class PresenceFeed {
+public:
+    // Un cambio de presencia
+    struct Event {
+        uint64_t version = 0;
+        chat::PresenceChange change = chat::PresenceChange::USER_JOINED;
+        chat::UserStatus status = chat::UserStatus::ONLINE;
+        std::string username;
+    };
+
+    /**
+     * Define cuantos cambios se guardan, se debe llamar antes de usarlo
+     *
+     * @param capacity Cantidad maxima de cambios en el ring
+     */
+    void setCapacity(size_t capacity);
+
+    /**
+     * Registra un cambio de presencia. Los cambios de un mismo usuario se deben
+     * registrar en orden: la entrada despues de agregar la sesion y la salida
+     * antes de quitarla, asi un nombre reutilizado no se desordena.
+     *
+     * @return Version del cambio
+     */
+    uint64_t record(chat::PresenceChange change, const std::string& username, chat::UserStatus status);
+
+    // Version del ultimo cambio registrado
+    uint64_t version() const;
+
+    /**
+     * Cambios posteriores a una version, coalescidos: el ultimo cambio de cada
+     * usuario, ordenados por version. Un usuario que entro y salio dentro del
+     * rango no aparece, y uno que entro y luego cambio de estado aparece como
+     * entrada con su ultimo estado.
+     *
+     * @param afterVersion Version que ya tiene el suscriptor
+     * @param events Donde se escriben los cambios
+     * @param version Donde se escribe la version hasta la que llegan los cambios
+     * @return false si el ring ya descarto cambios posteriores a afterVersion
+     */
+    bool since(uint64_t afterVersion, std::vector<Event>& events, uint64_t& version) const;
+
+    /**
+     * Estado completo: una entrada por cada usuario conectado con su estado y
+     * la version de su ultimo cambio, ordenadas por version
+     *
+     * @param events Donde se escriben las entradas
+     * @return Version del snapshot
+     */
+    uint64_t snapshot(std::vector<Event>& events) const;
+
+private:
+    // Cambio en la posicion logica i, 0 es el mas viejo
+    const Event& at(size_t i) const { return slots[(head + i) % slots.size()]; }
+
+    mutable std::mutex mutex;
+    std::vector<Event> slots;
+    size_t head = 0;
+    size_t count = 0;
+    uint64_t currentVersion = 0;
+    std::unordered_map<std::string, Event> users; // Ultimo cambio de cada usuario conectado
+};
+
+#endif
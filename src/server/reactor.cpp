@@ -0,0 +1,122 @@
+// reactor.cpp
+#include "./reactor.h"
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+#include "server/logger.h"
+
+// Cantidad maxima de eventos que se procesan por cada llamada a epoll_wait
+constexpr int MaxEvents = 256;
+
+Reactor::Reactor() : timerWheel(std::make_unique<TimerWheel>(std::chrono::milliseconds(100))) {
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+        logError("Error creating epoll: {}", strerror(errno));
+    }
+}
+
+Reactor::~Reactor() {
+    if (epollFd >= 0) {
+        close(epollFd);
+    }
+}
+
+bool Reactor::add(int fd, uint32_t events, Handler handler) {
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        logError("Error adding fd {} to epoll: {}", fd, strerror(errno));
+        return false;
+    }
+    handlers[fd] = std::move(handler);
+    return true;
+}
+
+bool Reactor::modify(int fd, uint32_t events) {
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &event) < 0) {
+        logError("Error modifying fd {} in epoll: {}", fd, strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+void Reactor::remove(int fd) {
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    handlers.erase(fd);
+}
+
+void Reactor::setTimerResolution(std::chrono::milliseconds resolution) {
+    if (timerWheel->empty()) {
+        timerWheel = std::make_unique<TimerWheel>(resolution);
+    }
+}
+
+#ifdef CHAT_IO_URING
+bool Reactor::enableUring(unsigned entries, std::string& error) {
+    std::unique_ptr<Uring> created = Uring::create(entries, error);
+    if (!created) {
+        return false;
+    }
+    // El fd del ring se vuelve legible cuando hay completions
+    int ringFd = created->fd();
+    ring = std::move(created);
+    if (!add(ringFd, EPOLLIN, [this](uint32_t) { ring->processCompletions(); })) {
+        ring.reset();
+        error = "could not watch the ring";
+        return false;
+    }
+    return true;
+}
+#endif
+
+void Reactor::run() {
+    running = true;
+    std::vector<epoll_event> events(MaxEvents);
+    while (running) {
+        if (beforeWait) {
+            beforeWait();
+        }
+#ifdef CHAT_IO_URING
+        // Todo lo que se preparo en la vuelta anterior se envia al kernel en una sola llamada
+        if (ring) {
+            ring->submit();
+        }
+#endif
+        // Si hay timers pendientes solo se espera hasta el primero que vence, no se despierta en cada tick
+        int timeout = -1;
+        if (!timerWheel->empty()) {
+            auto remaining = timerWheel->nextExpiry() - std::chrono::steady_clock::now();
+            auto milliseconds = std::chrono::ceil<std::chrono::milliseconds>(remaining);
+            timeout = milliseconds.count() > 0 ? static_cast<int>(milliseconds.count()) : 0;
+        }
+
+        int ready = epoll_wait(epollFd, events.data(), MaxEvents, timeout);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            logError("Error waiting on epoll: {}", strerror(errno));
+            break;
+        }
+
+        for (int i = 0; i < ready; i++) {
+            // Buscamos el handler por fd, si un handler anterior del mismo lote
+            // removio este descriptor simplemente se ignora el evento
+            auto it = handlers.find(events[i].data.fd);
+            if (it == handlers.end()) {
+                continue;
+            }
+            // Copiamos el handler porque puede removerse a si mismo
+            Handler handler = it->second;
+            handler(events[i].events);
+        }
+
+        // Se ejecutan los timers que vencieron mientras se esperaba o se atendian eventos
+        timerWheel->advance(std::chrono::steady_clock::now());
+    }
+}
@@ -0,0 +1,103 @@
+// reactor.h
+#ifndef REACTOR_H
+#define REACTOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <sys/epoll.h>
+#include "server/timer_wheel.h"
+#ifdef CHAT_IO_URING
+#include "server/uring.h"
+#endif
+
+/**
+ * Ciclo de eventos basado en epoll. Un solo hilo atiende todos los sockets
+ * registrados, llamando al handler de cada descriptor cuando está listo, y
+ * ejecuta los timers de su timer wheel cuando vencen.
+ */
+class Reactor {
+public:
+    // Handler que recibe la mascara de eventos de epoll (EPOLLIN, EPOLLOUT, ...)
+    using Handler = std::function<void(uint32_t events)>;
+
+    Reactor();
+    ~Reactor();
+
+    Reactor(const Reactor&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+
+    /**
+     * Registra un descriptor en el epoll
+     *
+     * @param fd Descriptor a observar
+     * @param events Eventos de interes
+     * @param handler Funcion a llamar cuando el descriptor este listo
+     */
+    bool add(int fd, uint32_t events, Handler handler);
+
+    /**
+     * Cambia los eventos de interes de un descriptor ya registrado
+     */
+    bool modify(int fd, uint32_t events);
+
+    /**
+     * Quita un descriptor del epoll. No cierra el descriptor.
+     */
+    void remove(int fd);
+
+    /**
+     * Cambia la resolucion de los timers. Solo se puede hacer antes de programar alguno.
+     *
+     * @param resolution Duracion de un tick del timer wheel
+     */
+    void setTimerResolution(std::chrono::milliseconds resolution);
+
+    // Timers del ciclo de eventos, solo se deben usar desde el hilo del reactor
+    TimerWheel& timers() { return *timerWheel; }
+
+    /**
+     * Define una funcion que se ejecuta al final de cada vuelta del ciclo,
+     * despues de atender los eventos y los timers y antes de volver a esperar
+     *
+     * @param hook Funcion a ejecutar
+     */
+    void setBeforeWait(std::function<void()> hook) { beforeWait = std::move(hook); }
+
+#ifdef CHAT_IO_URING
+    /**
+     * Crea un io_uring para este reactor. Sus completions se atienden desde el
+     * mismo ciclo de eventos y lo preparado se envia al kernel en cada vuelta.
+     *
+     * @param entries Tamaño de la cola de envio
+     * @param error Descripcion del error si io_uring no esta disponible
+     */
+    bool enableUring(unsigned entries, std::string& error);
+
+    // io_uring del reactor, nullptr si se usa solo epoll
+    Uring* uring() { return ring.get(); }
+#endif
+
+    /**
+     * Ejecuta el ciclo de eventos hasta que se llame stop()
+     */
+    void run();
+
+    void stop() { running = false; }
+
+private:
+    int epollFd;
+    bool running = false;
+    std::unordered_map<int, Handler> handlers;
+    std::unique_ptr<TimerWheel> timerWheel;
+    std::function<void()> beforeWait;
+#ifdef CHAT_IO_URING
+    std::unique_ptr<Uring> ring;
+#endif
+};
+
+#endif
@@ -0,0 +1,149 @@
+// session_registry.cpp
+#include "./session_registry.h"
+
+#include <algorithm>
+#include "server/metrics.h"
+
+/**
+ * Histograma donde se registra cuanto se bloquea un shard, nullptr fuera de los workers
+ */
+static MetricsHistogram* lockHistogram() {
+    WorkerMetrics* metrics = WorkerMetrics::local();
+    return metrics ? &metrics->registryLock : nullptr;
+}
+
+SessionRegistry::SessionRegistry(size_t shardCount)
+    : shards(new Shard[shardCount]), ipShards(new IpShard[shardCount]), shardCount(shardCount),
+      published(std::make_shared<const Snapshot>()) {}
+
+SessionRegistry::Shard& SessionRegistry::shardFor(const std::string& username) const {
+    return shards[std::hash<std::string>{}(username) % shardCount];
+}
+
+SessionRegistry::IpShard& SessionRegistry::ipShardFor(const std::string& ip) const {
+    return ipShards[std::hash<std::string>{}(ip) % shardCount];
+}
+
+SessionRegistry::AddResult SessionRegistry::add(const SessionPtr& session) {
+    {
+        // Siempre se bloquea primero el shard de IP y luego el de username,
+        // asi dos registros concurrentes no pueden quedar esperandose entre si
+        IpShard& ipShard = ipShardFor(session->ip);
+        Shard& shard = shardFor(session->username);
+        std::scoped_lock lock(ipShard.mutex, shard.mutex);
+        // Se destruye antes que el lock, mide solo el tiempo con los shards bloqueados
+        ScopedTimer held(lockHistogram());
+
+        if (shard.sessions.find(session->username) != shard.sessions.end()) {
+            return AddResult::NameTaken;
+        }
+        if (ipShard.users.find(session->ip) != ipShard.users.end()) {
+            return AddResult::IpTaken;
+        }
+        shard.sessions.emplace(session->username, session);
+        ipShard.users.emplace(session->ip, session->username);
+        count.fetch_add(1, std::memory_order_relaxed);
+        // Se encola con el shard bloqueado, asi los cambios de un mismo usuario quedan en orden
+        std::lock_guard<std::mutex> pendingLock(pendingMutex);
+        pending.push_back({session, true});
+    }
+    publishChanges();
+    return AddResult::Added;
+}
+
+SessionPtr SessionRegistry::find(const std::string& username) const {
+    Shard& shard = shardFor(username);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    ScopedTimer held(lockHistogram());
+    auto it = shard.sessions.find(username);
+    return it == shard.sessions.end() ? nullptr : it->second;
+}
+
+bool SessionRegistry::remove(const SessionPtr& session) {
+    {
+        IpShard& ipShard = ipShardFor(session->ip);
+        Shard& shard = shardFor(session->username);
+        std::scoped_lock lock(ipShard.mutex, shard.mutex);
+        ScopedTimer held(lockHistogram());
+
+        // Solo se elimina si el registro apunta a esta misma sesion
+        auto it = shard.sessions.find(session->username);
+        if (it == shard.sessions.end() || it->second != session) {
+            return false;
+        }
+        shard.sessions.erase(it);
+        auto ipIt = ipShard.users.find(session->ip);
+        if (ipIt != ipShard.users.end() && ipIt->second == session->username) {
+            ipShard.users.erase(ipIt);
+        }
+        count.fetch_sub(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> pendingLock(pendingMutex);
+        pending.push_back({session, false});
+    }
+    publishChanges();
+    return true;
+}
+
+void SessionRegistry::publishChanges() {
+    // Si otra alta o baja esta armando la lista, esa vuelve a revisar los cambios pendientes
+    // despues de soltar publishMutex; asi una rafaga de registros arma pocas listas y no una por cambio
+    while (true) {
+        std::unique_lock<std::mutex> publishLock(publishMutex, std::try_to_lock);
+        if (!publishLock.owns_lock()) {
+            return;
+        }
+        publishBatch();
+        publishLock.unlock();
+        // Un cambio encolado mientras se tenia el lock no se publico: quien lo encolo no pudo tomar
+        // publishMutex y ya se fue, asi que se vuelve a intentar
+        std::lock_guard<std::mutex> pendingLock(pendingMutex);
+        if (pending.empty()) {
+            return;
+        }
+    }
+}
+
+void SessionRegistry::publishBatch() {
+    std::vector<Change> batch;
+    {
+        std::lock_guard<std::mutex> pendingLock(pendingMutex);
+        batch.swap(pending);
+    }
+    if (batch.empty()) {
+        return;
+    }
+
+    // Se ordenan los cambios por username sin perder el orden de los de un mismo usuario
+    // y se mezclan con la lista anterior, que ya esta ordenada
+    std::stable_sort(batch.begin(), batch.end(),
+                     [](const Change& a, const Change& b) { return a.session->username < b.session->username; });
+    SnapshotPtr previous = published.load(std::memory_order_acquire);
+    const std::vector<SessionPtr>& before = previous->sessions;
+    auto rebuilt = std::make_shared<Snapshot>();
+    rebuilt->version = previous->version + batch.size();
+    rebuilt->sessions.reserve(before.size() + batch.size());
+    size_t i = 0;
+    size_t j = 0;
+    while (i < before.size() || j < batch.size()) {
+        if (j == batch.size() || (i < before.size() && before[i]->username < batch[j].session->username)) {
+            rebuilt->sessions.push_back(before[i++]);
+            continue;
+        }
+        const std::string& username = batch[j].session->username;
+        SessionPtr current;
+        if (i < before.size() && before[i]->username == username) {
+            current = before[i++];
+        }
+        for (; j < batch.size() && batch[j].session->username == username; j++) {
+            if (batch[j].added) {
+                current = batch[j].session;
+            } else if (current == batch[j].session) {
+                current = nullptr;
+            }
+        }
+        if (current) {
+            rebuilt->sessions.push_back(std::move(current));
+        }
+    }
+    published.store(std::move(rebuilt), std::memory_order_release);
+}
@@ -0,0 +1,126 @@
+// session_registry.h
+#ifndef SESSION_REGISTRY_H
+#define SESSION_REGISTRY_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "protocol/chat.pb.h"
+
+/**
+ * Estado de un usuario registrado. Los campos que cambian despues del
+ * registro son atomicos para poder leerlos y actualizarlos sin bloquear
+ * el shard del registro.
+ */
+struct Session {
+    std::string username;
+    std::string ip;
+    int fd = -1;                                    // Socket de la conexion del usuario
+    size_t worker = 0;                              // Worker que atiende la conexion del usuario
+    std::atomic<chat::UserStatus> status{chat::UserStatus::ONLINE};
+    std::atomic<int64_t> lastActivity{0};           // Ultima actividad, en nanosegundos de steady_clock
+
+    // Marca la sesion como activa en este momento
+    void touch() {
+        lastActivity = std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+};
+
+using SessionPtr = std::shared_ptr<Session>;
+
+/**
+ * Registro concurrente de sesiones. Los usuarios se reparten en shards segun
+ * el hash de su username, cada shard con su propio mutex, para que clientes
+ * distintos no compitan por el mismo lock. Un indice aparte por IP, tambien
+ * en shards, permite revisar que no haya dos usuarios con la misma IP. Para
+ * listar usuarios se publica una copia inmutable y ordenada del registro.
+ */
+class SessionRegistry {
+public:
+    // Lista inmutable de las sesiones, ordenadas por username
+    struct Snapshot {
+        uint64_t version = 0;             // Cambios del registro que ya estan en la lista
+        std::vector<SessionPtr> sessions;
+    };
+    using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+    enum class AddResult {
+        Added,
+        NameTaken, // Ya existe un usuario con ese username
+        IpTaken    // Ya existe un usuario registrado desde esa IP
+    };
+
+    explicit SessionRegistry(size_t shardCount = 64);
+
+    /**
+     * Registra una sesion si su username y su IP estan libres
+     *
+     * @param session Sesion a registrar
+     */
+    AddResult add(const SessionPtr& session);
+
+    /**
+     * Busca la sesion de un usuario
+     *
+     * @param username Usuario a buscar
+     * @return La sesion o nullptr si no existe
+     */
+    SessionPtr find(const std::string& username) const;
+
+    /**
+     * Elimina una sesion del registro
+     *
+     * @param session Sesion a eliminar
+     * @return false si la sesion ya no estaba registrada
+     */
+    bool remove(const SessionPtr& session);
+
+    /**
+     * Lista de todas las sesiones. Leerla solo copia un shared_ptr atomico, no
+     * bloquea ningun shard: las altas y bajas son las que publican la lista nueva.
+     */
+    SnapshotPtr snapshot() const { return published.load(std::memory_order_acquire); }
+
+    // Cantidad de sesiones registradas
+    size_t size() const { return count.load(std::memory_order_relaxed); }
+
+private:
+    // Se alinea a la linea de cache para que shards vecinos no se estorben
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string, SessionPtr> sessions;
+    };
+
+    struct alignas(64) IpShard {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::string> users; // IP -> username
+    };
+
+    // Alta o baja que todavia no esta en la lista publicada
+    struct Change {
+        SessionPtr session;
+        bool added;
+    };
+
+    Shard& shardFor(const std::string& username) const;
+    IpShard& ipShardFor(const std::string& ip) const;
+    void publishChanges();
+    void publishBatch();
+
+    // unique_ptr porque los shards no se pueden mover (tienen mutex)
+    std::unique_ptr<Shard[]> shards;
+    std::unique_ptr<IpShard[]> ipShards;
+    size_t shardCount;
+    std::atomic<size_t> count{0};
+    std::atomic<SnapshotPtr> published;         // Ultima lista armada
+    std::mutex pendingMutex;
+    std::vector<Change> pending;                // Cambios en el orden en que se hicieron
+    std::mutex publishMutex;                    // Solo una alta o baja arma la lista a la vez
+};
+
+#endif
@@ -0,0 +1,180 @@
+// timer_wheel.cpp
+#include "./timer_wheel.h"
+
+#include <algorithm>
+
+TimerWheel::TimerWheel(std::chrono::milliseconds resolution, Clock::time_point start)
+    : tickLength(resolution.count() > 0 ? resolution : std::chrono::milliseconds(1)), startTime(start) {
+    level0.fill(None);
+    for (auto& level : upperLevels) {
+        level.fill(None);
+    }
+}
+
+TimerWheel::TimerId TimerWheel::schedule(Clock::duration delay, Callback callback, Clock::time_point now) {
+    uint32_t index;
+    if (!freeNodes.empty()) {
+        index = freeNodes.back();
+        freeNodes.pop_back();
+    } else {
+        index = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+    }
+
+    // Se cuenta desde el momento actual (no desde el inicio del tick) y se
+    // redondea hacia arriba para que el timer nunca se ejecute antes de tiempo
+    auto deadline = (now < startTime ? Clock::duration(0) : now - startTime) + delay;
+    int64_t tick = Clock::duration(tickLength).count();
+    uint64_t expires = (deadline.count() + tick - 1) / tick;
+    Node& node = nodes[index];
+    node.expires = expires > currentTick ? expires : currentTick + 1;
+    node.callback = std::move(callback);
+    insert(index);
+    active++;
+    return (static_cast<uint64_t>(node.generation) << 32) | (static_cast<uint64_t>(index) + 1);
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    if (id == 0) {
+        return false;
+    }
+    uint32_t index = static_cast<uint32_t>((id & 0xFFFFFFFF) - 1);
+    uint32_t generation = static_cast<uint32_t>(id >> 32);
+    // La generacion evita cancelar un timer nuevo que reutilizo el mismo nodo
+    if (index >= nodes.size() || nodes[index].generation != generation || nodes[index].slot == nullptr) {
+        return false;
+    }
+    unlink(index);
+    release(index);
+    return true;
+}
+
+void TimerWheel::insert(uint32_t index) {
+    Node& node = nodes[index];
+    uint64_t diff = node.expires > currentTick ? node.expires - currentTick : 0;
+    uint32_t* slot;
+    if (diff < Level0Size) {
+        slot = &level0[node.expires & (Level0Size - 1)];
+    } else {
+        // Buscamos el nivel mas fino donde cabe el timer
+        int level = 0;
+        uint64_t expires = node.expires;
+        while (level < Levels - 2 && diff >= (uint64_t(1) << (Level0Bits + LevelBits * (level + 1)))) {
+            level++;
+        }
+        // Los timers mas lejanos que el ultimo nivel se quedan en su ultimo slot y se reubican al bajar
+        uint64_t maxDiff = (uint64_t(1) << (Level0Bits + LevelBits * (Levels - 1))) - 1;
+        if (diff > maxDiff) {
+            expires = currentTick + maxDiff;
+        }
+        int shift = Level0Bits + LevelBits * level;
+        slot = &upperLevels[level][(expires >> shift) & (LevelSize - 1)];
+    }
+
+    node.slot = slot;
+    node.prev = None;
+    node.next = *slot;
+    if (*slot != None) {
+        nodes[*slot].prev = index;
+    }
+    *slot = index;
+}
+
+void TimerWheel::unlink(uint32_t index) {
+    Node& node = nodes[index];
+    if (node.prev != None) {
+        nodes[node.prev].next = node.next;
+    } else {
+        *node.slot = node.next;
+    }
+    if (node.next != None) {
+        nodes[node.next].prev = node.prev;
+    }
+    node.slot = nullptr;
+    node.prev = node.next = None;
+}
+
+void TimerWheel::release(uint32_t index) {
+    Node& node = nodes[index];
+    node.callback = nullptr;
+    node.generation++;
+    freeNodes.push_back(index);
+    active--;
+}
+
+void TimerWheel::cascade(int level, uint32_t slotIndex) {
+    // Se separa la lista del slot y cada timer se vuelve a insertar segun lo que le falta
+    uint32_t current = upperLevels[level][slotIndex];
+    upperLevels[level][slotIndex] = None;
+    while (current != None) {
+        uint32_t next = nodes[current].next;
+        insert(current);
+        current = next;
+    }
+}
+
+void TimerWheel::advance(Clock::time_point now) {
+    if (now < startTime) {
+        return;
+    }
+    uint64_t target = (now - startTime) / tickLength;
+    // Sin timers pendientes no hay nada que recorrer, se salta directo al tick actual
+    if (active == 0 && currentTick < target) {
+        currentTick = target;
+    }
+    while (currentTick < target) {
+        currentTick++;
+
+        // Al completar una vuelta de un nivel se bajan los timers del siguiente
+        for (int level = 0; level < Levels - 1; level++) {
+            int shift = Level0Bits + LevelBits * level;
+            if ((currentTick & ((uint64_t(1) << shift) - 1)) != 0) {
+                break;
+            }
+            cascade(level, (currentTick >> shift) & (LevelSize - 1));
+        }
+
+        // Se mueve la lista del slot a una lista local, asi los callbacks pueden
+        // programar o cancelar timers (incluidos los de esta lista) sin problema
+        uint32_t firing = level0[currentTick & (Level0Size - 1)];
+        level0[currentTick & (Level0Size - 1)] = None;
+        for (uint32_t index = firing; index != None; index = nodes[index].next) {
+            nodes[index].slot = &firing;
+        }
+
+        while (firing != None) {
+            uint32_t index = firing;
+            unlink(index);
+            Callback callback = std::move(nodes[index].callback);
+            release(index);
+            callback();
+        }
+    }
+}
+
+TimerWheel::Clock::time_point TimerWheel::nextExpiry() const {
+    // En el primer nivel cada slot es un tick, el primero ocupado es el siguiente en vencer
+    uint64_t earliest = UINT64_MAX;
+    for (uint64_t distance = 1; distance < Level0Size; distance++) {
+        if (level0[(currentTick + distance) & (Level0Size - 1)] != None) {
+            earliest = currentTick + distance;
+            break;
+        }
+    }
+    // En los niveles de arriba se despierta cuando el primer slot ocupado se baja de nivel,
+    // nunca despues de que venza alguno de sus timers. El slot actual se baja en la siguiente vuelta
+    for (int level = 0; level < Levels - 1; level++) {
+        int shift = Level0Bits + LevelBits * level;
+        uint64_t block = currentTick >> shift;
+        for (uint64_t distance = 1; distance <= LevelSize; distance++) {
+            if (upperLevels[level][(block + distance) & (LevelSize - 1)] != None) {
+                earliest = std::min(earliest, (block + distance) << shift);
+                break;
+            }
+        }
+    }
+    if (earliest == UINT64_MAX) {
+        earliest = currentTick + 1;
+    }
+    return startTime + tickLength * earliest;
+}
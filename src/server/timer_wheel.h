@@ -0,0 +1,101 @@
+// timer_wheel.h
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * Timer wheel jerarquico. El tiempo avanza en ticks de resolucion fija; los
+ * timers cercanos viven en el primer nivel (un slot por tick) y los lejanos
+ * en niveles mas gruesos que se van bajando de nivel conforme se acercan.
+ * Programar y cancelar es O(1) y avanzar un tick solo cuesta los timers que
+ * vencen en ese tick (mas los que bajan de nivel), no todos los timers.
+ */
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void()>;
+    // Identificador de un timer, 0 nunca es un timer valido
+    using TimerId = uint64_t;
+
+    explicit TimerWheel(std::chrono::milliseconds resolution, Clock::time_point start = Clock::now());
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * Programa una funcion para ejecutarse despues de un tiempo
+     *
+     * @param delay Tiempo a esperar, se redondea hacia arriba al siguiente tick
+     * @param callback Funcion a ejecutar
+     * @param now Momento desde el que se cuenta el tiempo
+     * @return Identificador para poder cancelar el timer
+     */
+    TimerId schedule(Clock::duration delay, Callback callback, Clock::time_point now = Clock::now());
+
+    /**
+     * Cancela un timer que aun no se ha ejecutado
+     *
+     * @param id Timer a cancelar
+     * @return false si el timer ya se ejecuto o no existe
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * Ejecuta todos los timers que vencieron hasta el momento indicado
+     *
+     * @param now Momento actual
+     */
+    void advance(Clock::time_point now);
+
+    /**
+     * Momento en que vence el primer timer o en que hay que bajar de nivel los
+     * timers de un slot, para saber cuanto puede dormir el ciclo de eventos.
+     * Solo tiene sentido si hay timers pendientes.
+     */
+    Clock::time_point nextExpiry() const;
+
+    bool empty() const { return active == 0; }
+    size_t size() const { return active; }
+    std::chrono::milliseconds resolution() const { return tickLength; }
+
+private:
+    static constexpr int Level0Bits = 8;
+    static constexpr int LevelBits = 6;
+    static constexpr int Levels = 4;
+    static constexpr uint32_t Level0Size = 1u << Level0Bits;
+    static constexpr uint32_t LevelSize = 1u << LevelBits;
+    static constexpr uint32_t None = UINT32_MAX;
+
+    // Los timers viven en un pool y se enlazan por indice dentro de cada slot
+    struct Node {
+        uint64_t expires = 0;
+        uint32_t generation = 0;
+        uint32_t prev = None;
+        uint32_t next = None;
+        uint32_t* slot = nullptr; // Cabeza de la lista donde esta el nodo, nullptr si esta libre
+        Callback callback;
+    };
+
+    void insert(uint32_t index);
+    void unlink(uint32_t index);
+    void cascade(int level, uint32_t slotIndex);
+    void release(uint32_t index);
+
+    std::chrono::milliseconds tickLength;
+    Clock::time_point startTime;
+    uint64_t currentTick = 0;
+    size_t active = 0;
+
+    std::array<uint32_t, Level0Size> level0;
+    std::array<std::array<uint32_t, LevelSize>, Levels - 1> upperLevels;
+
+    std::vector<Node> nodes;
+    std::vector<uint32_t> freeNodes;
+};
+
+#endif
@@ -0,0 +1,254 @@
+// uring.cpp
+#include "./uring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Los punteros del ring se comparten con el kernel, se leen y escriben de forma atomica
+static unsigned loadAcquire(unsigned* value) {
+    return std::atomic_ref<unsigned>(*value).load(std::memory_order_acquire);
+}
+
+static void storeRelease(unsigned* value, unsigned newValue) {
+    std::atomic_ref<unsigned>(*value).store(newValue, std::memory_order_release);
+}
+
+std::unique_ptr<Uring> Uring::create(unsigned entries, std::string& error) {
+    std::unique_ptr<Uring> ring(new Uring());
+
+    io_uring_params params{};
+    // La cola de completions es mas grande porque las operaciones multishot generan varios CQE
+    params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL;
+    params.cq_entries = entries * 4;
+    ring->ringFd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (ring->ringFd < 0) {
+        error = std::string("io_uring_setup: ") + strerror(errno);
+        return nullptr;
+    }
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_NODROP)) {
+        error = "kernel io_uring is too old";
+        return nullptr;
+    }
+
+    // Las colas de envio y de completions comparten un solo mmap
+    size_t sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    size_t cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    ring->ringSize = std::max(sqSize, cqSize);
+    ring->ringMemory = mmap(nullptr, ring->ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQ_RING);
+    if (ring->ringMemory == MAP_FAILED) {
+        ring->ringMemory = nullptr;
+        error = std::string("mmap ring: ") + strerror(errno);
+        return nullptr;
+    }
+    ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        error = std::string("mmap sqes: ") + strerror(errno);
+        return nullptr;
+    }
+    ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+    char* base = static_cast<char*>(ring->ringMemory);
+    ring->sqHead = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+    ring->sqTail = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+    ring->sqFlags = reinterpret_cast<unsigned*>(base + params.sq_off.flags);
+    ring->sqArray = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+    ring->sqMask = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+    ring->sqEntries = params.sq_entries;
+    ring->localTail = ring->submitted = *ring->sqTail;
+    ring->cqHead = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+    ring->cqTail = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+    ring->cqMask = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+    ring->cqes = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+
+    // Ring de buffers provistos: el kernel toma un buffer libre en cada recv
+    ring->bufferRingSize = BufferCount * sizeof(io_uring_buf);
+    void* bufferRing = mmap(nullptr, ring->bufferRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (bufferRing == MAP_FAILED) {
+        error = std::string("mmap buffer ring: ") + strerror(errno);
+        return nullptr;
+    }
+    ring->bufferRing = static_cast<io_uring_buf_ring*>(bufferRing);
+    io_uring_buf_reg registration{};
+    registration.ring_addr = reinterpret_cast<uint64_t>(bufferRing);
+    registration.ring_entries = BufferCount;
+    registration.bgid = BufferGroup;
+    if (syscall(__NR_io_uring_register, ring->ringFd, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+        error = std::string("provided buffer rings: ") + strerror(errno);
+        return nullptr;
+    }
+    ring->buffers.resize(static_cast<size_t>(BufferCount) * BufferLength);
+    for (unsigned id = 0; id < BufferCount; id++) {
+        ring->recycleBuffer(id << IORING_CQE_BUFFER_SHIFT);
+    }
+    return ring;
+}
+
+Uring::~Uring() {
+    if (bufferRing != nullptr) {
+        munmap(bufferRing, bufferRingSize);
+    }
+    if (sqes != nullptr) {
+        munmap(sqes, sqesSize);
+    }
+    if (ringMemory != nullptr) {
+        munmap(ringMemory, ringSize);
+    }
+    if (ringFd >= 0) {
+        close(ringFd);
+    }
+}
+
+int Uring::enter(unsigned toSubmit, unsigned flags) {
+    return static_cast<int>(syscall(__NR_io_uring_enter, ringFd, toSubmit, 0, flags, nullptr, 0));
+}
+
+io_uring_sqe* Uring::nextSqe() {
+    // Si la cola de envio esta llena se manda lo que hay para hacer espacio
+    if (localTail - loadAcquire(sqHead) >= sqEntries) {
+        submit();
+        if (localTail - loadAcquire(sqHead) >= sqEntries) {
+            return nullptr;
+        }
+    }
+    unsigned index = localTail & sqMask;
+    io_uring_sqe* sqe = &sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqArray[index] = index;
+    localTail++;
+    return sqe;
+}
+
+uint64_t Uring::start(io_uring_sqe* sqe, std::unique_ptr<Operation> operation) {
+    uint64_t id = nextOperation++;
+    sqe->user_data = id;
+    operations.emplace(id, std::move(operation));
+    return id;
+}
+
+uint64_t Uring::acceptMultishot(int fd, Completion completion) {
+    io_uring_sqe* sqe = nextSqe();
+    if (sqe == nullptr) {
+        return 0;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    auto operation = std::make_unique<Operation>();
+    operation->completion = std::move(completion);
+    return start(sqe, std::move(operation));
+}
+
+uint64_t Uring::recvMultishot(int fd, Completion completion) {
+    io_uring_sqe* sqe = nextSqe();
+    if (sqe == nullptr) {
+        return 0;
+    }
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BufferGroup;
+    auto operation = std::make_unique<Operation>();
+    operation->completion = std::move(completion);
+    return start(sqe, std::move(operation));
+}
+
+uint64_t Uring::sendFrames(int fd, const iovec* iov, size_t count, std::vector<SharedFrame> frames, Completion completion) {
+    io_uring_sqe* sqe = nextSqe();
+    if (sqe == nullptr) {
+        return 0;
+    }
+    // El header y los iovec viven en la operacion hasta que el kernel termina de usarlos
+    auto operation = std::make_unique<Operation>();
+    operation->completion = std::move(completion);
+    operation->frames = std::move(frames);
+    operation->iov.assign(iov, iov + count);
+    operation->header.msg_iov = operation->iov.data();
+    operation->header.msg_iovlen = count;
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(&operation->header);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    return start(sqe, std::move(operation));
+}
+
+void Uring::cancel(uint64_t operation) {
+    if (operation == 0 || operations.find(operation) == operations.end()) {
+        return;
+    }
+    io_uring_sqe* sqe = nextSqe();
+    if (sqe == nullptr) {
+        return;
+    }
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = operation;
+    // El resultado de la cancelacion no le interesa a nadie
+    sqe->user_data = 0;
+}
+
+unsigned Uring::submit() {
+    unsigned pending = localTail - submitted;
+    bool overflow = loadAcquire(sqFlags) & IORING_SQ_CQ_OVERFLOW;
+    if (pending == 0 && !overflow) {
+        return 0;
+    }
+    storeRelease(sqTail, localTail);
+    // Con CQEs desbordados se piden de vuelta al ring con GETEVENTS
+    int result = enter(pending, overflow ? IORING_ENTER_GETEVENTS : 0);
+    if (result < 0) {
+        // EINTR, EAGAIN o EBUSY: se vuelve a intentar en la siguiente vuelta del ciclo
+        return 0;
+    }
+    submitted += result;
+    return result;
+}
+
+void Uring::processCompletions() {
+    unsigned head = *cqHead;
+    while (head != loadAcquire(cqTail)) {
+        io_uring_cqe cqe = cqes[head & cqMask];
+        head++;
+        storeRelease(cqHead, head);
+        if (cqe.user_data == 0) {
+            continue;
+        }
+        auto it = operations.find(cqe.user_data);
+        if (it == operations.end()) {
+            continue;
+        }
+        if (hasMore(cqe.flags)) {
+            it->second->completion(cqe.user_data, cqe.res, cqe.flags);
+        } else {
+            // Ultimo CQE de la operacion, se saca antes de llamar por si la funcion inicia otra
+            std::unique_ptr<Operation> operation = std::move(it->second);
+            operations.erase(it);
+            operation->completion(cqe.user_data, cqe.res, cqe.flags);
+        }
+    }
+}
+
+const char* Uring::bufferData(uint32_t flags) const {
+    uint16_t id = flags >> IORING_CQE_BUFFER_SHIFT;
+    return buffers.data() + static_cast<size_t>(id) * BufferLength;
+}
+
+void Uring::recycleBuffer(uint32_t flags) {
+    uint16_t id = flags >> IORING_CQE_BUFFER_SHIFT;
+    // Se indexa a mano porque en C++ el arreglo flexible de io_uring_buf_ring
+    // no queda al inicio de la estructura como en C
+    io_uring_buf& buffer = reinterpret_cast<io_uring_buf*>(bufferRing)[bufferTail & (BufferCount - 1)];
+    buffer.addr = reinterpret_cast<uint64_t>(buffers.data() + static_cast<size_t>(id) * BufferLength);
+    buffer.len = BufferLength;
+    buffer.bid = id;
+    bufferTail++;
+    std::atomic_ref<uint16_t>(bufferRing->tail).store(bufferTail, std::memory_order_release);
+}
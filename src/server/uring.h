@@ -0,0 +1,140 @@
+// uring.h
+#ifndef URING_H
+#define URING_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include "protocol/message.h"
+
+/**
+ * Envoltura minima de io_uring hecha directamente con las llamadas al sistema
+ * (no se necesita liburing). Las operaciones se preparan en la cola de
+ * envio y se mandan todas juntas con submit(), asi que enviar un broadcast a
+ * miles de sockets cuesta una sola llamada al sistema. Los recv usan un ring
+ * de buffers provistos, el kernel elige el buffer cuando llegan datos.
+ */
+class Uring {
+public:
+    // Recibe el id de la operacion, el resultado (bytes o -errno) y los flags del CQE
+    using Completion = std::function<void(uint64_t operation, int result, uint32_t flags)>;
+
+    /**
+     * Crea el ring y registra su ring de buffers para recv
+     *
+     * @param entries Tamaño de la cola de envio
+     * @param error Descripcion del error si no se pudo crear
+     * @return El ring o nullptr si io_uring no esta disponible
+     */
+    static std::unique_ptr<Uring> create(unsigned entries, std::string& error);
+
+    ~Uring();
+
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+
+    /**
+     * Acepta conexiones de forma continua, un CQE por cada cliente nuevo
+     */
+    uint64_t acceptMultishot(int fd, Completion completion);
+
+    /**
+     * Recibe de forma continua usando el ring de buffers, un CQE por cada lectura.
+     * Despues de copiar los datos hay que devolver el buffer con recycleBuffer().
+     */
+    uint64_t recvMultishot(int fd, Completion completion);
+
+    /**
+     * Envia varios frames en una sola operacion
+     *
+     * @param fd Socket destino
+     * @param iov Partes a enviar, apuntan dentro de los frames
+     * @param count Cantidad de partes
+     * @param frames Frames que deben seguir vivos hasta que termine el envio
+     * @param completion Funcion que recibe los bytes enviados
+     */
+    uint64_t sendFrames(int fd, const iovec* iov, size_t count, std::vector<SharedFrame> frames, Completion completion);
+
+    /**
+     * Cancela una operacion pendiente, su CQE final llega con -ECANCELED
+     */
+    void cancel(uint64_t operation);
+
+    /**
+     * Manda al kernel todas las operaciones preparadas
+     *
+     * @return Cantidad de operaciones enviadas
+     */
+    unsigned submit();
+
+    /**
+     * Procesa todos los CQE disponibles llamando a la funcion de cada operacion
+     */
+    void processCompletions();
+
+    // Datos del buffer que el kernel uso en un recv, segun los flags del CQE
+    const char* bufferData(uint32_t flags) const;
+    // Devuelve el buffer de un recv al ring para que el kernel lo vuelva a usar
+    void recycleBuffer(uint32_t flags);
+
+    static bool hasBuffer(uint32_t flags) { return flags & IORING_CQE_F_BUFFER; }
+    // La operacion multishot sigue activa despues de este CQE
+    static bool hasMore(uint32_t flags) { return flags & IORING_CQE_F_MORE; }
+
+    int fd() const { return ringFd; }
+
+private:
+    static constexpr unsigned BufferCount = 256;     // Buffers en el ring de buffers provistos
+    static constexpr unsigned BufferLength = 16384;  // Tamaño de cada buffer
+    static constexpr uint16_t BufferGroup = 0;
+
+    // Estado de una operacion hasta que llega su ultimo CQE
+    struct Operation {
+        Completion completion;
+        std::vector<SharedFrame> frames;
+        std::vector<iovec> iov;
+        msghdr header{};
+    };
+
+    Uring() = default;
+    io_uring_sqe* nextSqe();
+    uint64_t start(io_uring_sqe* sqe, std::unique_ptr<Operation> operation);
+    int enter(unsigned toSubmit, unsigned flags);
+
+    int ringFd = -1;
+    void* ringMemory = nullptr;
+    size_t ringSize = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* sqFlags = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+    unsigned localTail = 0;  // Cola de envio preparada pero aun no publicada
+    unsigned submitted = 0;  // Hasta donde ya se le entrego al kernel
+
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    io_uring_buf_ring* bufferRing = nullptr;
+    size_t bufferRingSize = 0;
+    std::vector<char> buffers;
+    uint16_t bufferTail = 0;
+
+    // Los ids no se repiten, asi cancelar una operacion que ya termino nunca toca otra
+    uint64_t nextOperation = 1;
+    std::unordered_map<uint64_t, std::unique_ptr<Operation>> operations;
+};
+
+#endif
@@ -0,0 +1,121 @@
+// worker.cpp
+#include "./worker.h"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "server/logger.h"
+
+thread_local Worker* Worker::currentWorker = nullptr;
+
+Worker::Worker(size_t index) : workerIndex(index) {
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd < 0) {
+        logError("Error creating eventfd: {}", strerror(errno));
+        return;
+    }
+    eventLoop.add(wakeFd, EPOLLIN, [this](uint32_t) { drainMailbox(); });
+    eventLoop.setBeforeWait([this] { flushPending(); });
+}
+
+Worker::~Worker() {
+    if (wakeFd >= 0) {
+        close(wakeFd);
+    }
+}
+
+void Worker::post(Task task) {
+    mailbox.push(std::move(task));
+    // Solo el primer mensaje desde la ultima lectura escribe en el eventfd, el
+    // resto se procesa en la misma vuelta
+    if (!wakePending.exchange(true, std::memory_order_acq_rel)) {
+        uint64_t one = 1;
+        if (write(wakeFd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+            logError("Error waking worker {}: {}", workerIndex, strerror(errno));
+        }
+    }
+}
+
+void Worker::drainMailbox() {
+    uint64_t value;
+    while (read(wakeFd, &value, sizeof(value)) > 0) {
+    }
+    // Se limpia antes de vaciar el mailbox, un push que llegue despues vuelve a despertar al worker
+    wakePending.store(false, std::memory_order_release);
+    Task task;
+    while (mailbox.pop(task)) {
+        task();
+    }
+}
+
+void Worker::run() {
+    currentWorker = this;
+    eventLoop.run();
+    currentWorker = nullptr;
+}
+
+void Worker::addMember(Connection& connection) {
+    if (connection.memberIndex >= 0) {
+        return;
+    }
+    connection.memberIndex = static_cast<int>(memberList.size());
+    memberList.push_back(&connection);
+}
+
+void Worker::removeMember(Connection& connection) {
+    if (connection.memberIndex < 0) {
+        return;
+    }
+    // Se mueve la ultima conexion al hueco para que quitar sea O(1)
+    Connection* last = memberList.back();
+    memberList[connection.memberIndex] = last;
+    last->memberIndex = connection.memberIndex;
+    memberList.pop_back();
+    connection.memberIndex = -1;
+}
+
+void Worker::addPresenceSubscriber(Connection& connection) {
+    if (connection.presenceIndex >= 0) {
+        return;
+    }
+    connection.presenceIndex = static_cast<int>(presenceList.size());
+    presenceList.push_back(&connection);
+}
+
+void Worker::removePresenceSubscriber(Connection& connection) {
+    if (connection.presenceIndex < 0) {
+        return;
+    }
+    Connection* last = presenceList.back();
+    presenceList[connection.presenceIndex] = last;
+    last->presenceIndex = connection.presenceIndex;
+    presenceList.pop_back();
+    connection.presenceIndex = -1;
+}
+
+void Worker::scheduleFlush(Connection& connection) {
+    if (!connection.flushScheduled) {
+        connection.flushScheduled = true;
+        pendingFlushes.push_back({connection.fd, connection.serial});
+    }
+}
+
+void Worker::flushPending() {
+    // Enviar puede encolar mas frames (por ejemplo al retomar requests de un
+    // cliente que estaba congestionado), se repite hasta que no quede nada
+    while (!pendingFlushes.empty()) {
+        flushing.swap(pendingFlushes);
+        for (const PendingFlush& pending : flushing) {
+            Connection* connection = table.find(pending.fd);
+            if (connection == nullptr || connection->serial != pending.serial || !connection->flushScheduled) {
+                continue;
+            }
+            connection->flushScheduled = false;
+            if (flushHandler) {
+                flushHandler(*connection);
+            }
+        }
+        flushing.clear();
+    }
+}
@@ -0,0 +1,121 @@
+// worker.h
+#ifndef WORKER_H
+#define WORKER_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "protocol/message_arena.h"
+#include "server/channel_index.h"
+#include "server/connection.h"
+#include "server/mailbox.h"
+#include "server/reactor.h"
+
+/**
+ * Un hilo del servidor con su propio ciclo de eventos y sus propias
+ * conexiones. Cada worker acepta clientes en su propio socket (SO_REUSEPORT)
+ * y solo el toca sus conexiones; los demas workers le piden trabajo a traves
+ * de su mailbox, que despierta al reactor con un eventfd.
+ */
+class Worker {
+public:
+    using Task = std::function<void()>;
+
+    explicit Worker(size_t index);
+    ~Worker();
+
+    Worker(const Worker&) = delete;
+    Worker& operator=(const Worker&) = delete;
+
+    /**
+     * Envia una tarea para que se ejecute en el hilo de este worker. Se puede
+     * llamar desde cualquier hilo, las tareas se ejecutan en el orden en que
+     * llegaron.
+     *
+     * @param task Funcion a ejecutar
+     */
+    void post(Task task);
+
+    /**
+     * Ejecuta el ciclo de eventos del worker en el hilo actual
+     */
+    void run();
+
+    /**
+     * Agrega una conexion a las que reciben los broadcasts de este worker
+     */
+    void addMember(Connection& connection);
+
+    /**
+     * Quita una conexion de las que reciben los broadcasts, si estaba
+     */
+    void removeMember(Connection& connection);
+
+    /**
+     * Agrega una conexion a las que reciben los cambios de presencia de este worker
+     */
+    void addPresenceSubscriber(Connection& connection);
+
+    /**
+     * Quita una conexion de las que reciben los cambios de presencia, si estaba
+     */
+    void removePresenceSubscriber(Connection& connection);
+
+    /**
+     * Marca una conexion para enviar su cola al final de la vuelta actual del
+     * ciclo de eventos. Asi todo lo que se le encola en una vuelta sale junto.
+     */
+    void scheduleFlush(Connection& connection);
+
+    /**
+     * Define la funcion que envia la cola de las conexiones marcadas
+     */
+    void setFlushHandler(std::function<void(Connection&)> handler) { flushHandler = std::move(handler); }
+
+    // Conexiones con usuario registrado en este worker
+    const std::vector<Connection*>& members() const { return memberList; }
+
+    // Conexiones de este worker suscritas a los cambios de presencia
+    const std::vector<Connection*>& presenceSubscribers() const { return presenceList; }
+
+    // Suscriptores de cada canal entre las conexiones de este worker
+    ChannelIndex& channels() { return channelIndex; }
+
+    size_t index() const { return workerIndex; }
+    Reactor& reactor() { return eventLoop; }
+    ConnectionTable& connections() { return table; }
+    // Arena de los mensajes protobuf del request que se esta procesando
+    MessageArena& arena() { return messages; }
+
+    // Worker del hilo actual, solo es valido dentro de run()
+    static Worker& current() { return *currentWorker; }
+
+private:
+    // Conexion marcada con scheduleFlush, el serial descarta sockets que se cerraron y reutilizaron
+    struct PendingFlush {
+        int fd;
+        uint64_t serial;
+    };
+
+    void drainMailbox();
+    void flushPending();
+
+    static thread_local Worker* currentWorker;
+
+    size_t workerIndex;
+    Reactor eventLoop;
+    ConnectionTable table;
+    std::vector<Connection*> memberList;
+    std::vector<Connection*> presenceList;
+    ChannelIndex channelIndex;
+    MessageArena messages;
+    Mailbox<Task> mailbox;
+    int wakeFd = -1;
+    std::atomic<bool> wakePending{false}; // Ya se escribio en el eventfd y el worker no lo ha leido
+    std::vector<PendingFlush> pendingFlushes;
+    std::vector<PendingFlush> flushing;
+    std::function<void(Connection&)> flushHandler;
+};
+
+#endif